@@ -0,0 +1,107 @@
+#include "AntCap.h"
+
+AntCapShared antcapStats;
+AntCapBucket antcapTab[BAND_COUNT][ANTCAP_BUCKETS];
+
+// ===== Fächer =====
+static inline uint32_t bandSpan(uint8_t band) {
+  return (uint32_t) bandDesc[band].maximumFreq - bandDesc[band].minimumFreq + 1;
+}
+
+static inline uint16_t bucketLo(uint8_t band, uint8_t b) {
+  return bandDesc[band].minimumFreq + (uint16_t)(bandSpan(band) * b / ANTCAP_BUCKETS);
+}
+
+// Lernpunkt im Fach passt in 12 Bit; nur sehr breite Bänder (ALL) verlieren Auflösung
+static uint8_t offsetShift(uint8_t band) {
+  uint32_t w = (bandSpan(band) + ANTCAP_BUCKETS - 1) / ANTCAP_BUCKETS;
+  uint8_t s = 0;
+  while ((w >> s) > 0xFFF) s++;
+  return s;
+}
+
+uint8_t antcapBucket(uint8_t band, uint16_t f) {
+  const BandDesc &d = bandDesc[band];
+  if (f <= d.minimumFreq) return 0;
+  const uint32_t b = (uint32_t)(f - d.minimumFreq) * ANTCAP_BUCKETS / bandSpan(band);
+  return (b < ANTCAP_BUCKETS) ? (uint8_t) b : ANTCAP_BUCKETS - 1;
+}
+
+static inline bool bandUsable(uint8_t band) {
+  return band < BAND_COUNT && bandDesc[band].type != FM_BAND_TYPE;
+}
+
+// ===== Radio-Task =====
+bool antcapLookup(uint8_t band, uint16_t f, uint32_t now, uint16_t &cap) {
+  if (!bandUsable(band)) return false;
+  const AntCapBucket &own = antcapTab[band][antcapBucket(band, f)];
+  if (!own.cap || own.stale || (now - own.learnedMs) > ANTCAP_STALE_MS) {
+    antcapStats.misses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  // Nächste Stützstellen unter- und oberhalb von f; das eigene Fach ist eine davon
+  const AntCapBucket *lo = nullptr, *hi = nullptr;
+  for (uint8_t b = 0; b < ANTCAP_BUCKETS; b++) {
+    const AntCapBucket &e = antcapTab[band][b];
+    if (!e.cap) continue;
+    if (e.freq <= f && (!lo || e.freq > lo->freq)) lo = &e;
+    if (e.freq >= f && (!hi || e.freq < hi->freq)) hi = &e;
+  }
+  if (lo && hi && hi->freq != lo->freq) {
+    cap = lo->cap + (int32_t)((int32_t) hi->cap - lo->cap) * (f - lo->freq) / (hi->freq - lo->freq);
+  } else {
+    cap = (lo ? lo : hi)->cap;
+  }
+  antcapStats.hits.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void antcapLearn(uint8_t band, uint16_t f, uint16_t cap, uint32_t now) {
+  if (!bandUsable(band) || cap == 0 || cap > ANTCAP_MAX) return;
+  AntCapBucket &e = antcapTab[band][antcapBucket(band, f)];
+  e.cap = cap;
+  e.freq = f;
+  e.rssi = 0;
+  e.stale = false;
+  e.learnedMs = now;
+  antcapStats.learns.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool antcapRssi(uint8_t band, uint16_t f, uint8_t rssi) {
+  if (!bandUsable(band)) return false;
+  AntCapBucket &e = antcapTab[band][antcapBucket(band, f)];
+  if (!e.cap || e.stale || e.freq != f) return false;
+  // Erste Messung nach dem Lernen setzt die Erwartung
+  if (!e.rssi) {
+    e.rssi = (rssi > 0x7F) ? 0x7F : (rssi ? rssi : 1);
+    return false;
+  }
+  if ((uint16_t) rssi + ANTCAP_RSSI_MARGIN >= e.rssi) return false;
+  e.stale = true;
+  antcapStats.drops.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+// ===== Einstellungs-Log =====
+bool antcapPack(uint8_t idx, uint32_t &value) {
+  const uint8_t band = idx / ANTCAP_BUCKETS, b = idx % ANTCAP_BUCKETS;
+  if (!bandUsable(band)) return false;
+  const AntCapBucket &e = antcapTab[band][b];
+  if (!e.cap) return false;
+  const uint32_t off = (uint32_t)(e.freq - bucketLo(band, b)) >> offsetShift(band);
+  value = (uint32_t) e.cap | ((uint32_t)(e.rssi & 0x7F) << 13) | ((off & 0xFFF) << 20);
+  return true;
+}
+
+void antcapUnpack(uint8_t idx, uint32_t value) {
+  const uint8_t band = idx / ANTCAP_BUCKETS, b = idx % ANTCAP_BUCKETS;
+  if (!bandUsable(band)) return;
+  AntCapBucket &e = antcapTab[band][b];
+  e.cap = value & ANTCAP_MAX;
+  e.rssi = (value >> 13) & 0x7F;
+  e.freq = bucketLo(band, b) + (uint16_t)(((value >> 20) & 0xFFF) << offsetShift(band));
+  e.stale = false;
+  e.learnedMs = 0;
+  if (e.freq > bandDesc[band].maximumFreq) e.cap = 0;
+}
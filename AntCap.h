@@ -0,0 +1,52 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "Bands.h"
+
+// ===== Antennenkapazität =====
+// Gelernte Werte der Abstimmkapazität (ANTCAP) je AM/KW-Band, aufgeteilt in
+// ANTCAP_BUCKETS gleich breite Fächer. Nach einer automatischen Abstimmung
+// wird der vom Chip gemeldete Wert samt Frequenz als Stützstelle gelernt;
+// danach wird er zwischen den Stützstellen des Bandes interpoliert vorgegeben
+// und der Chip spart sich die Suche. Automatisch abgestimmt wird erst wieder,
+// wenn das Fach veraltet ist oder der Empfang am Lernpunkt deutlich unter der
+// Erwartung liegt. Gespeichert wird über das Einstellungs-Log (SK_ANTCAP_TAB).
+
+#define ANTCAP_BUCKETS      4
+#define ANTCAP_STALE_MS     (30UL * 60UL * 1000UL)
+#define ANTCAP_RSSI_MARGIN  6        // dB unter der Erwartung: neu lernen
+#define ANTCAP_SETTLE_MS    300      // nach dem Abstimmen keine RSSI-Prüfung
+#define ANTCAP_MAX          0x1FFF   // 13 Bit im gespeicherten Wert
+
+typedef struct {
+  uint16_t cap;         // 0 = nicht gelernt
+  uint16_t freq;        // Lernpunkt (kHz)
+  uint8_t  rssi;        // Erwartung am Lernpunkt, 0 = noch offen
+  bool     stale;       // Empfang am Lernpunkt eingebrochen
+  uint32_t learnedMs;   // aus dem Log geladen: Startzeit
+} AntCapBucket;
+
+typedef struct {
+  std::atomic<uint32_t> hits{0};     // Kapazität vorgegeben
+  std::atomic<uint32_t> misses{0};   // Chip sucht selbst
+  std::atomic<uint32_t> learns{0};
+  std::atomic<uint32_t> drops{0};    // Empfang unter der Erwartung
+} AntCapShared;
+
+// Nur der Radio-Task schreibt; Web-Handler lesen die Felder einzeln
+extern AntCapShared antcapStats;
+extern AntCapBucket antcapTab[BAND_COUNT][ANTCAP_BUCKETS];
+
+uint8_t antcapBucket(uint8_t band, uint16_t f);
+
+// Radio-Task
+// Interpolierter Wert für f; false = Fach fehlt oder veraltet (automatisch abstimmen)
+bool antcapLookup(uint8_t band, uint16_t f, uint32_t now, uint16_t &cap);
+void antcapLearn(uint8_t band, uint16_t f, uint16_t cap, uint32_t now);
+// RSSI-Messung auf f; true = Fach ist jetzt veraltet, neu abstimmen
+bool antcapRssi(uint8_t band, uint16_t f, uint8_t rssi);
+
+// Einstellungs-Log, idx = Band * ANTCAP_BUCKETS + Fach:
+// Kapazität (13 Bit) | Erwartung (7 Bit) << 13 | Lernpunkt im Fach (12 Bit) << 20
+bool antcapPack(uint8_t idx, uint32_t &value);   // false = nicht gelernt
+void antcapUnpack(uint8_t idx, uint32_t value);
@@ -0,0 +1,66 @@
+#include "ApiJson.h"
+#include <string.h>
+#include "RadioLogic.h"
+#include "JsonWriter.h"
+
+// ===== Status =====
+void formatSnapshotFreq(char *out, size_t outsz, const RadioSnapshot &st) {
+  if (st.mode == BAND_MODE_LSB || st.mode == BAND_MODE_USB) formatFreqHz(out, outsz, st.freqHz);
+  else formatFreq(out, outsz, st.freq, st.isFM);
+}
+
+size_t apiStatusJson(char *out, size_t outsz, const RadioSnapshot &st, const RadioSnapshot *prev,
+                     const char *netMode, const char *ip) {
+  JsonWriter w(out, outsz);
+  char tmp[24];
+  w.beginObject();
+  if (!prev || prev->mode != st.mode)       w.kv("mode", modeToStr(st.mode));
+  if (!prev || prev->bandIdx != st.bandIdx) w.kv("band", bandDesc[st.bandIdx].name).kv("band_idx", st.bandIdx);
+  if (!prev || prev->freqHz != st.freqHz || prev->freq != st.freq || prev->mode != st.mode) {
+    formatSnapshotFreq(tmp, sizeof(tmp), st);
+    w.kv("freq_raw", st.freq).kv("freq_hz", (unsigned long) st.freqHz).kv("freq_str", tmp);
+  }
+  if (!prev || prev->stepKHz != st.stepKHz || prev->mode != st.mode) w.kv("step_khz", st.stepKHz);
+  if (!prev || prev->rssi != st.rssi)       w.kv("rssi_dbuv", st.rssi);
+  if (!prev || prev->snr != st.snr)         w.kv("snr_db", st.snr);
+  if (!prev || strcmp(prev->ps, st.ps) != 0) w.kv("ps", st.ps);
+  if (!prev || prev->seeking != st.seeking) w.kv("seek", st.seeking);
+  if (!prev || prev->memSlot != st.memSlot || strcmp(prev->memName, st.memName) != 0) {
+    w.kv("mem_slot", st.memSlot).kv("mem_name", st.memName);
+  }
+  if (!prev && netMode && ip) w.kv("net_mode", netMode).kv("ip", ip);
+  w.endObject();
+  if (w.overflow() || w.length() <= 2) return 0;
+  return w.length();
+}
+
+// ===== Bänder =====
+static const char *bandGroup(const BandDesc &d) {
+  if (d.flags & BF_MAIN)            return "main";
+  if (d.flags & BF_SW_BCAST)        return "bc";
+  if (d.flags & (BF_HAM | BF_CB))   return "ham";
+  return "other";
+}
+
+static const char *bandRaster(const BandDesc &d) {
+  if (d.flags & BF_BCAST_MW) return "region";
+  if (d.flags & BF_CB)       return "grid";
+  return "free";
+}
+
+size_t apiBandsJson(char *out, size_t outsz) {
+  static const char *const typeNames[] = { "fm", "mw", "sw", "lw" };
+  JsonWriter w(out, outsz);
+  w.beginObject().kv("total", BAND_COUNT).beginArray("items");
+  for (int i = 0; i < BAND_COUNT; i++) {
+    const BandDesc &d = bandDesc[i];
+    w.beginObject()
+     .kv("idx", i).kv("name", d.name).kv("type", typeNames[d.type & 3]).kv("group", bandGroup(d))
+     .kv("mode", modeToStr(d.defaultMode)).kv("min", (unsigned) d.minimumFreq).kv("max", (unsigned) d.maximumFreq)
+     .kv("raster", bandRaster(d));
+    if (d.gridSpacing) w.kv("grid_base", (unsigned) d.gridBase).kv("grid_khz", (unsigned) d.gridSpacing);
+    w.endObject();
+  }
+  w.endArray().endObject();
+  return w.overflow() ? 0 : w.length();
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "RadioTask.h"
+#include "Bands.h"
+
+// ===== API-JSON =====
+// Serialisierung von /api/status (samt SSE-Deltas) und /api/bands ohne
+// Netzwerk- und Serverbezug, damit dieselben Funktionen auf dem Host gemessen
+// werden können. Die Netzwerkfelder liefert der Aufrufer als fertige Texte.
+
+static inline const char* modeToStr(uint8_t m) {
+  switch (m) {
+    case 0: return "FM";
+    case 1: return "LSB";
+    case 2: return "USB";
+    case 3: return "AM";
+    default: return "UNK";
+  }
+}
+
+// Anzeigetext der Frequenz; LSB/USB mit 10-Hz-Auflösung (BFO-Feinabstimmung)
+void formatSnapshotFreq(char *out, size_t outsz, const RadioSnapshot &st);
+
+// Status-JSON. Bei prev == NULL werden alle Felder geschrieben (netMode/ip nur,
+// wenn nicht NULL), sonst nur die gegenüber prev geänderten. 0 = nichts geändert
+// oder Puffer zu klein.
+size_t apiStatusJson(char *out, size_t outsz, const RadioSnapshot &st, const RadioSnapshot *prev,
+                     const char *netMode, const char *ip);
+
+// Bandliste mit Metadaten (Gruppe, Raster), nach denen die Web-Oberfläche sortiert
+size_t apiBandsJson(char *out, size_t outsz);
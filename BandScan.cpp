@@ -0,0 +1,4 @@
+#include "BandScan.h"
+
+// Ergebnispuffer: schreibt nur der Radio-Task, gelesen bis scan.count
+ScanShared scan;
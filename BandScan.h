@@ -0,0 +1,37 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// ===== Band-Scan =====
+// Der Radio-Task fährt ein Band (oder einen Ausschnitt) Kanal für Kanal ab und
+// schreibt pro Kanal einen Datensatz fester Breite. Der Web-Task streamt die
+// Datensätze, während der Scan noch läuft.
+
+#define SCAN_MAX_POINTS     4096
+#define SCAN_SETTLE_DEFAULT 30    // ms nach dem Abstimmen bis zur Messung
+#define SCAN_SETTLE_MIN     5
+#define SCAN_SETTLE_MAX     500
+
+// Ein Kanal, 4 Bytes little endian: Frequenz (kHz bzw. 10 kHz bei FM), RSSI (dBµV), SNR (dB)
+typedef struct __attribute__((packed)) {
+  uint16_t freq;
+  uint8_t  rssi;
+  uint8_t  snr;
+} ScanRecord;
+
+typedef struct {
+  uint8_t  bandIdx;
+  uint16_t minF, maxF;  // 0 = Bandgrenze
+  uint16_t step;        // 0 = Schrittweite/Raster des Bandes
+  uint16_t settleMs;
+} ScanRequest;
+
+typedef struct {
+  ScanRequest req;                     // vom Web-Task vor RCMD_SCAN_START gesetzt
+  ScanRecord  rec[SCAN_MAX_POINTS];
+  std::atomic<uint32_t> generation{0}; // wird beim Start jedes Scans erhöht
+  std::atomic<uint16_t> count{0};      // fertige Datensätze des aktuellen Scans
+  std::atomic<bool>     running{false};
+} ScanShared;
+
+extern ScanShared scan;
@@ -0,0 +1,154 @@
+#include "Bands.h"
+
+// ===== Bandtabelle =====
+constexpr BandDesc bandDesc[] = {
+  // name     type          flags                  mode          grid base    min    max    def  step bw
+  {"FM ",  FM_BAND_TYPE, BF_MAIN,               BAND_MODE_FM,  0,     0,  8750, 10800, 10130, 1, 0},
+
+  {"LW ",  LW_BAND_TYPE, BF_MAIN,               BAND_MODE_AM,  0,     0,   153,   279,   198, 3, 4},
+  {"MW-EU",MW_BAND_TYPE, BF_MAIN | BF_BCAST_MW, BAND_MODE_AM,  0,     0,   531,  1602,   999, 2, 4},
+  {"MW-NA",MW_BAND_TYPE, BF_MAIN | BF_BCAST_MW, BAND_MODE_AM,  0,     0,   530,  1700,  1000, 3, 4},
+
+  // Amateur
+  {"630M", MW_BAND_TYPE, BF_HAM,                BAND_MODE_AM,  0,     0,   472,   479,   475, 0, 4},
+  {"160M", MW_BAND_TYPE, BF_HAM,                BAND_MODE_AM,  0,     0,  1800,  2000,  1840, 0, 4},
+  {"80M",  MW_BAND_TYPE, BF_HAM,                BAND_MODE_AM,  0,     0,  3500,  4000,  3700, 0, 4},
+  {"60M",  SW_BAND_TYPE, BF_HAM,                BAND_MODE_AM,  0,     0,  5351,  5367,  5363, 0, 4},
+  {"40M",  SW_BAND_TYPE, BF_HAM,                BAND_MODE_AM,  0,     0,  7000,  7300,  7100, 0, 4},
+  {"30M",  SW_BAND_TYPE, BF_HAM,                BAND_MODE_AM,  0,     0, 10100, 10150, 10120, 0, 4},
+  {"20M",  SW_BAND_TYPE, BF_HAM,                BAND_MODE_AM,  0,     0, 14000, 14350, 14200, 0, 4},
+  {"17M",  SW_BAND_TYPE, BF_HAM,                BAND_MODE_AM,  0,     0, 18068, 18168, 18100, 0, 4},
+  {"15M",  SW_BAND_TYPE, BF_HAM,                BAND_MODE_AM,  0,     0, 21000, 21450, 21100, 0, 4},
+  {"12M",  SW_BAND_TYPE, BF_HAM,                BAND_MODE_AM,  0,     0, 24890, 24990, 24940, 0, 4},
+  {"10M",  SW_BAND_TYPE, BF_HAM,                BAND_MODE_AM,  0,     0, 28000, 29700, 28400, 0, 4},
+
+  // CB
+  {"CB ",  SW_BAND_TYPE, BF_CB,                 BAND_MODE_AM, 10, 26965, 26965, 27405, 27285, 3, 4},
+  {"CB-DE",SW_BAND_TYPE, BF_CB,                 BAND_MODE_AM, 10, 26565, 26565, 27405, 27285, 3, 4},
+
+  // SW Broadcast
+  {"120m", SW_BAND_TYPE, BF_SW_BCAST,           BAND_MODE_AM,  0,     0,  2300,  2495,  2400, 1, 4},
+  {"90m",  SW_BAND_TYPE, BF_SW_BCAST,           BAND_MODE_AM,  0,     0,  3200,  3400,  3300, 1, 4},
+  {"75m",  SW_BAND_TYPE, BF_SW_BCAST,           BAND_MODE_AM,  0,     0,  3900,  4000,  3950, 1, 4},
+  {"60m",  SW_BAND_TYPE, BF_SW_BCAST,           BAND_MODE_AM,  0,     0,  4750,  5060,  4900, 1, 4},
+  {"49m",  SW_BAND_TYPE, BF_SW_BCAST,           BAND_MODE_AM,  0,     0,  5800,  6200,  6000, 1, 4},
+  {"41m",  SW_BAND_TYPE, BF_SW_BCAST,           BAND_MODE_AM,  0,     0,  7200,  7600,  7400, 1, 4},
+  {"31m",  SW_BAND_TYPE, BF_SW_BCAST,           BAND_MODE_AM,  0,     0,  9400,  9900,  9700, 1, 4},
+  {"25m",  SW_BAND_TYPE, BF_SW_BCAST,           BAND_MODE_AM,  0,     0, 11600, 12100, 11900, 1, 4},
+  {"22m",  SW_BAND_TYPE, BF_SW_BCAST,           BAND_MODE_AM,  0,     0, 13570, 13870, 13700, 1, 4},
+  {"19m",  SW_BAND_TYPE, BF_SW_BCAST,           BAND_MODE_AM,  0,     0, 15100, 15800, 15300, 1, 4},
+  {"16m",  SW_BAND_TYPE, BF_SW_BCAST,           BAND_MODE_AM,  0,     0, 17480, 17900, 17600, 1, 4},
+  {"15m",  SW_BAND_TYPE, BF_SW_BCAST,           BAND_MODE_AM,  0,     0, 18900, 19020, 18950, 1, 4},
+  {"13m",  SW_BAND_TYPE, BF_SW_BCAST,           BAND_MODE_AM,  0,     0, 21450, 21850, 21600, 1, 4},
+  {"11m",  SW_BAND_TYPE, BF_SW_BCAST,           BAND_MODE_AM,  0,     0, 25670, 26100, 25800, 1, 4},
+
+  {"ALL",  SW_BAND_TYPE, BF_MAIN,               BAND_MODE_AM,  0,     0,   150, 30000, 15000, 1, 4},
+};
+
+// ===== Prüfung beim Übersetzen =====
+static constexpr size_t cstrLen(const char *s) { return *s ? 1 + cstrLen(s + 1) : 0; }
+
+static constexpr bool bandValid(const BandDesc &b) {
+  return b.name != nullptr
+      && b.minimumFreq < b.maximumFreq
+      && b.defaultFreq >= b.minimumFreq && b.defaultFreq <= b.maximumFreq
+      && cstrLen(b.name) > 0 && cstrLen(b.name) <= BAND_NAME_MAX
+      && (b.type == FM_BAND_TYPE) == (b.defaultMode == BAND_MODE_FM)
+      && b.defaultStepIdx < ((b.type == FM_BAND_TYPE) ? BAND_FM_STEPS : BAND_AM_STEPS)
+      && b.defaultBwIdx < ((b.type == FM_BAND_TYPE) ? BAND_FM_BWS : BAND_AM_BWS)
+      && (!(b.flags & BF_BCAST_MW) || b.type == MW_BAND_TYPE)
+      && ((b.flags & BF_CB) ? (b.gridSpacing > 0 && b.gridBase <= b.minimumFreq
+                               && (b.minimumFreq - b.gridBase) % b.gridSpacing == 0)
+                            : b.gridSpacing == 0)
+      && !((b.flags & BF_BCAST_MW) && (b.flags & BF_CB));
+}
+
+// Index des ersten fehlerhaften Eintrags, BAND_COUNT = alle in Ordnung
+static constexpr size_t firstInvalid(size_t i) {
+  return (i >= BAND_COUNT || !bandValid(bandDesc[i])) ? i : firstInvalid(i + 1);
+}
+
+// Ist BAND_COUNT zu groß, bleiben leere Einträge übrig und fallen hier auf;
+// zu klein ergibt schon beim Übersetzen "too many initializers".
+static_assert(firstInvalid(0) == BAND_COUNT, "Bandtabelle: Eintrag fehlerhaft");
+static_assert(bandDesc[0].type == FM_BAND_TYPE, "Band 0 muss FM sein (Startband)");
+
+// ===== Zustand =====
+BandState bandState[BAND_COUNT];
+
+// ===== Frequenzindex =====
+// Die Bandgrenzen zerlegen die Frequenzachse in Abschnitte, in denen jeweils
+// dasselbe (schmalste) Band gilt. Schlüssel: FM-Bit 16, darunter die Frequenz.
+typedef struct {
+  uint32_t start;
+  uint8_t  band;       // 0xFF = kein Band
+} BandSeg;
+
+static BandSeg segs[2 * BAND_COUNT];
+static uint8_t segCount = 0;
+
+static uint32_t bandKey(bool isFM, uint16_t f) { return ((uint32_t) isFM << 16) | f; }
+
+static uint8_t narrowestAt(uint32_t key) {
+  uint8_t best = 0xFF;
+  uint16_t bestWidth = 0;
+  for (uint8_t i = 0; i < BAND_COUNT; i++) {
+    const BandDesc &d = bandDesc[i];
+    const bool fm = (d.type == FM_BAND_TYPE);
+    if (key < bandKey(fm, d.minimumFreq) || key > bandKey(fm, d.maximumFreq)) continue;
+    const uint16_t w = d.maximumFreq - d.minimumFreq;
+    if (best == 0xFF || w < bestWidth) { best = i; bestWidth = w; }
+  }
+  return best;
+}
+
+static void buildIndex() {
+  uint32_t bounds[2 * BAND_COUNT];
+  static_assert(sizeof(bounds) / sizeof(bounds[0]) <= sizeof(segs) / sizeof(segs[0]), "höchstens ein Segment je Grenze");
+  static_assert(sizeof(bounds) / sizeof(bounds[0]) <= UINT8_MAX, "Zähler sind uint8_t");
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < BAND_COUNT; i++) {
+    const bool fm = (bandDesc[i].type == FM_BAND_TYPE);
+    bounds[n++] = bandKey(fm, bandDesc[i].minimumFreq);
+    bounds[n++] = bandKey(fm, bandDesc[i].maximumFreq) + 1;
+  }
+  // Einfügesortierung, Duplikate entfernen (einmal beim Start)
+  for (uint8_t i = 1; i < n; i++) {
+    const uint32_t v = bounds[i];
+    uint8_t j = i;
+    while (j > 0 && bounds[j - 1] > v) { bounds[j] = bounds[j - 1]; j--; }
+    bounds[j] = v;
+  }
+  segCount = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    if (i > 0 && bounds[i] == bounds[i - 1]) continue;
+    const uint8_t b = narrowestAt(bounds[i]);
+    if (segCount > 0 && segs[segCount - 1].band == b) continue;
+    segs[segCount].start = bounds[i];
+    segs[segCount].band = b;
+    segCount++;
+  }
+}
+
+void bandsBegin() {
+  for (uint8_t i = 0; i < BAND_COUNT; i++) {
+    bandState[i].currentFreq    = bandDesc[i].defaultFreq;
+    bandState[i].currentStepIdx = bandDesc[i].defaultStepIdx;
+    bandState[i].bandwidthIdx   = bandDesc[i].defaultBwIdx;
+  }
+  buildIndex();
+}
+
+int bandFind(bool isFM, uint16_t f) {
+  const uint32_t key = bandKey(isFM, f);
+  // Letzter Abschnitt mit start <= key
+  uint8_t lo = 0, hi = segCount;
+  while (lo < hi) {
+    const uint8_t mid = (lo + hi) / 2;
+    if (segs[mid].start <= key) lo = mid + 1;
+    else hi = mid;
+  }
+  if (lo == 0) return -1;
+  const uint8_t b = segs[lo - 1].band;
+  return (b == 0xFF) ? -1 : b;
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// ===== Bänder =====
+// Die Beschreibung der Bänder ist eine konstante Tabelle im Flash (Bands.cpp),
+// deren Einträge beim Übersetzen per static_assert geprüft werden. Eigenschaften
+// wie MW-Rundfunk oder CB-Raster stehen als Flags in der Tabelle statt aus dem
+// Namen abgeleitet zu werden. Der veränderliche Zustand je Band (Frequenz,
+// Schritt, Bandbreite) liegt getrennt in bandState[].
+
+// Bandtypen wie in SI4735.h
+#define FM_BAND_TYPE 0
+#define MW_BAND_TYPE 1
+#define SW_BAND_TYPE 2
+#define LW_BAND_TYPE 3
+
+// Modi wie FM/LSB/USB/AM in der .ino
+#define BAND_MODE_FM  0
+#define BAND_MODE_LSB 1
+#define BAND_MODE_USB 2
+#define BAND_MODE_AM  3
+
+#define BAND_COUNT     32
+#define BAND_NAME_MAX  5      // Platz rechts in der OLED-Kopfzeile
+
+// Tabellengrößen in der .ino, dort gegengeprüft
+#define BAND_FM_STEPS  3
+#define BAND_AM_STEPS  6
+#define BAND_FM_BWS    5
+#define BAND_AM_BWS    6      // AM und SSB teilen sich den Index, SSB hat weniger Einträge
+#define BAND_AM_ONLY_BWS 7    // im Modus AM selbst
+
+enum BandFlag : uint8_t {
+  BF_MAIN     = 0x01,   // Hauptbänder (FM, LW, MW, ALL)
+  BF_BCAST_MW = 0x02,   // MW-Rundfunk: Raster der Region (9/10 kHz)
+  BF_CB       = 0x04,   // CB-Funk: Raster gridSpacing ab gridBase
+  BF_HAM      = 0x08,   // Amateurfunk
+  BF_SW_BCAST = 0x10,   // KW-Rundfunk
+};
+
+typedef struct {
+  const char *name;
+  uint8_t  type;          // FM/MW/SW/LW_BAND_TYPE
+  uint8_t  flags;         // BandFlag
+  uint8_t  defaultMode;   // BAND_MODE_FM bzw. BAND_MODE_AM; SSB wählt der Benutzer
+  uint8_t  gridSpacing;   // festes Raster in kHz (nur BF_CB), sonst 0
+  uint16_t gridBase;
+  uint16_t minimumFreq, maximumFreq;
+  uint16_t defaultFreq;
+  uint8_t  defaultStepIdx, defaultBwIdx;
+} BandDesc;
+
+typedef struct {
+  uint16_t currentFreq;
+  int8_t   currentStepIdx, bandwidthIdx;
+} BandState;
+
+extern const BandDesc bandDesc[BAND_COUNT];
+// Nur vom Radio-Task verändert
+extern BandState bandState[BAND_COUNT];
+
+// Zustände auf die Vorgaben setzen und den Frequenzindex aufbauen
+void bandsBegin();
+
+// Band, das f enthält (FM: 10-kHz-Einheiten). Bei Überlappung gewinnt das
+// schmalste Band, bei gleicher Breite das erste. -1 = keines. O(log n).
+int bandFind(bool isFM, uint16_t f);
@@ -0,0 +1,60 @@
+#include "Boot.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+
+#define BOOT_BIT(st) (1u << (st))
+
+typedef struct {
+  const char *name;
+  uint16_t    deps;
+} BootStageDesc;
+
+static const BootStageDesc stages[BOOT_ST_COUNT] = {
+  { "hw",       0 },
+  { "settings", BOOT_BIT(BOOT_ST_HW) },
+  { "radio",    BOOT_BIT(BOOT_ST_HW) },
+  { "tune",     BOOT_BIT(BOOT_ST_RADIO) | BOOT_BIT(BOOT_ST_SETTINGS) },
+  { "wifi",     0 },
+  { "memories", 0 },
+  { "http",     BOOT_BIT(BOOT_ST_WIFI) | BOOT_BIT(BOOT_ST_MEMORIES) },
+  { "net",      BOOT_BIT(BOOT_ST_WIFI) },
+};
+
+static BootRecord rec[BOOT_ST_COUNT];
+static EventGroupHandle_t done = NULL;   // Bit je fertiger Stufe
+
+void bootBegin() {
+  if (!done) done = xEventGroupCreate();
+}
+
+void bootStageBegin(uint8_t st) {
+  if (st >= BOOT_ST_COUNT) return;
+  const uint32_t t0 = micros();
+  if (stages[st].deps) xEventGroupWaitBits(done, stages[st].deps, pdFALSE, pdTRUE, portMAX_DELAY);
+  rec[st].startUs = micros();
+  rec[st].waitUs  = rec[st].startUs - t0;
+  rec[st].core    = xPortGetCoreID();
+}
+
+void bootStageEnd(uint8_t st) {
+  if (st >= BOOT_ST_COUNT) return;
+  rec[st].endUs = micros();
+  xEventGroupSetBits(done, BOOT_BIT(st));
+}
+
+bool bootStageDone(uint8_t st) {
+  return st < BOOT_ST_COUNT && done && (xEventGroupGetBits(done) & BOOT_BIT(st));
+}
+
+const char *bootStageName(uint8_t st) {
+  return (st < BOOT_ST_COUNT) ? stages[st].name : "?";
+}
+
+uint16_t bootStageDeps(uint8_t st) {
+  return (st < BOOT_ST_COUNT) ? stages[st].deps : 0;
+}
+
+void bootRecord(uint8_t st, BootRecord &out) {
+  if (st < BOOT_ST_COUNT) out = rec[st];
+  else memset(&out, 0, sizeof(out));
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <Arduino.h>
+
+// ===== Bootablauf =====
+// setup() ist in Stufen mit erklärten Abhängigkeiten zerlegt. Das Radio (im
+// Radio-Task) und WLAN/Webserver (im Arduino-Task) laufen nebeneinander an;
+// bootStageBegin() wartet über eine EventGroup, bis alle Vorgänger fertig sind.
+// Start, Ende und Wartezeit jeder Stufe bleiben für /api/boot erhalten.
+
+enum BootStage : uint8_t {
+  BOOT_ST_HW = 0,      // Pins, I2C, OLED, Taster
+  BOOT_ST_SETTINGS,    // Einstellungen aus dem Log, ggf. Reset per Taster
+  BOOT_ST_RADIO,       // Referenztakt, SI4735-Reset und Power-up
+  BOOT_ST_TUNE,        // letzter Stand angewandt und veröffentlicht: Audio läuft
+  BOOT_ST_WIFI,        // WLAN-Stack gestartet, STA verbindet im Hintergrund
+  BOOT_ST_MEMORIES,    // Speicherkanäle (LittleFS) indiziert
+  BOOT_ST_HTTP,        // Webserver nimmt Verbindungen an
+  BOOT_ST_NET,         // STA hat eine IP oder der AP-Fallback läuft
+  BOOT_ST_COUNT
+};
+
+typedef struct {
+  uint32_t startUs, endUs;   // micros() seit dem Start; endUs 0 = noch nicht fertig
+  uint32_t waitUs;           // vor dem Start auf Vorgänger gewartet
+  uint8_t  core;
+} BootRecord;
+
+// Als Erstes in setup()
+void bootBegin();
+// Wartet auf die Vorgänger von st und hält den Start fest
+void bootStageBegin(uint8_t st);
+void bootStageEnd(uint8_t st);
+bool bootStageDone(uint8_t st);
+
+// Für /api/boot; Datensätze werden ohne Lock gelesen (einzelne 32-Bit-Felder)
+const char *bootStageName(uint8_t st);
+uint16_t    bootStageDeps(uint8_t st);   // Bitmaske der Vorgänger
+void        bootRecord(uint8_t st, BootRecord &out);
@@ -0,0 +1,110 @@
+#include "Button.h"
+#include "RadioTask.h"
+
+// ===== Zustand =====
+enum {
+  ST_IDLE = 0,
+  ST_DOWN,       // erster Druck
+  ST_UP_WAIT,    // losgelassen, wartet auf zweiten Druck
+  ST_DOWN2,      // zweiter Druck (Doppelklick)
+  ST_HELD,       // lang gedrückt oder gedreht, Loslassen ohne Klick
+};
+
+static uint8_t  btnPin = 0;
+static SpscQueue<ButtonEvent, BTN_QUEUE_LEN> queue;
+static std::atomic<uint32_t> pressEdges{0};   // von der ISR gezählte Druck-Flanken
+
+static uint8_t  state = ST_IDLE;
+static bool     rawDown = false;    // zuletzt gelesener Pegel
+static bool     down = false;       // entprellter Pegel
+static bool     doubleEnabled = true;
+static uint32_t rawChangedAt = 0;
+static uint32_t pressedAt = 0;
+static uint32_t releasedAt = 0;
+static uint32_t seenEdges = 0;
+
+static void IRAM_ATTR buttonIsr() {
+  if (digitalRead(btnPin) == LOW) pressEdges.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void emit(uint8_t type, int16_t arg = 0) {
+  ButtonEvent ev;
+  ev.type = type;
+  ev.arg = arg;
+  queue.push(ev);   // volle Queue: Geste verwerfen
+}
+
+static void onPress(uint32_t now) {
+  if (state == ST_UP_WAIT) state = ST_DOWN2;
+  else                     state = ST_DOWN;
+  pressedAt = now;
+}
+
+static void onRelease(uint32_t now) {
+  switch (state) {
+    case ST_DOWN:
+      if (doubleEnabled) { state = ST_UP_WAIT; releasedAt = now; }
+      else               { emit(BTN_CLICK); state = ST_IDLE; }
+      break;
+    case ST_DOWN2:
+      emit(BTN_DOUBLE);
+      state = ST_IDLE;
+      break;
+    default:
+      state = ST_IDLE;
+      break;
+  }
+}
+
+// ===== API =====
+void buttonBegin(uint8_t pin) {
+  btnPin = pin;
+  pinMode(pin, INPUT_PULLUP);
+  rawDown = down = (digitalRead(pin) == LOW);
+  // Beim Start gedrückt (Reset-Taste im Setup): erst nach dem Loslassen auswerten
+  state = down ? ST_HELD : ST_IDLE;
+  attachInterrupt(digitalPinToInterrupt(pin), buttonIsr, FALLING);
+}
+
+void buttonSetDoubleClick(bool enabled) {
+  doubleEnabled = enabled;
+}
+
+void buttonService() {
+  const uint32_t now = millis();
+  const bool level = (digitalRead(btnPin) == LOW);
+  if (level != rawDown) { rawDown = level; rawChangedAt = now; }
+
+  const uint32_t edges = pressEdges.load(std::memory_order_relaxed);
+  if (rawDown != down && (now - rawChangedAt) >= BTN_DEBOUNCE_MS) {
+    // Prell-Flanken gehören zu diesem Wechsel und sind damit verbraucht
+    down = rawDown;
+    seenEdges = edges;
+    if (down) onPress(now);
+    else      onRelease(now);
+  } else if (!down && !rawDown && edges != seenEdges && (now - rawChangedAt) >= BTN_DEBOUNCE_MS) {
+    // Kompletter Druck, während der Task blockiert war: nur die ISR hat ihn gesehen
+    seenEdges = edges;
+    onPress(now);
+    onRelease(now);
+  }
+
+  if (state == ST_DOWN && (now - pressedAt) >= BTN_LONG_MS) {
+    emit(BTN_LONG);
+    state = ST_HELD;
+  } else if (state == ST_UP_WAIT && (now - releasedAt) >= BTN_DOUBLE_MS) {
+    emit(BTN_CLICK);
+    state = ST_IDLE;
+  }
+}
+
+bool buttonTurn(int32_t detents) {
+  if (!down || detents == 0) return false;
+  if (state == ST_DOWN || state == ST_DOWN2) state = ST_HELD;
+  emit(BTN_PRESS_TURN, (int16_t) constrain(detents, -32768, 32767));
+  return true;
+}
+
+bool buttonPoll(ButtonEvent &ev) {
+  return queue.pop(ev);
+}
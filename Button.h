@@ -0,0 +1,34 @@
+#pragma once
+#include <Arduino.h>
+
+// ===== Taster-Gesten =====
+// Entprellung und Gestenerkennung ohne delay(): Die ISR merkt sich nur
+// Druck-Flanken, buttonService() wertet Pegel und Zeiten im Radio-Task aus
+// und legt erkannte Gesten in eine kleine Event-Queue.
+
+#define BTN_DEBOUNCE_MS  25
+#define BTN_DOUBLE_MS    350   // max. Pause zwischen zwei Klicks eines Doppelklicks
+#define BTN_LONG_MS      700
+#define BTN_QUEUE_LEN    8     // Zweierpotenz
+
+enum ButtonEventType : uint8_t {
+  BTN_NONE = 0,
+  BTN_CLICK,
+  BTN_DOUBLE,
+  BTN_LONG,        // einmal, sobald BTN_LONG_MS erreicht sind (Taster noch gedrückt)
+  BTN_PRESS_TURN,  // Drehen bei gedrücktem Taster, arg = Rastungen
+};
+
+typedef struct {
+  uint8_t type;
+  int16_t arg;
+} ButtonEvent;
+
+void buttonBegin(uint8_t pin);
+// Zustandsmaschine weiterschalten (jede Runde im Radio-Task)
+void buttonService();
+// Ohne Doppelklick wird ein Klick sofort beim Loslassen gemeldet (z. B. im Menü)
+void buttonSetDoubleClick(bool enabled);
+// Encoder-Rastungen melden; bei gedrücktem Taster wird daraus BTN_PRESS_TURN
+bool buttonTurn(int32_t detents);
+bool buttonPoll(ButtonEvent &ev);
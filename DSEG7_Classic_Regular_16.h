@@ -1,199 +1,199 @@
-// Created by http://oleddisplay.squix.ch/ Consider a donation
-// In case of problems make sure that you are using the font file with the correct version!
-const uint8_t DSEG7_Classic_Regular_16Bitmaps[] PROGMEM = {
-
-	// Bitmap Data:
-	0x00, // ' '
-	0x00, // '!'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '"'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '#'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '$'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '%'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '&'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '''
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '('
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // ')'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '*'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '+'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // ','
-	0x7F,0x1F,0xC0, // '-'
-	0xD8, // '.'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '/'
-	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08,0x00,0x00,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x0B,0xFE, // '0'
-	0xAA,0xA0,0xAA,0xA0, // '1'
-	0xFF,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x09,0xFC,0x7F,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x03,0xFE, // '2'
-	0xFF,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x09,0xFC,0x7F,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x0B,0xFE, // '3'
-	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x27,0xF1,0xFC,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x20, // '4'
-	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x0B,0xFE, // '5'
-	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x0B,0xFE, // '6'
-	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08,0x00,0x00,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x08, // '7'
-	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x0B,0xFE, // '8'
-	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x0B,0xFE, // '9'
-	0xD0,0x00,0x06, // ':'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // ';'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '<'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '='
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '>'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '?'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '@'
-	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08, // 'A'
-	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'B'
-	0x7F,0x1F,0xC8,0x02,0x00,0x80,0x20,0x08,0x02,0x00,0xFF,0x80, // 'C'
-	0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x27,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'D'
-	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x03,0xFE, // 'E'
-	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x00, // 'F'
-	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x00,0x00,0x00,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x0B,0xFE, // 'G'
-	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x20, // 'H'
-	0x2A,0xA8, // 'I'
-	0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x00,0x00,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'J'
-	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08, // 'K'
-	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x00,0x00,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x0F,0xF8, // 'L'
-	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08,0x00,0x00,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08, // 'M'
-	0x7F,0x1F,0xC8,0x0A,0x02,0x80,0xA0,0x28,0x0A,0x02, // 'N'
-	0x7F,0x1F,0xC8,0x0A,0x02,0x80,0xA0,0x28,0x0A,0x02,0xFF,0x80, // 'O'
-	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x00, // 'P'
-	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x08, // 'Q'
-	0x7F,0x1F,0xC8,0x02,0x00,0x80,0x20,0x08,0x02,0x00, // 'R'
-	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x2F,0xF8, // 'S'
-	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x0F,0xF8, // 'T'
-	0x00,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x0B,0xFE, // 'U'
-	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x20,0x00,0x00,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'V'
-	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x27,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'W'
-	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x27,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x20, // 'X'
-	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x27,0xF1,0xFC,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x2F,0xF8, // 'Y'
-	0xFF,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x00,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x03,0xFE, // 'Z'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '['
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '\'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // ']'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '^'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '_'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '`'
-	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08, // 'a'
-	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'b'
-	0x7F,0x1F,0xC8,0x02,0x00,0x80,0x20,0x08,0x02,0x00,0xFF,0x80, // 'c'
-	0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x27,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'd'
-	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x03,0xFE, // 'e'
-	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x00, // 'f'
-	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x00,0x00,0x00,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x0B,0xFE, // 'g'
-	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x20, // 'h'
-	0x2A,0xA8, // 'i'
-	0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x00,0x00,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'j'
-	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08, // 'k'
-	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x00,0x00,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x0F,0xF8, // 'l'
-	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08,0x00,0x00,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08, // 'm'
-	0x7F,0x1F,0xC8,0x0A,0x02,0x80,0xA0,0x28,0x0A,0x02, // 'n'
-	0x7F,0x1F,0xC8,0x0A,0x02,0x80,0xA0,0x28,0x0A,0x02,0xFF,0x80, // 'o'
-	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x00, // 'p'
-	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x08, // 'q'
-	0x7F,0x1F,0xC8,0x02,0x00,0x80,0x20,0x08,0x02,0x00, // 'r'
-	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x2F,0xF8, // 's'
-	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x0F,0xF8, // 't'
-	0x00,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x0B,0xFE, // 'u'
-	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x20,0x00,0x00,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'v'
-	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x27,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'w'
-	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x27,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x20, // 'x'
-	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x27,0xF1,0xFC,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x2F,0xF8, // 'y'
-	0xFF,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x00,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x03,0xFE, // 'z'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '{'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '|'
-	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80 // '}'
-};
-const GFXglyph DSEG7_Classic_Regular_16Glyphs[] PROGMEM = {
-// bitmapOffset, width, height, xAdvance, xOffset, yOffset
-	  {     0,   1,   1,   4,    0,    0 }, // ' '
-	  {     1,   1,   1,  14,    0,    0 }, // '!'
-	  {     2,   6,  11,   7,    1,  -11 }, // '"'
-	  {    11,   6,  11,   7,    1,  -11 }, // '#'
-	  {    20,   6,  11,   7,    1,  -11 }, // '$'
-	  {    29,   6,  11,   7,    1,  -11 }, // '%'
-	  {    38,   6,  11,   7,    1,  -11 }, // '&'
-	  {    47,   6,  11,   7,    1,  -11 }, // '''
-	  {    56,   6,  11,   7,    1,  -11 }, // '('
-	  {    65,   6,  11,   7,    1,  -11 }, // ')'
-	  {    74,   6,  11,   7,    1,  -11 }, // '*'
-	  {    83,   6,  11,   7,    1,  -11 }, // '+'
-	  {    92,   6,  11,   7,    1,  -11 }, // ','
-	  {   101,  10,   2,  14,    2,   -9 }, // '-'
-	  {   104,   3,   2,   1,   -1,   -2 }, // '.'
-	  {   105,   6,  11,   7,    1,  -11 }, // '/'
-	  {   114,  10,  16,  14,    2,  -16 }, // '0'
-	  {   134,   2,  14,  14,   10,  -15 }, // '1'
-	  {   138,  10,  16,  14,    2,  -16 }, // '2'
-	  {   158,  10,  16,  14,    2,  -16 }, // '3'
-	  {   178,  10,  14,  14,    2,  -15 }, // '4'
-	  {   196,  10,  16,  14,    2,  -16 }, // '5'
-	  {   216,  10,  16,  14,    2,  -16 }, // '6'
-	  {   236,  10,  15,  14,    2,  -16 }, // '7'
-	  {   255,  10,  16,  14,    2,  -16 }, // '8'
-	  {   275,  10,  16,  14,    2,  -16 }, // '9'
-	  {   295,   3,   8,   4,    1,  -12 }, // ':'
-	  {   298,   6,  11,   7,    1,  -11 }, // ';'
-	  {   307,   6,  11,   7,    1,  -11 }, // '<'
-	  {   316,   6,  11,   7,    1,  -11 }, // '='
-	  {   325,   6,  11,   7,    1,  -11 }, // '>'
-	  {   334,   6,  11,   7,    1,  -11 }, // '?'
-	  {   343,   6,  11,   7,    1,  -11 }, // '@'
-	  {   352,  10,  15,  14,    2,  -16 }, // 'A'
-	  {   371,  10,  15,  14,    2,  -15 }, // 'B'
-	  {   390,  10,   9,  14,    2,   -9 }, // 'C'
-	  {   402,  10,  15,  14,    2,  -15 }, // 'D'
-	  {   421,  10,  16,  14,    2,  -16 }, // 'E'
-	  {   441,  10,  15,  14,    2,  -16 }, // 'F'
-	  {   460,  10,  16,  14,    2,  -16 }, // 'G'
-	  {   480,  10,  14,  14,    2,  -15 }, // 'H'
-	  {   498,   2,   7,  14,   10,   -8 }, // 'I'
-	  {   500,  10,  15,  14,    2,  -15 }, // 'J'
-	  {   519,  10,  15,  14,    2,  -16 }, // 'K'
-	  {   538,  10,  15,  14,    2,  -15 }, // 'L'
-	  {   557,  10,  15,  14,    2,  -16 }, // 'M'
-	  {   576,  10,   8,  14,    2,   -9 }, // 'N'
-	  {   586,  10,   9,  14,    2,   -9 }, // 'O'
-	  {   598,  10,  15,  14,    2,  -16 }, // 'P'
-	  {   617,  10,  15,  14,    2,  -16 }, // 'Q'
-	  {   636,  10,   8,  14,    2,   -9 }, // 'R'
-	  {   646,  10,  15,  14,    2,  -15 }, // 'S'
-	  {   665,  10,  15,  14,    2,  -15 }, // 'T'
-	  {   684,  10,   8,  14,    2,   -8 }, // 'U'
-	  {   694,  10,  15,  14,    2,  -15 }, // 'V'
-	  {   713,  10,  15,  14,    2,  -15 }, // 'W'
-	  {   732,  10,  14,  14,    2,  -15 }, // 'X'
-	  {   750,  10,  15,  14,    2,  -15 }, // 'Y'
-	  {   769,  10,  16,  14,    2,  -16 }, // 'Z'
-	  {   789,   6,  11,   7,    1,  -11 }, // '['
-	  {   798,   6,  11,   7,    1,  -11 }, // '\'
-	  {   807,   6,  11,   7,    1,  -11 }, // ']'
-	  {   816,   6,  11,   7,    1,  -11 }, // '^'
-	  {   825,   6,  11,   7,    1,  -11 }, // '_'
-	  {   834,   6,  11,   7,    1,  -11 }, // '`'
-	  {   843,  10,  15,  14,    2,  -16 }, // 'a'
-	  {   862,  10,  15,  14,    2,  -15 }, // 'b'
-	  {   881,  10,   9,  14,    2,   -9 }, // 'c'
-	  {   893,  10,  15,  14,    2,  -15 }, // 'd'
-	  {   912,  10,  16,  14,    2,  -16 }, // 'e'
-	  {   932,  10,  15,  14,    2,  -16 }, // 'f'
-	  {   951,  10,  16,  14,    2,  -16 }, // 'g'
-	  {   971,  10,  14,  14,    2,  -15 }, // 'h'
-	  {   989,   2,   7,  14,   10,   -8 }, // 'i'
-	  {   991,  10,  15,  14,    2,  -15 }, // 'j'
-	  {  1010,  10,  15,  14,    2,  -16 }, // 'k'
-	  {  1029,  10,  15,  14,    2,  -15 }, // 'l'
-	  {  1048,  10,  15,  14,    2,  -16 }, // 'm'
-	  {  1067,  10,   8,  14,    2,   -9 }, // 'n'
-	  {  1077,  10,   9,  14,    2,   -9 }, // 'o'
-	  {  1089,  10,  15,  14,    2,  -16 }, // 'p'
-	  {  1108,  10,  15,  14,    2,  -16 }, // 'q'
-	  {  1127,  10,   8,  14,    2,   -9 }, // 'r'
-	  {  1137,  10,  15,  14,    2,  -15 }, // 's'
-	  {  1156,  10,  15,  14,    2,  -15 }, // 't'
-	  {  1175,  10,   8,  14,    2,   -8 }, // 'u'
-	  {  1185,  10,  15,  14,    2,  -15 }, // 'v'
-	  {  1204,  10,  15,  14,    2,  -15 }, // 'w'
-	  {  1223,  10,  14,  14,    2,  -15 }, // 'x'
-	  {  1241,  10,  15,  14,    2,  -15 }, // 'y'
-	  {  1260,  10,  16,  14,    2,  -16 }, // 'z'
-	  {  1280,   6,  11,   7,    1,  -11 }, // '{'
-	  {  1289,   6,  11,   7,    1,  -11 }, // '|'
-	  {  1298,   6,  11,   7,    1,  -11 } // '}'
-};
-const GFXfont DSEG7_Classic_Regular_16 PROGMEM = {
-(uint8_t  *)DSEG7_Classic_Regular_16Bitmaps,(GFXglyph *)DSEG7_Classic_Regular_16Glyphs,0x20, 0x7E, 18};
+// Created by http://oleddisplay.squix.ch/ Consider a donation
+// In case of problems make sure that you are using the font file with the correct version!
+const uint8_t DSEG7_Classic_Regular_16Bitmaps[] PROGMEM = {
+
+	// Bitmap Data:
+	0x00, // ' '
+	0x00, // '!'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '"'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '#'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '$'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '%'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '&'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '''
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '('
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // ')'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '*'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '+'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // ','
+	0x7F,0x1F,0xC0, // '-'
+	0xD8, // '.'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '/'
+	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08,0x00,0x00,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x0B,0xFE, // '0'
+	0xAA,0xA0,0xAA,0xA0, // '1'
+	0xFF,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x09,0xFC,0x7F,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x03,0xFE, // '2'
+	0xFF,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x09,0xFC,0x7F,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x0B,0xFE, // '3'
+	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x27,0xF1,0xFC,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x20, // '4'
+	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x0B,0xFE, // '5'
+	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x0B,0xFE, // '6'
+	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08,0x00,0x00,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x08, // '7'
+	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x0B,0xFE, // '8'
+	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x0B,0xFE, // '9'
+	0xD0,0x00,0x06, // ':'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // ';'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '<'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '='
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '>'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '?'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '@'
+	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08, // 'A'
+	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'B'
+	0x7F,0x1F,0xC8,0x02,0x00,0x80,0x20,0x08,0x02,0x00,0xFF,0x80, // 'C'
+	0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x27,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'D'
+	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x03,0xFE, // 'E'
+	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x00, // 'F'
+	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x00,0x00,0x00,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x0B,0xFE, // 'G'
+	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x20, // 'H'
+	0x2A,0xA8, // 'I'
+	0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x00,0x00,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'J'
+	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08, // 'K'
+	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x00,0x00,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x0F,0xF8, // 'L'
+	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08,0x00,0x00,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08, // 'M'
+	0x7F,0x1F,0xC8,0x0A,0x02,0x80,0xA0,0x28,0x0A,0x02, // 'N'
+	0x7F,0x1F,0xC8,0x0A,0x02,0x80,0xA0,0x28,0x0A,0x02,0xFF,0x80, // 'O'
+	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x00, // 'P'
+	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x08, // 'Q'
+	0x7F,0x1F,0xC8,0x02,0x00,0x80,0x20,0x08,0x02,0x00, // 'R'
+	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x2F,0xF8, // 'S'
+	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x0F,0xF8, // 'T'
+	0x00,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x0B,0xFE, // 'U'
+	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x20,0x00,0x00,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'V'
+	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x27,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'W'
+	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x27,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x20, // 'X'
+	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x27,0xF1,0xFC,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x2F,0xF8, // 'Y'
+	0xFF,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x00,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x03,0xFE, // 'Z'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '['
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '\'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // ']'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '^'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '_'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '`'
+	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08, // 'a'
+	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'b'
+	0x7F,0x1F,0xC8,0x02,0x00,0x80,0x20,0x08,0x02,0x00,0xFF,0x80, // 'c'
+	0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x27,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'd'
+	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x03,0xFE, // 'e'
+	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x00, // 'f'
+	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x00,0x00,0x00,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x0B,0xFE, // 'g'
+	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x20, // 'h'
+	0x2A,0xA8, // 'i'
+	0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x00,0x00,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'j'
+	0xFF,0xA0,0x08,0x02,0x00,0x80,0x20,0x08,0x01,0xFC,0x7F,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08, // 'k'
+	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x00,0x00,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x0F,0xF8, // 'l'
+	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08,0x00,0x00,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x08, // 'm'
+	0x7F,0x1F,0xC8,0x0A,0x02,0x80,0xA0,0x28,0x0A,0x02, // 'n'
+	0x7F,0x1F,0xC8,0x0A,0x02,0x80,0xA0,0x28,0x0A,0x02,0xFF,0x80, // 'o'
+	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x00, // 'p'
+	0xFF,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x28,0x09,0xFC,0x7F,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x08, // 'q'
+	0x7F,0x1F,0xC8,0x02,0x00,0x80,0x20,0x08,0x02,0x00, // 'r'
+	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x2F,0xF8, // 's'
+	0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x07,0xF1,0xFC,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x0F,0xF8, // 't'
+	0x00,0x20,0x28,0x0A,0x02,0x80,0xA0,0x28,0x0B,0xFE, // 'u'
+	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x20,0x00,0x00,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'v'
+	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x27,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x2F,0xF8, // 'w'
+	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x27,0xF1,0xFC,0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x20, // 'x'
+	0x80,0xA0,0x28,0x0A,0x02,0x80,0xA0,0x27,0xF1,0xFC,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x2F,0xF8, // 'y'
+	0xFF,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x00,0x00,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x03,0xFE, // 'z'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '{'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80, // '|'
+	0xFA,0x28,0xA2,0x8A,0x28,0xA2,0x8A,0x2F,0x80 // '}'
+};
+const GFXglyph DSEG7_Classic_Regular_16Glyphs[] PROGMEM = {
+// bitmapOffset, width, height, xAdvance, xOffset, yOffset
+	  {     0,   1,   1,   4,    0,    0 }, // ' '
+	  {     1,   1,   1,  14,    0,    0 }, // '!'
+	  {     2,   6,  11,   7,    1,  -11 }, // '"'
+	  {    11,   6,  11,   7,    1,  -11 }, // '#'
+	  {    20,   6,  11,   7,    1,  -11 }, // '$'
+	  {    29,   6,  11,   7,    1,  -11 }, // '%'
+	  {    38,   6,  11,   7,    1,  -11 }, // '&'
+	  {    47,   6,  11,   7,    1,  -11 }, // '''
+	  {    56,   6,  11,   7,    1,  -11 }, // '('
+	  {    65,   6,  11,   7,    1,  -11 }, // ')'
+	  {    74,   6,  11,   7,    1,  -11 }, // '*'
+	  {    83,   6,  11,   7,    1,  -11 }, // '+'
+	  {    92,   6,  11,   7,    1,  -11 }, // ','
+	  {   101,  10,   2,  14,    2,   -9 }, // '-'
+	  {   104,   3,   2,   1,   -1,   -2 }, // '.'
+	  {   105,   6,  11,   7,    1,  -11 }, // '/'
+	  {   114,  10,  16,  14,    2,  -16 }, // '0'
+	  {   134,   2,  14,  14,   10,  -15 }, // '1'
+	  {   138,  10,  16,  14,    2,  -16 }, // '2'
+	  {   158,  10,  16,  14,    2,  -16 }, // '3'
+	  {   178,  10,  14,  14,    2,  -15 }, // '4'
+	  {   196,  10,  16,  14,    2,  -16 }, // '5'
+	  {   216,  10,  16,  14,    2,  -16 }, // '6'
+	  {   236,  10,  15,  14,    2,  -16 }, // '7'
+	  {   255,  10,  16,  14,    2,  -16 }, // '8'
+	  {   275,  10,  16,  14,    2,  -16 }, // '9'
+	  {   295,   3,   8,   4,    1,  -12 }, // ':'
+	  {   298,   6,  11,   7,    1,  -11 }, // ';'
+	  {   307,   6,  11,   7,    1,  -11 }, // '<'
+	  {   316,   6,  11,   7,    1,  -11 }, // '='
+	  {   325,   6,  11,   7,    1,  -11 }, // '>'
+	  {   334,   6,  11,   7,    1,  -11 }, // '?'
+	  {   343,   6,  11,   7,    1,  -11 }, // '@'
+	  {   352,  10,  15,  14,    2,  -16 }, // 'A'
+	  {   371,  10,  15,  14,    2,  -15 }, // 'B'
+	  {   390,  10,   9,  14,    2,   -9 }, // 'C'
+	  {   402,  10,  15,  14,    2,  -15 }, // 'D'
+	  {   421,  10,  16,  14,    2,  -16 }, // 'E'
+	  {   441,  10,  15,  14,    2,  -16 }, // 'F'
+	  {   460,  10,  16,  14,    2,  -16 }, // 'G'
+	  {   480,  10,  14,  14,    2,  -15 }, // 'H'
+	  {   498,   2,   7,  14,   10,   -8 }, // 'I'
+	  {   500,  10,  15,  14,    2,  -15 }, // 'J'
+	  {   519,  10,  15,  14,    2,  -16 }, // 'K'
+	  {   538,  10,  15,  14,    2,  -15 }, // 'L'
+	  {   557,  10,  15,  14,    2,  -16 }, // 'M'
+	  {   576,  10,   8,  14,    2,   -9 }, // 'N'
+	  {   586,  10,   9,  14,    2,   -9 }, // 'O'
+	  {   598,  10,  15,  14,    2,  -16 }, // 'P'
+	  {   617,  10,  15,  14,    2,  -16 }, // 'Q'
+	  {   636,  10,   8,  14,    2,   -9 }, // 'R'
+	  {   646,  10,  15,  14,    2,  -15 }, // 'S'
+	  {   665,  10,  15,  14,    2,  -15 }, // 'T'
+	  {   684,  10,   8,  14,    2,   -8 }, // 'U'
+	  {   694,  10,  15,  14,    2,  -15 }, // 'V'
+	  {   713,  10,  15,  14,    2,  -15 }, // 'W'
+	  {   732,  10,  14,  14,    2,  -15 }, // 'X'
+	  {   750,  10,  15,  14,    2,  -15 }, // 'Y'
+	  {   769,  10,  16,  14,    2,  -16 }, // 'Z'
+	  {   789,   6,  11,   7,    1,  -11 }, // '['
+	  {   798,   6,  11,   7,    1,  -11 }, // '\'
+	  {   807,   6,  11,   7,    1,  -11 }, // ']'
+	  {   816,   6,  11,   7,    1,  -11 }, // '^'
+	  {   825,   6,  11,   7,    1,  -11 }, // '_'
+	  {   834,   6,  11,   7,    1,  -11 }, // '`'
+	  {   843,  10,  15,  14,    2,  -16 }, // 'a'
+	  {   862,  10,  15,  14,    2,  -15 }, // 'b'
+	  {   881,  10,   9,  14,    2,   -9 }, // 'c'
+	  {   893,  10,  15,  14,    2,  -15 }, // 'd'
+	  {   912,  10,  16,  14,    2,  -16 }, // 'e'
+	  {   932,  10,  15,  14,    2,  -16 }, // 'f'
+	  {   951,  10,  16,  14,    2,  -16 }, // 'g'
+	  {   971,  10,  14,  14,    2,  -15 }, // 'h'
+	  {   989,   2,   7,  14,   10,   -8 }, // 'i'
+	  {   991,  10,  15,  14,    2,  -15 }, // 'j'
+	  {  1010,  10,  15,  14,    2,  -16 }, // 'k'
+	  {  1029,  10,  15,  14,    2,  -15 }, // 'l'
+	  {  1048,  10,  15,  14,    2,  -16 }, // 'm'
+	  {  1067,  10,   8,  14,    2,   -9 }, // 'n'
+	  {  1077,  10,   9,  14,    2,   -9 }, // 'o'
+	  {  1089,  10,  15,  14,    2,  -16 }, // 'p'
+	  {  1108,  10,  15,  14,    2,  -16 }, // 'q'
+	  {  1127,  10,   8,  14,    2,   -9 }, // 'r'
+	  {  1137,  10,  15,  14,    2,  -15 }, // 's'
+	  {  1156,  10,  15,  14,    2,  -15 }, // 't'
+	  {  1175,  10,   8,  14,    2,   -8 }, // 'u'
+	  {  1185,  10,  15,  14,    2,  -15 }, // 'v'
+	  {  1204,  10,  15,  14,    2,  -15 }, // 'w'
+	  {  1223,  10,  14,  14,    2,  -15 }, // 'x'
+	  {  1241,  10,  15,  14,    2,  -15 }, // 'y'
+	  {  1260,  10,  16,  14,    2,  -16 }, // 'z'
+	  {  1280,   6,  11,   7,    1,  -11 }, // '{'
+	  {  1289,   6,  11,   7,    1,  -11 }, // '|'
+	  {  1298,   6,  11,   7,    1,  -11 } // '}'
+};
+const GFXfont DSEG7_Classic_Regular_16 PROGMEM = {
+(uint8_t  *)DSEG7_Classic_Regular_16Bitmaps,(GFXglyph *)DSEG7_Classic_Regular_16Glyphs,0x20, 0x7E, 18};
@@ -1,1140 +1,1997 @@
-#include <Arduino.h>
-#include <Wire.h>
-#include <Adafruit_GFX.h>
-#include <Adafruit_SSD1306.h>
-#include "EEPROM.h"
-#include <SI4735.h>
-#include "DSEG7_Classic_Regular_16.h"
-#include "Rotary.h"
-#include <patch_ssb_compressed.h>
-#include "WebUI.h"
-
-// ========= SSB Patch meta =========
-const uint16_t size_content = sizeof ssb_patch_content;
-const uint16_t cmd_0x15_size = sizeof cmd_0x15;
-
-#define DEBUG_SSB 1
-
-// ========= Band types =========
-#define FM_BAND_TYPE 0
-#define MW_BAND_TYPE 1
-#define SW_BAND_TYPE 2
-#define LW_BAND_TYPE 3
-
-// ========= Pins =========
-#define RESET_PIN 12
-#define ENCODER_PIN_A 13
-#define ENCODER_PIN_B 14
-#define ENCODER_PUSH_BUTTON 27
-
-#define ESP32_I2C_SDA 21
-#define ESP32_I2C_SCL 22
-
-// ========= Ref clock out =========
-#define PIN_RCLK_OUT 25
-#define LEDC_CH         0
-#define LEDC_TIMERBIT   11
-#define REFCLK_HZ       32768.0
-#define REFCLK_TRIM_HZ  (0)
-
-// ========= Timings =========
-#define MIN_ELAPSED_TIME 300
-#define MIN_ELAPSED_RSSI_TIME 200
-#define ELAPSED_COMMAND 2000
-#define ELAPSED_CLICK 1500
-
-// ========= Defaults =========
-#define DEFAULT_VOLUME 35
-
-// ========= Modes =========
-#define FM  0
-#define LSB 1
-#define USB 2
-#define AM  3
-#define LW  4
-
-// ========= EEPROM =========
-#define EEPROM_SIZE 512
-#define STORE_TIME 10000
-
-const uint8_t app_id = 56;
-const int eeprom_address = 0;
-long storeTime = millis();
-bool itIsTimeToSave = false;
-
-// ========= State =========
-bool bfoOn = false;
-bool ssbLoaded = false;
-
-int8_t agcIdx = 0;
-uint8_t disableAgc = 0;
-int8_t agcNdx = 0;
-int8_t softMuteMaxAttIdx = 24;
-
-uint8_t countClick = 0;
-uint8_t seekDirection = 1;
-
-bool cmdBand = false;
-bool cmdVolume = false;
-bool cmdAgc = false;
-bool cmdBandwidth = false;
-bool cmdStep = false;
-bool cmdMode = false;
-bool cmdMenu = false;
-bool cmdSoftMuteMaxAtt = false;
-bool cmdRds = false;
-bool cmdRegion = false;
-bool cmdAntcap = false;
-
-bool oledEdit = false;
-bool fmRDS = true;
-bool antcapAuto = true;
-
-int16_t currentBFO = 0;
-long elapsedRSSI = millis();
-long elapsedButton = millis();
-long elapsedClick = millis();
-long elapsedCommand = millis();
-volatile int encoderCount = 0;
-uint16_t currentFrequency;
-
-const uint8_t currentBFOStep = 10;
-
-// ========= AM region/raster =========
-enum AMRegion : uint8_t { REGION_9KHZ = 0, REGION_10KHZ = 1 };
-uint8_t amRegion = REGION_9KHZ;
-inline uint8_t getAmSpacing() { return (amRegion == REGION_9KHZ) ? 9 : 10; }
-static uint16_t alignMwToRegion(uint16_t f, uint16_t minF, uint16_t maxF, uint8_t region) {
-  const uint8_t sp = (region == REGION_9KHZ) ? 9 : 10;
-  const int base = (region == REGION_9KHZ) ? 531 : 530;
-  long n = lround((f - base) / (double)sp);
-  long aligned = base + n * (long)sp;
-  if (aligned < minF) aligned = minF;
-  if (aligned > maxF) aligned = maxF;
-  return (uint16_t)aligned;
-}
-static uint16_t alignToGrid(uint16_t f, uint16_t base, uint8_t step, uint16_t minF, uint16_t maxF) {
-  long n = lround((f - base) / (double)step);
-  long aligned = base + n * (long)step;
-  if (aligned < minF) aligned = minF;
-  if (aligned > maxF) aligned = maxF;
-  return (uint16_t)aligned;
-}
-
-// ========= Menu =========
-const char *menu[] = { "Volume", "Step", "Mode", "BFO", "BW", "AGC/Att", "SoftMute", "Region", "Seek Up", "Seek Down", "RDS", "ANTCAP" };
-int8_t menuIdx = 0;
-const int lastMenu = 11;
-int8_t currentMenuCmd = -1;
-
-// ========= Bandwidth sets =========
-typedef struct { uint8_t idx; const char *desc; } Bandwidth;
-
-int8_t bwIdxSSB = 4;
-const int8_t maxSsbBw = 5;
-Bandwidth bandwidthSSB[] = {
-  {4, "0.5"}, {5, "1.0"}, {0, "1.2"}, {1, "2.2"}, {2, "3.0"}, {3, "4.0"}
-};
-
-int8_t bwIdxAM = 4;
-const int8_t maxAmBw = 6;
-Bandwidth bandwidthAM[] = {
-  {4, "1.0"}, {5, "1.8"}, {3, "2.0"}, {6, "2.5"}, {2, "3.0"}, {1, "4.0"}, {0, "6.0"}
-};
-
-int8_t bwIdxFM = 0;
-const int8_t maxFmBw = 4;
-Bandwidth bandwidthFM[] = {
-  {0, "AUT"}, {1, "110"}, {2, " 84"}, {3, " 60"}, {4, " 40"}
-};
-
-// ========= Steps =========
-int tabAmStep[] = {1, 5, 9, 10, 50, 100};
-const int lastAmStep = (sizeof tabAmStep / sizeof(int)) - 1;
-int idxAmStep = 3;
-
-int tabFmStep[] = {5, 10, 20};
-const int lastFmStep = (sizeof tabFmStep / sizeof(int)) - 1;
-int idxFmStep = 1;
-
-uint16_t currentStepIdx = 1;
-
-// ========= Mode desc =========
-const char *bandModeDesc[] = {"FM ", "LSB", "USB", "AM "};
-uint8_t currentMode = FM;
-
-// ========= Bands =========
-typedef struct {
-  const char *bandName; uint8_t bandType;
-  uint16_t minimumFreq, maximumFreq, currentFreq;
-  int8_t currentStepIdx, bandwidthIdx;
-} Band;
-
-Band band[] = {
-  {"FM ",  FM_BAND_TYPE,   8750, 10800, 10130, 1, 0},
-
-  {"LW ",  LW_BAND_TYPE,    153,   279,   198,  3, 4},
-  {"MW-EU",MW_BAND_TYPE,    531,  1602,   999,  2, 4},
-  {"MW-NA",MW_BAND_TYPE,    530,  1700,  1000,  3, 4},
-
-  // Amateur
-  {"630M", MW_BAND_TYPE,    472,   479,   475,  0, 4},
-  {"160M", MW_BAND_TYPE,   1800,  2000,  1840,  0, 4},
-  {"80M",  MW_BAND_TYPE,   3500,  4000,  3700,  0, 4},
-  {"60M",  SW_BAND_TYPE,   5351,  5367,  5363,  0, 4},
-  {"40M",  SW_BAND_TYPE,   7000,  7300,  7100,  0, 4},
-  {"30M",  SW_BAND_TYPE,  10100, 10150, 10120,  0, 4},
-  {"20M",  SW_BAND_TYPE,  14000, 14350, 14200,  0, 4},
-  {"17M",  SW_BAND_TYPE,  18068, 18168, 18100,  0, 4},
-  {"15M",  SW_BAND_TYPE,  21000, 21450, 21100,  0,  4},
-  {"12M",  SW_BAND_TYPE,  24890, 24990, 24940,  0,  4},
-  {"10M",  SW_BAND_TYPE,  28000, 29700, 28400,  0,  4},
-
-  // CB
-  {"CB ",    SW_BAND_TYPE, 26965, 27405, 27285, 3, 4},
-  {"CB-DE",  SW_BAND_TYPE, 26565, 27405, 27285, 3, 4},
-
-  // SW Broadcast
-  {"120m", SW_BAND_TYPE,   2300,  2495,  2400,  1, 4},
-  {"90m",  SW_BAND_TYPE,   3200,  3400,  3300,  1, 4},
-  {"75m",  SW_BAND_TYPE,   3900,  4000,  3950,  1,  4},
-  {"60m",  SW_BAND_TYPE,   4750,  5060,  4900,  1,  4},
-  {"49m",  SW_BAND_TYPE,   5800,  6200,  6000,  1,  4},
-  {"41m",  SW_BAND_TYPE,   7200,  7600,  7400,  1,  4},
-  {"31m",  SW_BAND_TYPE,   9400,  9900,  9700,  1,  4},
-  {"25m",  SW_BAND_TYPE,  11600, 12100, 11900,  1,  4},
-  {"22m",  SW_BAND_TYPE,  13570, 13870, 13700,  1,  4},
-  {"19m",  SW_BAND_TYPE,  15100, 15800, 15300,  1,  4},
-  {"16m",  SW_BAND_TYPE,  17480, 17900, 17600,  1,  4},
-  {"15m",  SW_BAND_TYPE,  18900, 19020, 18950,  1,  4},
-  {"13m",  SW_BAND_TYPE,  21450, 21850, 21600,  1,  4},
-  {"11m",  SW_BAND_TYPE,  25670, 26100, 25800,  1,  4},
-
-  {"ALL", SW_BAND_TYPE,     150, 30000, 15000,  1,  4}
-};
-
-const int lastBand = (sizeof band / sizeof(Band)) - 1;
-int bandIdx = 0;
-
-static bool isBroadcastMWBandIdx(int i) {
-  const char* n = band[i].bandName;
-  return (strcmp(n, "MW-EU") == 0 || strcmp(n, "MW-NA") == 0);
-}
-static bool isCBBandIdx(int i) {
-  const char* n = band[i].bandName;
-  return (strncmp(n, "CB", 2) == 0);
-}
-static uint8_t getSeekSpacingForCurrentBand() {
-  if (isBroadcastMWBandIdx(bandIdx)) return getAmSpacing();
-  if (isCBBandIdx(bandIdx)) return 10;
-  return 5;
-}
-
-// Alternative steps
-int tabStep[] = {1, 5, 10, 50, 100, 500, 1000};
-const int lastStep = (sizeof tabStep / sizeof(int)) - 1;
-
-// ========= STATUS =========
-uint8_t rssi = 0;
-uint8_t snr = 0;
-uint8_t volume = DEFAULT_VOLUME;
-
-// ========= HW =========
-Rotary encoder = Rotary(ENCODER_PIN_A, ENCODER_PIN_B);
-Adafruit_SSD1306 oled = Adafruit_SSD1306(128, 32, &Wire);
-SI4735 rx;
-
-// Ref clock
-double g_realRefHz = 0.0;
-
-// Helper: 0=LSB, 1=USB
-static inline uint8_t sbSelFromMode(uint8_t mode) { return (mode == USB) ? 1 : 0; }
-
-// ========== Forward decls ==========
-void saveAllReceiverInformation();
-void readAllReceiverInformation();
-void resetEepromDelay();
-void disableCommands();
-
-void oledShowFrequency();
-void oledShowBandMode();
-void oledShowRSSI();
-void oledShowFrequencyScreen();
-
-void showCommandStatus(char * currentCmd);
-void showMenu();
-void doMenu(int8_t v);
-void doCurrentMenuCmd();
-bool isMenuMode();
-void setBand(int8_t up_down);
-void useBand();
-void loadSSB();
-void doBandwidth(int8_t v);
-void doAgc(int8_t v);
-void doStep(int8_t v);
-void doMode(int8_t v);
-void doVolume(int8_t v);
-void showFrequencySeek(uint16_t freq);
-void doSeek();
-void doSoftMute(int8_t v);
-void doRegion(int8_t v);
-
-// ========== API für WebUI ==========
-int bandCount() { return lastBand + 1; }
-void setBandIndex(uint8_t newIdx) {
-  if (newIdx > lastBand) newIdx = lastBand;
-  band[bandIdx].currentFreq = currentFrequency;
-  band[bandIdx].currentStepIdx = currentStepIdx;
-  bandIdx = newIdx;
-  useBand();
-  delay(MIN_ELAPSED_TIME);
-  elapsedCommand = millis();
-}
-
-// ========= RDS =========
-static void sanitizeAscii(char* s) { if (!s) return; for (uint8_t i = 0; s[i]; i++) if ((uint8_t)s[i] < 32) s[i] = ' '; }
-
-// Top (PS)
-char rdsPSShown[9] = "";
-char rdsPSCand[9] = "";
-unsigned long rdsPSCandSince = 0;
-
-void rdsResetTop() { rdsPSShown[0] = 0; rdsPSCand[0] = 0; rdsPSCandSince = 0; }
-
-// Kurz-PS mit Limit (z. B. 8 Zeichen) für die erste OLED-Zeile
-static void rdsGetPsShortN(char* out, size_t outsz, uint8_t maxChars) {
-  if (!out || outsz == 0) return;
-  char tmp[9];
-  strncpy(tmp, rdsPSShown, sizeof(tmp));
-  tmp[sizeof(tmp)-1] = '\0';
-  if (maxChars > 8) maxChars = 8;
-  char buf[9];
-  uint8_t i=0; for (; i<maxChars && tmp[i]; i++) buf[i] = tmp[i];
-  buf[i] = '\0';
-  strncpy(out, buf, outsz);
-  out[outsz-1] = '\0';
-}
-
-void rdsTopRender(const char* txt8) {
-  if (!txt8) return;
-  char eight[9]; strncpy(eight, txt8, 8); eight[8] = '\0'; sanitizeAscii(eight);
-  if (strncmp(eight, rdsPSShown, 8) != 0) {
-    strncpy(rdsPSShown, eight, 9);
-    rdsPSShown[8] = '\0';
-    // Kopfzeile sofort aktualisieren, sofern keine Menüs aktiv sind
-    if (!isMenuMode() && !oledEdit) {
-      oledShowBandMode();
-    }
-  }
-}
-
-void rdsPollTop() {
-  if (!rx.isCurrentTuneFM()) return;
-  if (!rx.getRdsReceived()) return;
-  if (!rx.getRdsSync() || rx.getNumRdsFifoUsed() == 0) return;
-  char* ps = rx.getRdsStationName();
-  if (!ps || !ps[0]) return;
-
-  char tmp[9]; uint8_t i=0; for (; i<8 && ps[i]; i++) tmp[i]=ps[i]; tmp[i]='\0'; sanitizeAscii(tmp);
-  unsigned long now = millis();
-  if (strcmp(tmp, rdsPSCand) != 0) {
-    strncpy(rdsPSCand, tmp, 9); rdsPSCand[8]='\0'; rdsPSCandSince = now; return;
-  }
-  if (rdsPSCandSince && (now - rdsPSCandSince) >= 800UL) {
-    rdsTopRender(rdsPSCand);
-    rdsPSCandSince = 0;
-  }
-}
-
-// Bottom (RT)
-char rdsRT[65] = "";
-char rdsRTCand[65] = "";
-unsigned long rdsRTCandSince = 0;
-int rdsRTIndex = 0;
-unsigned long rdsRTNextScrollMs = 0;
-const int RT_WINDOW = 20;
-
-void rdsResetBottom() {
-  rdsRT[0]=0; rdsRTCand[0]=0; rdsRTCandSince=0; rdsRTIndex=0; rdsRTNextScrollMs=0;
-}
-void rdsBottomRenderWindow() {
-  char win[RT_WINDOW+1];
-  int len = strnlen(rdsRT, 64);
-  if (len <= RT_WINDOW) {
-    int i=0; for (; i<len; i++) win[i]=rdsRT[i]; for (; i<RT_WINDOW; i++) win[i]=' '; win[RT_WINDOW]='\0';
-  } else {
-    if (rdsRTIndex > (len - RT_WINDOW)) rdsRTIndex = 0;
-    memcpy(win, rdsRT + rdsRTIndex, RT_WINDOW);
-    win[RT_WINDOW] = '\0';
-  }
-}
-void rdsPollBottom() {
-  if (!rx.isCurrentTuneFM()) return;
-  if (!rx.getRdsReceived()) return;
-  if (!rx.getRdsSync() || rx.getNumRdsFifoUsed() == 0) return;
-  char* rt = rx.getRdsProgramInformation();
-  if (rt && rt[0]) {
-    char tmp[65]; uint8_t i=0; for (; i<64 && rt[i]; i++) tmp[i] = (rt[i] >= 32 ? rt[i] : ' '); tmp[i]='\0';
-    unsigned long now = millis();
-    if (strcmp(tmp, rdsRTCand) != 0) {
-      strncpy(rdsRTCand, tmp, 65); rdsRTCand[64]='\0'; rdsRTCandSince = now; return;
-    }
-    if (rdsRTCandSince && (now - rdsRTCandSince) >= 800UL) {
-      strncpy(rdsRT, rdsRTCand, 65); rdsRT[64]='\0';
-      rdsRTIndex = 0; rdsBottomRenderWindow(); rdsRTCandSince = 0; rdsRTNextScrollMs = now + 700UL;
-      return;
-    }
-  }
-  if (rdsRT[0]) {
-    unsigned long now = millis();
-    if (now >= rdsRTNextScrollMs) {
-      int len = strnlen(rdsRT, 64);
-      if (len > RT_WINDOW) { rdsRTIndex += 1; rdsBottomRenderWindow(); }
-      rdsRTNextScrollMs = now + 700UL;
-    }
-  }
-}
-
-// ========= ISR =========
-void IRAM_ATTR rotaryEncoder() {
-  uint8_t encoderStatus = encoder.process();
-  if (encoderStatus) encoderCount = (encoderStatus == DIR_CW) ? 1 : -1;
-}
-
-// ========= Ref clock =========
-void startRefClock() {
-  g_realRefHz = ledcSetup(LEDC_CH, REFCLK_HZ, LEDC_TIMERBIT);
-  ledcAttachPin(PIN_RCLK_OUT, LEDC_CH);
-  uint32_t duty = 1U << (LEDC_TIMERBIT - 1);
-  ledcWrite(LEDC_CH, duty);
-}
-
-// ========= OLED (normal) =========
-void oledShowFrequency() {
-  oled.fillRect(0, 8, 128, 17, SSD1306_BLACK);
-
-  char tmp[8], out[8];
-  sprintf(tmp, "%5.5u", currentFrequency);
-  out[0] = (tmp[0] == '0') ? ' ' : tmp[0];
-  out[1] = tmp[1];
-  const char* unit;
-  bool isFM = rx.isCurrentTuneFM();
-  if (isFM) {
-    out[2] = tmp[2]; out[3] = '.'; out[4] = tmp[3];
-    unit = "MHz";
-  } else {
-    if (currentFrequency < 1000) { out[1] = ' '; out[2] = tmp[2]; out[3] = tmp[3]; out[4] = tmp[4]; }
-    else { out[2] = tmp[2]; out[3] = tmp[3]; out[4] = tmp[4]; }
-    unit = "kHz";
-  }
-  out[5] = '\0';
-
-  // Frequenz groß
-  oled.setFont(&DSEG7_Classic_Regular_16);
-  oled.setCursor(20, 24);
-  oled.print(out);
-
-  // Einheit
-  oled.setFont(NULL);
-  oled.setTextSize(1);
-  if (isFM) {
-    // weiter nach rechts gerückt (vorher 64)
-    oled.setCursor(76, 15);
-    oled.print(unit);
-  } else {
-    oled.setCursor(90, 15);
-    oled.print(unit);
-  }
-
-  oled.display();
-}
-
-void oledShowBandMode() {
-  oled.fillRect(0, 0, 128, 8, SSD1306_BLACK);
-  oled.setTextSize(1);
-
-  // Mode links
-  const char* modeStr =
-    (band[bandIdx].bandType == LW_BAND_TYPE) ? "LW  " : bandModeDesc[currentMode];
-  oled.setCursor(0, 0);
-  oled.print(modeStr);
-
-  // Bei FM: Sendername (PS) direkt neben "FM " (max. 8 Zeichen)
-  if (currentMode == FM) {
-    char ps[9] = {0};
-    rdsGetPsShortN(ps, sizeof(ps), 8);
-    if (ps[0]) {
-      // „FM “ ~18 px breit im 6x8 Font; 28 px als Start ist passend
-      oled.setCursor(28, 0);
-      oled.print(ps);
-    }
-  }
-
-  // Bandname rechts wie gehabt
-  oled.setCursor(90, 0);
-  oled.print(band[bandIdx].bandName);
-
-  oled.display();
-}
-
-void oledShowRSSI() {
-  char sMeter[10];
-  sprintf(sMeter, "S:%d ", rssi);
-  oled.fillRect(0, 25, 128, 10, SSD1306_BLACK);
-  oled.setTextSize(1);
-  oled.setCursor(80, 25); oled.print(sMeter);
-  if (currentMode == FM) { oled.setCursor(0, 25); oled.print(rx.getCurrentPilot() ? "ST" : "MO"); }
-  oled.display();
-}
-
-void oledShowFrequencyScreen() {
-  oledShowBandMode();
-  oledShowFrequency();
-  oledShowRSSI();
-}
-
-// ========= UI helpers =========
-void showCommandStatus(char * currentCmd) {
-  oled.fillRect(40, 0, 50, 8, SSD1306_BLACK);
-  oled.setCursor(40, 0);
-  oled.setTextSize(1);
-  oled.print(currentCmd);
-  oled.display();
-}
-
-void showMenu() {
-  oled.clearDisplay();
-  oled.setCursor(0, 10);
-  oled.setTextSize(1);
-  oled.print(menu[menuIdx]);
-  oled.display();
-  showCommandStatus((char *) "Menu");
-}
-
-// ========= SSB patch =========
-void loadSSB() {
-  // Patch immer neu laden, wenn SSB aktiviert wird
-  rx.setI2CFastModeCustom(200000);
-  rx.queryLibraryId();
-  rx.patchPowerUp();
-  delay(50);
-  rx.downloadCompressedPatch(ssb_patch_content, size_content, cmd_0x15, cmd_0x15_size);
-  rx.setSSBConfig(bandwidthSSB[bwIdxSSB].idx, 1, 0, 1, 0, 1);
-  rx.setI2CStandardMode();
-  ssbLoaded = true;
-#if DEBUG_SSB
-  Serial.println("[SSB] Patch (re)loaded.");
-#endif
-}
-
-// ========= Band select =========
-void setBand(int8_t up_down) {
-  band[bandIdx].currentFreq = currentFrequency;
-  band[bandIdx].currentStepIdx = currentStepIdx;
-  if (up_down == 1) bandIdx = (bandIdx < lastBand) ? (bandIdx + 1) : 0;
-  else bandIdx = (bandIdx > 0) ? (bandIdx - 1) : lastBand;
-  useBand();
-  delay(MIN_ELAPSED_TIME);
-  elapsedCommand = millis();
-}
-
-void useBand() {
-  if (band[bandIdx].bandType == FM_BAND_TYPE) {
-    currentMode = FM;
-    rx.setTuneFrequencyAntennaCapacitor(0);
-    rx.setFM(band[bandIdx].minimumFreq, band[bandIdx].maximumFreq, band[bandIdx].currentFreq, tabFmStep[band[bandIdx].currentStepIdx]);
-    rx.setSeekFmLimits(band[bandIdx].minimumFreq, band[bandIdx].maximumFreq);
-    bfoOn = false;
-    ssbLoaded = false;
-    bwIdxFM = band[bandIdx].bandwidthIdx;
-    rx.setFmBandwidth(bandwidthFM[bwIdxFM].idx);
-    rx.setFmSoftMuteMaxAttenuation(softMuteMaxAttIdx);
-    rx.setRdsConfig(3, 3, 3, 3, 3);
-    rx.setFifoCount(1);
-    rdsResetTop();
-    rdsResetBottom();
-  } else {
-    rx.setTuneFrequencyAntennaCapacitor(antcapAuto ? 0 : 1);
-
-    if (currentMode == LSB || currentMode == USB) {
-      if (!ssbLoaded) loadSSB();
-      rx.setSSB(band[bandIdx].minimumFreq, band[bandIdx].maximumFreq,
-                band[bandIdx].currentFreq, tabAmStep[band[bandIdx].currentStepIdx],
-                sbSelFromMode(currentMode)); // 0=LSB, 1=USB
-      rx.setSSBAutomaticVolumeControl(1);
-      rx.setSsbSoftMuteMaxAttenuation(softMuteMaxAttIdx);
-      bwIdxSSB = band[bandIdx].bandwidthIdx;
-      rx.setSSBAudioBandwidth(bandwidthSSB[bwIdxSSB].idx);
-      rx.setSSBBfo(currentBFO);
-#if DEBUG_SSB
-      const char* m = (currentMode==LSB)?"LSB":"USB";
-      Serial.printf("[SSB] useBand->setSSB: mode=%s, f=%u kHz, step=%d, BW=%s, BFO=%d\n",
-                    m, band[bandIdx].currentFreq, tabAmStep[band[bandIdx].currentStepIdx],
-                    bandwidthSSB[bwIdxSSB].desc, (int)currentBFO);
-#endif
-    } else {
-      currentMode = AM;
-      rx.setAM(band[bandIdx].minimumFreq, band[bandIdx].maximumFreq,
-               band[bandIdx].currentFreq, tabAmStep[band[bandIdx].currentStepIdx]);
-      bfoOn = false;
-      ssbLoaded = false;
-      bwIdxAM = band[bandIdx].bandwidthIdx;
-      rx.setBandwidth(bandwidthAM[bwIdxAM].idx, 1);
-      rx.setAmSoftMuteMaxAttenuation(softMuteMaxAttIdx);
-
-      if (isBroadcastMWBandIdx(bandIdx)) {
-        uint16_t fNew = alignMwToRegion(band[bandIdx].currentFreq, band[bandIdx].minimumFreq, band[bandIdx].maximumFreq, amRegion);
-        if (fNew != band[bandIdx].currentFreq) {
-          band[bandIdx].currentFreq = fNew;
-          rx.setFrequency(fNew);
-        }
-      } else if (isCBBandIdx(bandIdx)) {
-        uint16_t base = (strcmp(band[bandIdx].bandName, "CB-DE") == 0) ? 26565 : 26965;
-        uint16_t fNew = alignToGrid(band[bandIdx].currentFreq, base, 10, band[bandIdx].minimumFreq, band[bandIdx].maximumFreq);
-        if (fNew != band[bandIdx].currentFreq) {
-          band[bandIdx].currentFreq = fNew;
-          rx.setFrequency(fNew);
-        }
-      }
-    }
-    rx.setAutomaticGainControl(disableAgc, agcNdx);
-    rx.setSeekAmLimits(band[bandIdx].minimumFreq, band[bandIdx].maximumFreq);
-    rx.setSeekAmSpacing(getSeekSpacingForCurrentBand());
-    rdsResetTop();
-    rdsResetBottom();
-  }
-
-  delay(50);
-  uint16_t fDev = rx.getFrequency();
-  band[bandIdx].currentFreq = fDev;
-  currentFrequency = fDev;
-
-  currentStepIdx = band[bandIdx].currentStepIdx;
-
-  rssi = 0;
-  oledShowFrequencyScreen();
-  showCommandStatus((char *) "Band");
-}
-
-// ========= Bandwidth/AGC/Step =========
-void doBandwidth(int8_t v) {
-  if (currentMode == LSB || currentMode == USB) {
-    bwIdxSSB = (v == 1) ? bwIdxSSB + 1 : bwIdxSSB - 1;
-    if (bwIdxSSB > maxSsbBw) bwIdxSSB = 0;
-    else if (bwIdxSSB < 0)   bwIdxSSB = maxSsbBw;
-    rx.setSSBAudioBandwidth(bandwidthSSB[bwIdxSSB].idx);
-    if (bandwidthSSB[bwIdxSSB].idx == 0 || bandwidthSSB[bwIdxSSB].idx == 4 || bandwidthSSB[bwIdxSSB].idx == 5)
-      rx.setSSBSidebandCutoffFilter(0);
-    else
-      rx.setSSBSidebandCutoffFilter(1);
-    band[bandIdx].bandwidthIdx = bwIdxSSB;
-  } else if (currentMode == AM) {
-    bwIdxAM = (v == 1) ? bwIdxAM + 1 : bwIdxAM - 1;
-    if (bwIdxAM > maxAmBw) bwIdxAM = 0;
-    else if (bwIdxAM < 0)  bwIdxAM = maxAmBw;
-    rx.setBandwidth(bandwidthAM[bwIdxAM].idx, 1);
-    band[bandIdx].bandwidthIdx = bwIdxAM;
-  } else {
-    bwIdxFM = (v == 1) ? bwIdxFM + 1 : bwIdxFM - 1;
-    if (bwIdxFM > maxFmBw) bwIdxFM = 0;
-    else if (bwIdxFM < 0)  bwIdxFM = maxFmBw;
-    rx.setFmBandwidth(bandwidthFM[bwIdxFM].idx);
-    band[bandIdx].bandwidthIdx = bwIdxFM;
-  }
-  elapsedCommand = millis();
-}
-
-void doAgc(int8_t v) {
-  agcIdx = (v == 1) ? agcIdx + 1 : agcIdx - 1;
-  if (agcIdx < 0 ) agcIdx = 35;
-  else if ( agcIdx > 35) agcIdx = 0;
-  disableAgc = (agcIdx > 0);
-  agcNdx = (agcIdx > 1) ? (agcIdx - 1) : 0;
-  rx.setAutomaticGainControl(disableAgc, agcNdx);
-  elapsedCommand = millis();
-}
-
-void doStep(int8_t v) {
-  if ( currentMode == FM ) {
-    idxFmStep = (v == 1) ? idxFmStep + 1 : idxFmStep - 1;
-    if (idxFmStep > lastFmStep) idxFmStep = 0;
-    else if (idxFmStep < 0)     idxFmStep = lastFmStep;
-    currentStepIdx = idxFmStep;
-    rx.setFrequencyStep(tabFmStep[currentStepIdx]);
-  } else {
-    idxAmStep = (v == 1) ? idxAmStep + 1 : idxAmStep - 1;
-    if (idxAmStep > lastAmStep) idxAmStep = 0;
-    else if (idxAmStep < 0)     idxAmStep = lastAmStep;
-    currentStepIdx = idxAmStep;
-    rx.setFrequencyStep(tabAmStep[currentStepIdx]);
-    rx.setSeekAmSpacing(getSeekSpacingForCurrentBand());
-  }
-  band[bandIdx].currentStepIdx = currentStepIdx;
-  elapsedCommand = millis();
-}
-
-// ========= Mode switch (AM/LSB/USB) =========
-void doMode(int8_t v) {
-  if (rx.isCurrentTuneFM()) return;
-
-  uint8_t nextMode;
-  if (v == 1) {
-    if (currentMode == AM) nextMode = LSB;
-    else if (currentMode == LSB) nextMode = USB;
-    else nextMode = AM; // USB -> AM
-  } else {
-    if (currentMode == AM) nextMode = USB;
-    else if (currentMode == USB) nextMode = LSB;
-    else nextMode = AM; // LSB -> AM
-  }
-
-  Band &b = band[bandIdx];
-  const uint16_t minF = b.minimumFreq;
-  const uint16_t maxF = b.maximumFreq;
-  const uint16_t step = tabAmStep[b.currentStepIdx];
-
-  if (nextMode == AM) {
-    rx.setAM(minF, maxF, currentFrequency, step);
-    bfoOn = false;
-    // Wichtig: Patch beim nächsten Wechsel nach SSB neu laden
-    ssbLoaded = false;
-    bwIdxAM = b.bandwidthIdx;
-    rx.setBandwidth(bandwidthAM[bwIdxAM].idx, 1);
-    rx.setAmSoftMuteMaxAttenuation(softMuteMaxAttIdx);
-
-    if (strcmp(b.bandName, "MW-EU") == 0 || strcmp(b.bandName, "MW-NA") == 0) {
-      uint16_t fNew = alignMwToRegion(currentFrequency, minF, maxF, amRegion);
-      if (fNew != currentFrequency) rx.setFrequency(fNew);
-    } else if (strncmp(b.bandName, "CB", 2) == 0) {
-      uint16_t base = (strcmp(b.bandName, "CB-DE") == 0) ? 26565 : 26965;
-      uint16_t fNew = alignToGrid(currentFrequency, base, 10, minF, maxF);
-      if (fNew != currentFrequency) rx.setFrequency(fNew);
-    }
-  } else {
-    // Beim Wechsel nach SSB Patch neu laden, falls nötig
-    if (!ssbLoaded) loadSSB();
-    rx.setSSB(minF, maxF, currentFrequency, step, sbSelFromMode(nextMode)); // 0=LSB, 1=USB
-    rx.setSSBAutomaticVolumeControl(1);
-    rx.setSsbSoftMuteMaxAttenuation(softMuteMaxAttIdx);
-    bwIdxSSB = b.bandwidthIdx;
-    rx.setSSBAudioBandwidth(bandwidthSSB[bwIdxSSB].idx);
-    rx.setSSBBfo(currentBFO);
-  }
-
-  rx.setAutomaticGainControl(disableAgc, agcNdx);
-
-  delay(50);
-  currentFrequency = rx.getFrequency();
-  b.currentFreq = currentFrequency;
-  currentMode = nextMode;
-
-#if DEBUG_SSB
-  Serial.printf("[SSB] doMode: %s, usblsb=%u, f=%u kHz, ssbLoaded=%s\n",
-                (currentMode==AM)?"AM":(currentMode==USB)?"USB":"LSB",
-                (currentMode==USB)?1:0, currentFrequency, ssbLoaded?"true":"false");
-#endif
-
-  oledShowFrequencyScreen();
-  elapsedCommand = millis();
-}
-
-// ========= Volume/Seek/SoftMute/Region/Menu =========
-void doVolume( int8_t v ) {
-  if ( v == 1) rx.volumeUp(); else rx.volumeDown();
-  elapsedCommand = millis();
-}
-
-void showFrequencySeek(uint16_t freq) {
-  currentFrequency = freq;
-  if (!oledEdit && !isMenuMode()) oledShowFrequencyScreen();
-}
-
-void doSeek() {
-  if ((currentMode == LSB || currentMode == USB)) return;
-  rx.seekStationProgress(showFrequencySeek, seekDirection);
-  currentFrequency = rx.getFrequency();
-
-  if (rx.isCurrentTuneFM()) {
-    rdsResetTop();
-    rdsResetBottom();
-  }
-}
-
-void doSoftMute(int8_t v) {
-  softMuteMaxAttIdx = (v == 1) ? softMuteMaxAttIdx + 1 : softMuteMaxAttIdx - 1;
-  if (softMuteMaxAttIdx > 32) softMuteMaxAttIdx = 0;
-  else if (softMuteMaxAttIdx < 0) softMuteMaxAttIdx = 32;
-
-  if (currentMode == FM) {
-    rx.setFmSoftMuteMaxAttenuation(softMuteMaxAttIdx);
-  } else if (currentMode == LSB || currentMode == USB) {
-    rx.setSsbSoftMuteMaxAttenuation(softMuteMaxAttIdx);
-  } else {
-    rx.setAmSoftMuteMaxAttenuation(softMuteMaxAttIdx);
-  }
-
-  elapsedCommand = millis();
-}
-
-void doRegion(int8_t v) {
-  if (v == 1 || v == -1) {
-    amRegion = (amRegion == REGION_9KHZ) ? REGION_10KHZ : REGION_9KHZ;
-  }
-  rx.setSeekAmSpacing(getSeekSpacingForCurrentBand());
-
-  if (isBroadcastMWBandIdx(bandIdx)) {
-    uint16_t fNew = alignMwToRegion(currentFrequency, band[bandIdx].minimumFreq, band[bandIdx].maximumFreq, amRegion);
-    if (fNew != currentFrequency) {
-      currentFrequency = fNew;
-      rx.setFrequency(currentFrequency);
-      oledShowFrequencyScreen();
-    }
-  }
-  if (oledEdit) {
-    oled.clearDisplay();
-    oled.setCursor(0, 0);
-    oled.setTextSize(1);
-    oled.print("Region");
-    oled.setCursor(0, 16);
-    oled.print((amRegion == REGION_9KHZ) ? "9 kHz" : "10 kHz");
-    oled.display();
-  }
-  elapsedCommand = millis();
-  resetEepromDelay();
-}
-
-// ========= Menu/Edit helpers =========
-void doMenu( int8_t v) {
-  menuIdx = (v == 1) ? menuIdx + 1 : menuIdx - 1;
-  if (menuIdx > lastMenu) menuIdx = 0;
-  else if (menuIdx < 0)   menuIdx = lastMenu;
-  showMenu();
-  delay(MIN_ELAPSED_TIME);
-  elapsedCommand = millis();
-}
-
-void enterEditScreen() { oledEdit = true; }
-void leaveEditScreen() {
-  oledEdit = false;
-  disableCommands();
-  oledShowFrequencyScreen();
-}
-
-void doCurrentMenuCmd() {
-  disableCommands();
-  switch (currentMenuCmd) {
-    case 0: cmdVolume = true; enterEditScreen(); break;
-    case 1: cmdStep   = true; enterEditScreen(); break;
-    case 2: cmdMode   = true; enterEditScreen(); break;
-    case 3: bfoOn     = true; enterEditScreen(); break;
-    case 4: cmdBandwidth = true; enterEditScreen(); break;
-    case 5: cmdAgc    = true; enterEditScreen(); break;
-    case 6: cmdSoftMuteMaxAtt = true; enterEditScreen(); break;
-    case 7: cmdRegion = true; enterEditScreen(); break;
-    case 8: seekDirection = 1; doSeek(); oledShowFrequencyScreen(); break;
-    case 9: seekDirection = 0; doSeek(); oledShowFrequencyScreen(); break;
-    case 10: cmdRds = true; enterEditScreen(); break;
-    case 11: cmdAntcap = true; enterEditScreen(); break;
-    default: break;
-  }
-  currentMenuCmd = -1;
-  elapsedCommand = millis();
-}
-
-bool isMenuMode() {
-  return (cmdMenu || cmdStep || cmdBandwidth || cmdAgc || cmdVolume || cmdSoftMuteMaxAtt || cmdMode || cmdRds || cmdRegion || cmdAntcap || bfoOn || cmdBand);
-}
-
-// ========= Setup =========
-void setup() {
-  pinMode(ENCODER_PUSH_BUTTON, INPUT_PULLUP);
-  pinMode(ENCODER_PIN_A, INPUT_PULLUP);
-  pinMode(ENCODER_PIN_B, INPUT_PULLUP);
-
-  Wire.begin(ESP32_I2C_SDA, ESP32_I2C_SCL);
-
-  oled.begin(SSD1306_SWITCHCAPVCC, 0x3C);
-  oled.clearDisplay();
-  oled.setTextColor(SSD1306_WHITE);
-
-  EEPROM.begin(EEPROM_SIZE);
-
-  if (digitalRead(ENCODER_PUSH_BUTTON) == LOW) {
-    EEPROM.write(eeprom_address, 0);
-    EEPROM.commit();
-    oled.setTextSize(2);
-    oled.setCursor(0,0); oled.print("EEPROM");
-    oled.setCursor(0,16); oled.print("RESET");
-    oled.display();
-    delay(1500);
-    oled.clearDisplay();
-  }
-
-  attachInterrupt(digitalPinToInterrupt(ENCODER_PIN_A), rotaryEncoder, CHANGE);
-  attachInterrupt(digitalPinToInterrupt(ENCODER_PIN_B), rotaryEncoder, CHANGE);
-
-  rx.setI2CFastModeCustom(100000);
-
-  startRefClock();
-
-  Serial.begin(115200);
-
-  rx.getDeviceI2CAddress(RESET_PIN);
-  rx.setRefClock((uint32_t)round(g_realRefHz + REFCLK_TRIM_HZ));
-  rx.setRefClockPrescaler(1);
-  rx.setup(RESET_PIN, 0, MW_BAND_TYPE, SI473X_ANALOG_AUDIO, XOSCEN_RCLK);
-
-  delay(250);
-
-  if (EEPROM.read(eeprom_address) == app_id) {
-    readAllReceiverInformation();
-  } else {
-    rx.setVolume(volume);
-  }
-
-  useBand();
-  oledShowFrequencyScreen();
-
-  WebUI::begin();
-}
-
-// ========= EEPROM save/load =========
-void saveAllReceiverInformation() {
-  int addr_offset;
-  EEPROM.begin(EEPROM_SIZE);
-  EEPROM.write(eeprom_address, app_id);
-  EEPROM.write(eeprom_address + 1, rx.getVolume());
-  EEPROM.write(eeprom_address + 2, bandIdx);
-  EEPROM.write(eeprom_address + 3, fmRDS);
-  EEPROM.write(eeprom_address + 4, currentMode);
-  EEPROM.write(eeprom_address + 5, currentBFO >> 8);
-  EEPROM.write(eeprom_address + 6, currentBFO & 0XFF);
-  uint8_t sm = (softMuteMaxAttIdx < 0) ? 0 : (softMuteMaxAttIdx > 32 ? 32 : (uint8_t)softMuteMaxAttIdx);
-  EEPROM.write(eeprom_address + 7, sm);
-  uint8_t agcStore = (agcIdx < 0) ? 0 : (agcIdx > 35) ? 35 : (uint8_t)agcIdx;
-  EEPROM.write(eeprom_address + 8, agcStore);
-  EEPROM.write(eeprom_address + 9, amRegion);
-  EEPROM.write(eeprom_address + 10, antcapAuto ? 1 : 0);
-
-  int addr_offset2 = 11;
-  band[bandIdx].currentFreq = currentFrequency;
-  for (int i = 0; i <= lastBand; i++) {
-    EEPROM.write(addr_offset2++, (band[i].currentFreq >> 8));
-    EEPROM.write(addr_offset2++, (band[i].currentFreq & 0xFF));
-    EEPROM.write(addr_offset2++, band[i].currentStepIdx);
-    EEPROM.write(addr_offset2++, band[i].bandwidthIdx);
-  }
-  EEPROM.commit();
-  EEPROM.end();
-}
-
-void readAllReceiverInformation() {
-  uint8_t vol; int addr_offset; int bwIdx;
-  EEPROM.begin(EEPROM_SIZE);
-
-  vol = EEPROM.read(eeprom_address + 1);
-  bandIdx = EEPROM.read(eeprom_address + 2);
-  fmRDS = EEPROM.read(eeprom_address + 3);
-  currentMode = EEPROM.read(eeprom_address + 4);
-  currentBFO = EEPROM.read(eeprom_address + 5) << 8;
-  currentBFO |= EEPROM.read(eeprom_address + 6);
-  uint8_t sm = EEPROM.read(eeprom_address + 7);
-  if (sm > 32) sm = 24;
-  softMuteMaxAttIdx = (int8_t)sm;
-  uint8_t agcLoad = EEPROM.read(eeprom_address + 8);
-  if (agcLoad > 35) agcLoad = 0;
-  agcIdx = (int8_t)agcLoad;
-  disableAgc = (agcIdx > 0);
-  agcNdx = (agcIdx > 1) ? (agcIdx - 1) : 0;
-  amRegion = EEPROM.read(eeprom_address + 9);
-  if (amRegion > REGION_10KHZ) amRegion = REGION_9KHZ;
-  uint8_t ac = EEPROM.read(eeprom_address + 10);
-  antcapAuto = (ac == 0xFF) ? true : (ac ? true : false);
-
-  addr_offset = 11;
-  for (int i = 0; i <= lastBand; i++) {
-    band[i].currentFreq = EEPROM.read(addr_offset++) << 8;
-    band[i].currentFreq |= EEPROM.read(addr_offset++);
-    band[i].currentStepIdx = EEPROM.read(addr_offset++);
-    band[i].bandwidthIdx = EEPROM.read(addr_offset++);
-  }
-
-  EEPROM.end();
-
-  currentFrequency = band[bandIdx].currentFreq;
-
-  if (band[bandIdx].bandType == FM_BAND_TYPE) {
-    currentStepIdx = idxFmStep = band[bandIdx].currentStepIdx;
-    rx.setFrequencyStep(tabFmStep[currentStepIdx]);
-  } else {
-    currentStepIdx = idxAmStep = band[bandIdx].currentStepIdx;
-    rx.setFrequencyStep(tabAmStep[currentStepIdx]);
-  }
-
-  bwIdx = band[bandIdx].bandwidthIdx;
-
-  if (currentMode == LSB || currentMode == USB) {
-    loadSSB();
-    bwIdxSSB = (bwIdx > 5) ? 5 : bwIdx;
-    rx.setSSBAudioBandwidth(bandwidthSSB[bwIdxSSB].idx);
-    if (bandwidthSSB[bwIdxSSB].idx == 0 || bandwidthSSB[bwIdxSSB].idx == 4 || bandwidthSSB[bwIdxSSB].idx == 5)
-      rx.setSSBSidebandCutoffFilter(0);
-    else
-      rx.setSSBSidebandCutoffFilter(1);
-  } else if (currentMode == AM) {
-    bwIdxAM = bwIdx;
-    rx.setBandwidth(bandwidthAM[bwIdxAM].idx, 1);
-  } else {
-    bwIdxFM = bwIdx;
-    rx.setFmBandwidth(bandwidthFM[bwIdxFM].idx);
-  }
-
-  delay(50);
-  rx.setVolume(vol);
-  rx.setSeekAmSpacing(getSeekSpacingForCurrentBand());
-}
-
-// ========= State helpers =========
-void resetEepromDelay() {
-  elapsedCommand = storeTime = millis();
-  itIsTimeToSave = true;
-}
-
-void disableCommands() {
-  cmdBand = false; bfoOn = false; cmdVolume = false; cmdAgc = false;
-  cmdBandwidth = false; cmdStep = false; cmdMode = false;
-  cmdMenu = false; cmdSoftMuteMaxAtt = false; cmdRds = false; cmdRegion = false; cmdAntcap = false; countClick = 0;
-  oledEdit = false;
-}
-
-// ========= Loop =========
-void loop() {
-  if (encoderCount != 0) {
-    if (bfoOn && (currentMode == LSB || currentMode == USB)) {
-      currentBFO = (encoderCount == 1) ? (currentBFO + currentBFOStep) : (currentBFO - currentBFOStep);
-      rx.setSSBBfo(currentBFO);
-#if DEBUG_SSB
-      Serial.printf("[SSB] BFO=%d (step=%u Hz) @ f=%u kHz\n", (int)currentBFO, (unsigned)currentBFOStep, currentFrequency);
-#endif
-      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("BFO"); oled.setCursor(0,16); oled.print(currentBFO); oled.display(); }
-    } else if (cmdMenu) {
-      doMenu(encoderCount);
-    } else if (cmdMode) {
-      doMode(encoderCount);
-      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("Mode"); oled.setCursor(0,16); oled.print((currentMode==FM)?"FM":(currentMode==AM)?"AM":(currentMode==LSB)?"LSB":"USB"); oled.display(); }
-    } else if (cmdStep) {
-      doStep(encoderCount);
-      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("Step"); oled.setCursor(0,16); oled.print((currentMode==FM)? (tabFmStep[currentStepIdx]*10) : tabAmStep[currentStepIdx]); oled.display(); }
-    } else if (cmdAgc) {
-      doAgc(encoderCount);
-      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("AGC/Att"); oled.setCursor(0,16); oled.print((disableAgc)?agcNdx:0); oled.display(); }
-    } else if (cmdBandwidth) {
-      doBandwidth(encoderCount);
-      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("BW"); oled.setCursor(0,16); oled.print((currentMode==AM)? bandwidthAM[bwIdxAM].desc : (currentMode==FM)? bandwidthFM[bwIdxFM].desc : bandwidthSSB[bwIdxSSB].desc); oled.display(); }
-    } else if (cmdVolume) {
-      doVolume(encoderCount);
-      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("Volume"); oled.setCursor(0,16); oled.print((int)rx.getVolume()); oled.display(); }
-    } else if (cmdSoftMuteMaxAtt) {
-      doSoftMute(encoderCount);
-      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("SoftMute"); oled.setCursor(0,16); oled.print(softMuteMaxAttIdx); oled.display(); }
-    } else if (cmdRegion) {
-      doRegion(encoderCount);
-    } else if (cmdRds) {
-      fmRDS = !fmRDS;
-      rdsResetTop(); rdsResetBottom();
-      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("RDS"); oled.setCursor(0,16); oled.print(fmRDS?"ON":"OFF"); oled.display(); }
-      resetEepromDelay();
-      elapsedCommand = millis();
-    } else if (cmdAntcap) {
-      antcapAuto = !antcapAuto;
-      if (!rx.isCurrentTuneFM()) {
-        rx.setTuneFrequencyAntennaCapacitor(antcapAuto ? 0 : 1);
-        rx.setFrequency(currentFrequency);
-      }
-      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("ANTCAP"); oled.setCursor(0,16); oled.print(antcapAuto?"Auto":"Hold"); oled.display(); }
-      resetEepromDelay();
-      elapsedCommand = millis();
-    } else if (cmdBand) {
-      setBand(encoderCount);
-    } else {
-      if (encoderCount == 1) rx.frequencyUp();
-      else                   rx.frequencyDown();
-      uint16_t prev = currentFrequency;
-      currentFrequency = rx.getFrequency();
-      if (rx.isCurrentTuneFM() && currentFrequency != prev) {
-        rdsResetTop();
-        rdsResetBottom();
-      }
-      if (!isMenuMode() && !oledEdit) {
-        oledShowFrequencyScreen();
-      }
-    }
-    encoderCount = 0;
-    resetEepromDelay();
-  } else {
-    if (digitalRead(ENCODER_PUSH_BUTTON) == LOW) {
-      countClick++;
-      if (cmdMenu) {
-        currentMenuCmd = menuIdx;
-        doCurrentMenuCmd();
-      } else if (countClick == 1) {
-        if (oledEdit || isMenuMode()) {
-          leaveEditScreen();
-        } else if (bfoOn) {
-          bfoOn = false;
-          oledShowFrequencyScreen();
-        } else {
-          cmdBand = !cmdBand;
-          showCommandStatus((char *)"Band");
-        }
-      } else {
-        cmdMenu = !cmdMenu;
-        if (cmdMenu) showMenu();
-        else         oledShowFrequencyScreen();
-      }
-      delay(MIN_ELAPSED_TIME);
-      elapsedCommand = millis();
-    }
-  }
-
-  if ((millis() - elapsedRSSI) > MIN_ELAPSED_RSSI_TIME * 6) {
-    rx.getCurrentReceivedSignalQuality();
-    uint8_t newRssi = rx.getCurrentRSSI();
-    uint8_t newSnr  = rx.getCurrentSNR();
-    if ((rssi != newRssi || snr != newSnr) && !isMenuMode() && !oledEdit) {
-      rssi = newRssi;
-      snr  = newSnr;
-      oledShowRSSI();
-    }
-    elapsedRSSI = millis();
-  }
-
-  if (rx.isCurrentTuneFM() && fmRDS) {
-    rx.getRdsStatus();
-    rdsPollTop();
-    rdsPollBottom();
-  }
-
-  if ((millis() - elapsedCommand) > ELAPSED_COMMAND) {
-    if (oledEdit || isMenuMode()) {
-      leaveEditScreen();
-    }
-    elapsedCommand = millis();
-  }
-
-  if ((millis() - elapsedClick) > ELAPSED_CLICK) {
-    countClick = 0;
-    elapsedClick = millis();
-  }
-
-  if (itIsTimeToSave) {
-    if ((millis() - storeTime) > STORE_TIME) {
-      saveAllReceiverInformation();
-      storeTime = millis();
-      itIsTimeToSave = false;
-    }
-  }
-
-  WebUI::loop();
-  delay(5);
-}
+#include <Arduino.h>
+#include <atomic>
+#include <Wire.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+#include "EEPROM.h"
+#include "SettingsLog.h"
+#include <SI4735.h>
+#include "DSEG7_Classic_Regular_16.h"
+#include "Rotary.h"
+#include <patch_ssb_compressed.h>
+#include "WebUI.h"
+#include "RadioTask.h"
+#include "BandScan.h"
+#include "OledFlush.h"
+#include "Memories.h"
+#include "Button.h"
+#include "Rds.h"
+#include "I2cMetrics.h"
+#include "Perf.h"
+#include "RadioLogic.h"
+#include "Bands.h"
+#include "History.h"
+#include "MemScan.h"
+#include "ModeSwitch.h"
+#include "Boot.h"
+#include "AntCap.h"
+
+// ========= SSB Patch meta =========
+const uint16_t size_content = sizeof ssb_patch_content;
+const uint16_t cmd_0x15_size = sizeof cmd_0x15;
+
+#define DEBUG_SSB 1
+
+// ========= Pins =========
+#define RESET_PIN 12
+#define ENCODER_PIN_A 13
+#define ENCODER_PIN_B 14
+#define ENCODER_PUSH_BUTTON 27
+
+#define ESP32_I2C_SDA 21
+#define ESP32_I2C_SCL 22
+
+// ========= Ref clock out =========
+#define PIN_RCLK_OUT 25
+#define LEDC_CH         0
+#define LEDC_TIMERBIT   11
+#define REFCLK_HZ       32768.0
+#define REFCLK_TRIM_HZ  (0)
+
+// ========= Timings =========
+#define MIN_ELAPSED_RSSI_TIME 200
+#define ELAPSED_COMMAND 2000
+
+// ========= Defaults =========
+#define DEFAULT_VOLUME 35
+
+// ========= Modes =========
+#define FM  0
+#define LSB 1
+#define USB 2
+#define AM  3
+#define LW  4
+
+// ========= EEPROM / Einstellungen =========
+// Gespeichert wird im Log der Partition "settings" (SettingsLog.h); das
+// EEPROM wird nur noch einmalig für die Übernahme alter Einstellungen gelesen.
+#define EEPROM_SIZE 512
+#define STORE_TIME 10000
+
+const uint8_t app_id = 56;
+const int eeprom_address = 0;
+long storeTime = millis();
+bool itIsTimeToSave = false;
+
+// ========= State =========
+bool bfoOn = false;
+
+int8_t agcIdx = 0;
+uint8_t disableAgc = 0;
+int8_t agcNdx = 0;
+int8_t softMuteMaxAttIdx = 24;
+
+uint8_t seekDirection = 1;
+
+bool cmdBand = false;
+bool cmdVolume = false;
+bool cmdAgc = false;
+bool cmdBandwidth = false;
+bool cmdStep = false;
+bool cmdMode = false;
+bool cmdMenu = false;
+bool cmdSoftMuteMaxAtt = false;
+bool cmdRds = false;
+bool cmdRegion = false;
+bool cmdAntcap = false;
+
+bool oledEdit = false;
+bool fmRDS = true;
+bool antcapAuto = true;
+
+int16_t currentBFO = 0;
+long elapsedRSSI = millis();
+long elapsedButton = millis();
+long elapsedCommand = millis();
+std::atomic<int32_t> encoderAccum{0};   // Rastungen seit dem letzten Abholen (ISR addiert)
+uint16_t currentFrequency;
+
+const uint8_t currentBFOStep = 10;   // Hz je Rastung im BFO-Editor (Feinabstimmung)
+
+// ========= AM region/raster =========
+// Raster-Rechnung in RadioLogic.cpp
+uint8_t amRegion = REGION_9KHZ;
+inline uint8_t getAmSpacing() { return (amRegion == REGION_9KHZ) ? 9 : 10; }
+
+// ========= Menu =========
+const char *menu[] = { "Volume", "Step", "Mode", "BFO", "BW", "AGC/Att", "SoftMute", "Region", "Seek Up", "Seek Down", "RDS", "ANTCAP" };
+int8_t menuIdx = 0;
+const int lastMenu = 11;
+int8_t currentMenuCmd = -1;
+
+// ========= Bandwidth sets =========
+typedef struct { uint8_t idx; const char *desc; } Bandwidth;
+
+int8_t bwIdxSSB = 4;
+const int8_t maxSsbBw = 5;
+Bandwidth bandwidthSSB[] = {
+  {4, "0.5"}, {5, "1.0"}, {0, "1.2"}, {1, "2.2"}, {2, "3.0"}, {3, "4.0"}
+};
+
+int8_t bwIdxAM = 4;
+const int8_t maxAmBw = 6;
+Bandwidth bandwidthAM[] = {
+  {4, "1.0"}, {5, "1.8"}, {3, "2.0"}, {6, "2.5"}, {2, "3.0"}, {1, "4.0"}, {0, "6.0"}
+};
+
+int8_t bwIdxFM = 0;
+const int8_t maxFmBw = 4;
+Bandwidth bandwidthFM[] = {
+  {0, "AUT"}, {1, "110"}, {2, " 84"}, {3, " 60"}, {4, " 40"}
+};
+
+// ========= Steps =========
+int tabAmStep[] = {1, 5, 9, 10, 50, 100};
+const int lastAmStep = (sizeof tabAmStep / sizeof(int)) - 1;
+int idxAmStep = 3;
+
+int tabFmStep[] = {5, 10, 20};
+const int lastFmStep = (sizeof tabFmStep / sizeof(int)) - 1;
+int idxFmStep = 1;
+
+uint16_t currentStepIdx = 1;
+
+// ========= Mode desc =========
+const char *bandModeDesc[] = {"FM ", "LSB", "USB", "AM "};
+uint8_t currentMode = FM;
+
+// ========= Bands =========
+// Beschreibung und Zustand der Bänder in Bands.cpp
+static_assert(BAND_MODE_FM == FM && BAND_MODE_LSB == LSB && BAND_MODE_USB == USB && BAND_MODE_AM == AM, "Modi in Bands.h passen nicht");
+static_assert(BAND_FM_STEPS == sizeof(tabFmStep) / sizeof(tabFmStep[0]), "FM-Schritte in Bands.h passen nicht");
+static_assert(BAND_AM_STEPS == sizeof(tabAmStep) / sizeof(tabAmStep[0]), "AM-Schritte in Bands.h passen nicht");
+static_assert(BAND_FM_BWS == maxFmBw + 1 && BAND_AM_BWS == maxSsbBw + 1 && BAND_AM_ONLY_BWS == maxAmBw + 1, "Bandbreiten in Bands.h passen nicht");
+
+const int lastBand = BAND_COUNT - 1;
+int bandIdx = 0;
+
+static bool isBroadcastMWBandIdx(int i) {
+  return (bandDesc[i].flags & BF_BCAST_MW) != 0;
+}
+static bool isCBBandIdx(int i) {
+  return (bandDesc[i].flags & BF_CB) != 0;
+}
+static uint8_t getSeekSpacingForCurrentBand() {
+  if (isBroadcastMWBandIdx(bandIdx)) return getAmSpacing();
+  if (isCBBandIdx(bandIdx)) return bandDesc[bandIdx].gridSpacing;
+  return 5;
+}
+
+// Alternative steps
+int tabStep[] = {1, 5, 10, 50, 100, 500, 1000};
+const int lastStep = (sizeof tabStep / sizeof(int)) - 1;
+
+// ========= STATUS =========
+uint8_t rssi = 0;
+uint8_t snr = 0;
+uint8_t volume = DEFAULT_VOLUME;
+
+// ========= HW =========
+Rotary encoder = Rotary(ENCODER_PIN_A, ENCODER_PIN_B);
+Adafruit_SSD1306 oled = Adafruit_SSD1306(128, 32, &Wire);
+SI4735 rx;
+
+// Ref clock
+double g_realRefHz = 0.0;
+
+// Helper: 0=LSB, 1=USB
+static inline uint8_t sbSelFromMode(uint8_t mode) { return (mode == USB) ? 1 : 0; }
+
+// ========== Forward decls ==========
+void saveAllReceiverInformation();
+void readAllReceiverInformation();
+bool loadReceiverInformation();
+void resetEepromDelay();
+void disableCommands();
+
+void oledShowFrequency();
+void oledShowBandMode();
+void oledShowRSSI();
+void oledShowFrequencyScreen();
+
+void showCommandStatus(char * currentCmd);
+void showMenu();
+void doMenu(int8_t v);
+void doCurrentMenuCmd();
+bool isMenuMode();
+void setBand(int8_t up_down);
+void useBand();
+bool loadSSB();
+bool ssbEnsure();
+void doBandwidth(int8_t v);
+void doAgc(int8_t v);
+void doStep(int8_t v);
+void doMode(int8_t v);
+void doVolume(int8_t v);
+void showFrequencySeek(uint16_t freq);
+void seekStart(uint8_t dir);
+void seekStop(bool cancel);
+void doSoftMute(int8_t v);
+void doRegion(int8_t v);
+void radioPublishState();
+void radioTask(void *);
+
+// ========= Antennenkapazität =========
+// Abstimmen über rxSetFrequency(): mit antcapAuto gibt der Cache (AntCap.h) die
+// Kapazität vor und es wird nur bis STC gewartet statt der festen Wartezeit der
+// Library. Fehlt der Wert oder ist er veraltet, sucht der Chip selbst und der
+// gemeldete Wert wird gelernt. FM bleibt automatisch, Hold bleibt bei 1.
+#define TUNE_DELAY_DEFAULT 30   // maxDelaySetFrequency der SI4735-Library
+
+static uint8_t  tuneDelayMs = TUNE_DELAY_DEFAULT;   // 0 = Scans warten selbst
+static bool     antcapLearnNext = false;
+static uint8_t  antcapLearnBand = 0;
+static uint32_t antcapTunedMs = 0;
+
+static void rxSetTuneDelay(uint8_t ms) {
+  tuneDelayMs = ms;
+  rx.setMaxDelaySetFrequency(ms);
+}
+
+// Kapazität für f im Band band vorgeben; true = aus dem Cache. Der Band-Scan
+// stimmt in einem fremden Band ab, daher nicht immer bandIdx.
+static bool antcapPrepare(uint8_t band, uint16_t f) {
+  antcapLearnNext = false;
+  antcapTunedMs = millis();
+  if (bandDesc[band].type == FM_BAND_TYPE) {   // FM sucht immer selbst
+    rx.setTuneFrequencyAntennaCapacitor(0);
+    return false;
+  }
+  uint16_t cap = antcapAuto ? 0 : 1;
+  const bool cached = antcapAuto && antcapLookup(band, f, antcapTunedMs, cap);
+  antcapLearnNext = antcapAuto && !cached;
+  antcapLearnBand = band;
+  rx.setTuneFrequencyAntennaCapacitor(cap);
+  return cached;
+}
+
+// Nach automatischer Abstimmung den Wert aus dem gerade gelesenen Tune-Status lernen
+static void antcapLearnFromStatus(uint16_t f) {
+  if (!antcapLearnNext) return;
+  antcapLearnNext = false;
+  if (rx.getTuneCompleteTriggered()) antcapLearn(antcapLearnBand, f, rx.getAntennaTuningCapacitor(), millis());
+}
+
+void rxSetFrequency(uint16_t f, uint8_t band) {
+  I2C_SCOPE(m, I2C_DEV_SI4735, I2C_OP_TUNE, 0);
+  const bool cached = antcapPrepare(band, f);
+  if (!tuneDelayMs) {   // Scan: kein Warten, kein Lernen
+    antcapLearnNext = false;
+    rx.setFrequency(f);
+    return;
+  }
+  if (cached || antcapLearnNext) rx.getStatus(1, 0);   // altes STC quittieren
+  if (cached) {
+    // Ohne Kapazitätssuche ist der Chip früher fertig: bis STC, höchstens tuneDelayMs
+    rx.setMaxDelaySetFrequency(0);
+    rx.setFrequency(f);
+    rx.setMaxDelaySetFrequency(tuneDelayMs);
+    const uint32_t t0 = millis();
+    do {
+      delay(1);
+      rx.getStatus(0, 0);
+    } while (!rx.getTuneCompleteTriggered() && (millis() - t0) < tuneDelayMs);
+    return;
+  }
+  rx.setFrequency(f);
+  if (antcapLearnNext) {
+    rx.getStatus(0, 0);
+    antcapLearnFromStatus(f);
+  }
+}
+
+// Im eingestellten Band
+void rxSetFrequency(uint16_t f) {
+  rxSetFrequency(f, bandIdx);
+}
+
+// ========= SSB-Feinabstimmung =========
+// Einheitliche Frequenz in Hz; in LSB/USB gilt currentFrequency * 1000 - currentBFO.
+// Feine Schritte ändern nur den BFO, der Chip wird erst neu abgestimmt, wenn der
+// BFO sein Fenster verlässt (fineTuneSplit in RadioLogic.cpp).
+static inline bool isSSBMode() { return currentMode == LSB || currentMode == USB; }
+
+uint32_t currentFrequencyHz() {
+  if (isSSBMode()) return (uint32_t)((int32_t) currentFrequency * 1000 - currentBFO);
+  return (uint32_t) currentFrequency * ((currentMode == FM) ? 10000UL : 1000UL);
+}
+
+static void fineTuneHz(int32_t hz) {
+  const BandDesc &b = bandDesc[bandIdx];
+  uint16_t kHz;
+  int16_t bfo;
+  if (fineTuneSplit((hz > 0) ? (uint32_t) hz : 0, currentFrequency, SSB_FINE_WINDOW_HZ,
+                    b.minimumFreq, b.maximumFreq, kHz, bfo)) {
+    rxSetFrequency(kHz);
+    currentFrequency = kHz;
+  }
+  if (bfo != currentBFO) {
+    I2C_SCOPE(m, I2C_DEV_SI4735, I2C_OP_BFO, 0);
+    rx.setSSBBfo(bfo);
+    currentBFO = bfo;
+  }
+}
+
+// ========== API für WebUI ==========
+void setBandIndex(uint8_t newIdx) {
+  if (newIdx > lastBand) newIdx = lastBand;
+  bandState[bandIdx].currentFreq = currentFrequency;
+  bandState[bandIdx].currentStepIdx = currentStepIdx;
+  bandIdx = newIdx;
+  useBand();
+  elapsedCommand = millis();
+}
+
+void setFrequencySafe(uint16_t v) {
+  currentFrequency = v;
+  rxSetFrequency(currentFrequency);
+  oledShowFrequencyScreen();
+}
+
+// Hz-genau in LSB/USB, sonst auf die Einheit des Bandes gerundet
+void setFrequencyHz(uint32_t hz) {
+  if (isSSBMode()) {
+    fineTuneHz((int32_t) hz);
+    oledShowFrequencyScreen();
+    return;
+  }
+  const uint32_t unit = (currentMode == FM) ? 10000UL : 1000UL;
+  setFrequencySafe((uint16_t)((hz + unit / 2) / unit));
+}
+
+void tuneDelta(int delta) {
+  int32_t f = (int32_t)currentFrequency + delta;
+  if (f < 1) f = 1;
+  if (f > 300000) f = 300000;
+  setFrequencySafe((uint16_t)f);
+}
+
+// ========= RDS =========
+static void sanitizeAscii(char* s) { if (!s) return; for (uint8_t i = 0; s[i]; i++) if ((uint8_t)s[i] < 32) s[i] = ' '; }
+
+// Top (PS)
+char rdsPSShown[9] = "";
+
+// PS für die OLED; Dekodierung und Bestätigung übernimmt Rds.cpp
+void rdsResetTop() { rdsPSShown[0] = 0; rdsReset(); }
+
+// Kurz-PS mit Limit (z. B. 8 Zeichen) für die erste OLED-Zeile
+static void rdsGetPsShortN(char* out, size_t outsz, uint8_t maxChars) {
+  if (!out || outsz == 0) return;
+  char tmp[9];
+  strncpy(tmp, rdsPSShown, sizeof(tmp));
+  tmp[sizeof(tmp)-1] = '\0';
+  if (maxChars > 8) maxChars = 8;
+  char buf[9];
+  uint8_t i=0; for (; i<maxChars && tmp[i]; i++) buf[i] = tmp[i];
+  buf[i] = '\0';
+  strncpy(out, buf, outsz);
+  out[outsz-1] = '\0';
+}
+
+void rdsTopRender(const char* txt8) {
+  if (!txt8) return;
+  char eight[9]; strncpy(eight, txt8, 8); eight[8] = '\0'; sanitizeAscii(eight);
+  if (strncmp(eight, rdsPSShown, 8) != 0) {
+    strncpy(rdsPSShown, eight, 9);
+    rdsPSShown[8] = '\0';
+    // Kopfzeile sofort aktualisieren, sofern keine Menüs aktiv sind
+    if (!isMenuMode() && !oledEdit) {
+      oledShowBandMode();
+    }
+  }
+}
+
+// ========= ISR =========
+// Jede Rastung wird aufaddiert; der Radio-Task holt die Summe gesammelt ab,
+// dadurch geht auch bei schnellem Drehen während I2C/OLED nichts verloren.
+void IRAM_ATTR rotaryEncoder() {
+  uint8_t encoderStatus = encoder.process();
+  if (encoderStatus) encoderAccum.fetch_add((encoderStatus == DIR_CW) ? 1 : -1, std::memory_order_relaxed);
+}
+
+// ========= Encoder-Beschleunigung =========
+// Geschwindigkeit und Tabelle in RadioLogic.cpp
+static EncAccel encAccel = { 0, 0 };
+
+static int32_t encoderDrain() {
+  return encoderAccum.exchange(0, std::memory_order_relaxed);
+}
+
+static uint8_t encoderAccel(int32_t detents) {
+  return encAccelUpdate(encAccel, millis(), detents);
+}
+
+// Alle abgeholten Rastungen als ein einziges setFrequency; an den Bandgrenzen
+// wird wie bei frequencyUp()/frequencyDown() auf die andere Seite gesprungen.
+// In LSB/USB läuft der Schritt über die Feinabstimmung und behält den Hz-Anteil.
+static void tuneByDetents(int32_t detents) {
+  const int32_t step = (currentMode == FM) ? tabFmStep[currentStepIdx] : tabAmStep[currentStepIdx];
+  const BandDesc &b = bandDesc[bandIdx];
+  const int32_t delta = detents * encoderAccel(detents) * step;
+  if (isSSBMode()) {
+    const int32_t hz = (int32_t) currentFrequencyHz() + delta * 1000;
+    if (hz >= (int32_t) b.minimumFreq * 1000 && hz <= (int32_t) b.maximumFreq * 1000) fineTuneHz(hz);
+    else fineTuneHz((int32_t) wrapTune(currentFrequency, delta, b.minimumFreq, b.maximumFreq) * 1000);
+    return;
+  }
+  const uint16_t f = wrapTune(currentFrequency, delta, b.minimumFreq, b.maximumFreq);
+  rxSetFrequency(f);
+  currentFrequency = f;
+}
+
+// ========= Ref clock =========
+void startRefClock() {
+  g_realRefHz = ledcSetup(LEDC_CH, REFCLK_HZ, LEDC_TIMERBIT);
+  ledcAttachPin(PIN_RCLK_OUT, LEDC_CH);
+  uint32_t duty = 1U << (LEDC_TIMERBIT - 1);
+  ledcWrite(LEDC_CH, duty);
+}
+
+// ========= OLED (normal) =========
+void oledShowFrequency() {
+  oled.fillRect(0, 8, 128, 17, SSD1306_BLACK);
+
+  char tmp[8], out[8];
+  sprintf(tmp, "%5.5u", currentFrequency);
+  out[0] = (tmp[0] == '0') ? ' ' : tmp[0];
+  out[1] = tmp[1];
+  const char* unit;
+  bool isFM = rx.isCurrentTuneFM();
+  if (isFM) {
+    out[2] = tmp[2]; out[3] = '.'; out[4] = tmp[3];
+    unit = "MHz";
+  } else {
+    if (currentFrequency < 1000) { out[1] = ' '; out[2] = tmp[2]; out[3] = tmp[3]; out[4] = tmp[4]; }
+    else { out[2] = tmp[2]; out[3] = tmp[3]; out[4] = tmp[4]; }
+    unit = "kHz";
+  }
+  out[5] = '\0';
+
+  // Frequenz groß
+  oled.setFont(&DSEG7_Classic_Regular_16);
+  oled.setCursor(20, 24);
+  oled.print(out);
+
+  // Einheit
+  oled.setFont(NULL);
+  oled.setTextSize(1);
+  if (isFM) {
+    // weiter nach rechts gerückt (vorher 64)
+    oled.setCursor(76, 15);
+    oled.print(unit);
+  } else {
+    oled.setCursor(90, 15);
+    oled.print(unit);
+  }
+
+  oledRequestFlush();
+}
+
+void oledShowBandMode() {
+  oled.fillRect(0, 0, 128, 8, SSD1306_BLACK);
+  oled.setTextSize(1);
+
+  // Mode links
+  const char* modeStr =
+    (bandDesc[bandIdx].type == LW_BAND_TYPE) ? "LW  " : bandModeDesc[currentMode];
+  oled.setCursor(0, 0);
+  oled.print(modeStr);
+
+  // Bei FM: Sendername (PS) direkt neben "FM " (max. 8 Zeichen)
+  if (currentMode == FM) {
+    char ps[9] = {0};
+    rdsGetPsShortN(ps, sizeof(ps), 8);
+    if (ps[0]) {
+      // „FM “ ~18 px breit im 6x8 Font; 28 px als Start ist passend
+      oled.setCursor(28, 0);
+      oled.print(ps);
+    }
+  }
+
+  // Bandname rechts wie gehabt
+  oled.setCursor(90, 0);
+  oled.print(bandDesc[bandIdx].name);
+
+  oledRequestFlush();
+}
+
+void oledShowRSSI() {
+  char sMeter[10];
+  sprintf(sMeter, "S:%d ", rssi);
+  oled.fillRect(0, 25, 128, 10, SSD1306_BLACK);
+  oled.setTextSize(1);
+  oled.setCursor(80, 25); oled.print(sMeter);
+  if (currentMode == FM) { oled.setCursor(0, 25); oled.print(rx.getCurrentPilot() ? "ST" : "MO"); }
+  oledRequestFlush();
+}
+
+void oledShowFrequencyScreen() {
+  oledShowBandMode();
+  oledShowFrequency();
+  oledShowRSSI();
+}
+
+// ========= UI helpers =========
+void showCommandStatus(char * currentCmd) {
+  oled.fillRect(40, 0, 50, 8, SSD1306_BLACK);
+  oled.setCursor(40, 0);
+  oled.setTextSize(1);
+  oled.print(currentCmd);
+  oledRequestFlush();
+}
+
+void showMenu() {
+  oled.clearDisplay();
+  oled.setCursor(0, 10);
+  oled.setTextSize(1);
+  oled.print(menu[menuIdx]);
+  oledRequestFlush();
+  showCommandStatus((char *) "Menu");
+}
+
+// ========= SSB patch =========
+// Bustakte für den Download, schnellster zuerst. Schlägt eine Stufe fehl
+// (Fehlerbit im Download oder falscher Rückleswert), wird mit der nächsten neu
+// geladen; die letzte Stufe entspricht dem früheren festen Verfahren.
+// SI4735 und SSD1306 am selben Bus sind bis 400 kHz spezifiziert; 600/800 kHz
+// nur mit -DSSB_PATCH_OVERCLOCK=1 auf geprüfter Verdrahtung.
+#ifndef SSB_PATCH_OVERCLOCK
+#define SSB_PATCH_OVERCLOCK 0
+#endif
+
+static const struct { uint32_t hz; uint8_t settleMs; } ssbRungs[] = {
+#if SSB_PATCH_OVERCLOCK
+  { 800000, 10 },
+  { 600000, 10 },
+#endif
+  { 400000, 20 },
+  { 200000, 50 },
+};
+#define SSB_RUNGS      (sizeof(ssbRungs) / sizeof(ssbRungs[0]))
+#define SSB_VERIFY_BFO 0x2A5   // Testwert für das Rücklesen
+
+static uint8_t ssbRung = 0;    // schnellste Stufe, die zuletzt funktioniert hat
+
+// Nach rx.setup()/setFM()/setAM(): die Library startet den Chip nur beim
+// Wechsel der Firmware neu, genau dann ist auch der Patch weg
+static void siPowered(uint8_t p) {
+  if (modesw.power.load(std::memory_order_relaxed) == p) return;
+  modesw.power.store(p, std::memory_order_relaxed);
+  modesw.powerUps.fetch_add(1, std::memory_order_relaxed);
+}
+
+static inline bool ssbResident() {
+  return modesw.power.load(std::memory_order_relaxed) == SI_POWER_SSB;
+}
+
+// SSB_BFO gibt es nur in der gepatchten Firmware: Schreiben und Rücklesen prüft
+// den Patch und den Bus beim gerade eingestellten Takt
+static bool ssbVerify() {
+  rx.setSSBBfo(SSB_VERIFY_BFO);
+  return rx.getProperty(SSB_BFO) == SSB_VERIFY_BFO;
+}
+
+bool loadSSB() {
+  I2C_SCOPE(m, I2C_DEV_SI4735, I2C_OP_PATCH, size_content);
+  const uint32_t t0 = micros();
+  bool ok = false;
+  uint8_t r = ssbRung;
+  for (; r < SSB_RUNGS; r++) {
+    rx.setI2CFastModeCustom(ssbRungs[r].hz);
+    rx.queryLibraryId();
+    rx.patchPowerUp();
+    delay(ssbRungs[r].settleMs);
+    if (rx.downloadCompressedPatch(ssb_patch_content, size_content, cmd_0x15, cmd_0x15_size) && ssbVerify()) {
+      ok = true;
+      break;
+    }
+    I2C_SCOPE_RETRY(m);
+    modesw.patchFails.fetch_add(1, std::memory_order_relaxed);
+  }
+  if (ok) {
+    ssbRung = r;
+    rx.setSSBConfig(bandwidthSSB[bwIdxSSB].idx, 1, 0, 1, 0, 1);
+    rx.setSSBBfo(currentBFO);
+    modesw.patchHz.store(ssbRungs[r].hz, std::memory_order_relaxed);
+    modesw.patchLoads.fetch_add(1, std::memory_order_relaxed);
+  }
+  rx.setI2CStandardMode();
+  // queryLibraryId() hat den Chip neu gestartet; ohne gültigen Patch ist der Zustand offen
+  modesw.power.store(ok ? SI_POWER_SSB : SI_POWER_OFF, std::memory_order_relaxed);
+  modesw.powerUps.fetch_add(1, std::memory_order_relaxed);
+  modesw.patchUs.store(micros() - t0, std::memory_order_relaxed);
+#if DEBUG_SSB
+  if (ok) Serial.printf("[SSB] Patch loaded: %lu Hz, %lu us\n", (unsigned long) ssbRungs[r].hz, (unsigned long)(micros() - t0));
+  else    Serial.println("[SSB] Patch load failed.");
+#endif
+  return ok;
+}
+
+// Vor jedem setSSB(): Patch nur laden, wenn der Chip seitdem neu gestartet wurde.
+// false = kein Patch, der Aufrufer muss mit ssbFallback() in AM weitermachen
+bool ssbEnsure() {
+  if (ssbResident()) {
+    modesw.patchSkips.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+  return loadSSB();
+}
+
+static bool ssbFailed = false;   // "SSB?" statt der üblichen Statusanzeige
+
+// Nach einem fehlgeschlagenen Download steht der Chip im Patch-Modus ohne Patch.
+// setAM() startet ihn nur neu, wenn die Library vorher nicht AM hatte, darum
+// hier ausdrücklich als AM starten; der Aufrufer stellt danach AM ein.
+static void ssbFallback() {
+  currentMode = AM;
+  rx.powerDown();
+  rx.setPowerUp(0, 0, 0, XOSCEN_RCLK, 1, SI473X_ANALOG_AUDIO);   // wie rx.setup(): AM, analog
+  rx.radioPowerUp();
+  rx.setVolume(volume);
+  siPowered(SI_POWER_AM);
+  ssbFailed = true;
+}
+
+// ========= Band select =========
+void setBand(int8_t up_down) {
+  bandState[bandIdx].currentFreq = currentFrequency;
+  bandState[bandIdx].currentStepIdx = currentStepIdx;
+  if (up_down == 1) bandIdx = (bandIdx < lastBand) ? (bandIdx + 1) : 0;
+  else bandIdx = (bandIdx > 0) ? (bandIdx - 1) : lastBand;
+  useBand();
+  elapsedCommand = millis();
+}
+
+void useBand() {
+  I2C_SCOPE(m, I2C_DEV_SI4735, I2C_OP_CONFIG, 0);
+  if (bandDesc[bandIdx].type == FM_BAND_TYPE) {
+    currentMode = FM;
+    rx.setTuneFrequencyAntennaCapacitor(0);
+    rx.setFM(bandDesc[bandIdx].minimumFreq, bandDesc[bandIdx].maximumFreq, bandState[bandIdx].currentFreq, tabFmStep[bandState[bandIdx].currentStepIdx]);
+    rx.setSeekFmLimits(bandDesc[bandIdx].minimumFreq, bandDesc[bandIdx].maximumFreq);
+    siPowered(SI_POWER_FM);
+    bfoOn = false;
+    bwIdxFM = bandState[bandIdx].bandwidthIdx;
+    rx.setFmBandwidth(bandwidthFM[bwIdxFM].idx);
+    rx.setFmSoftMuteMaxAttenuation(softMuteMaxAttIdx);
+    rx.setRdsConfig(3, 3, 3, 3, 3);
+    rx.setFifoCount(1);
+    rdsResetTop();
+  } else {
+    antcapPrepare(bandIdx, bandState[bandIdx].currentFreq);
+
+    if ((currentMode == LSB || currentMode == USB) && !ssbEnsure()) ssbFallback();
+    if (currentMode == LSB || currentMode == USB) {
+      rx.setSSB(bandDesc[bandIdx].minimumFreq, bandDesc[bandIdx].maximumFreq,
+                bandState[bandIdx].currentFreq, tabAmStep[bandState[bandIdx].currentStepIdx],
+                sbSelFromMode(currentMode)); // 0=LSB, 1=USB
+      rx.setSSBAutomaticVolumeControl(1);
+      rx.setSsbSoftMuteMaxAttenuation(softMuteMaxAttIdx);
+      bwIdxSSB = bandState[bandIdx].bandwidthIdx;
+      rx.setSSBAudioBandwidth(bandwidthSSB[bwIdxSSB].idx);
+      rx.setSSBBfo(currentBFO);
+#if DEBUG_SSB
+      const char* m = (currentMode==LSB)?"LSB":"USB";
+      Serial.printf("[SSB] useBand->setSSB: mode=%s, f=%u kHz, step=%d, BW=%s, BFO=%d\n",
+                    m, bandState[bandIdx].currentFreq, tabAmStep[bandState[bandIdx].currentStepIdx],
+                    bandwidthSSB[bwIdxSSB].desc, (int)currentBFO);
+#endif
+    } else {
+      currentMode = AM;
+      rx.setAM(bandDesc[bandIdx].minimumFreq, bandDesc[bandIdx].maximumFreq,
+               bandState[bandIdx].currentFreq, tabAmStep[bandState[bandIdx].currentStepIdx]);
+      siPowered(SI_POWER_AM);
+      bfoOn = false;
+      bwIdxAM = bandState[bandIdx].bandwidthIdx;
+      rx.setBandwidth(bandwidthAM[bwIdxAM].idx, 1);
+      rx.setAmSoftMuteMaxAttenuation(softMuteMaxAttIdx);
+
+      if (isBroadcastMWBandIdx(bandIdx)) {
+        uint16_t fNew = alignMwToRegion(bandState[bandIdx].currentFreq, bandDesc[bandIdx].minimumFreq, bandDesc[bandIdx].maximumFreq, amRegion);
+        if (fNew != bandState[bandIdx].currentFreq) {
+          bandState[bandIdx].currentFreq = fNew;
+          rx.setFrequency(fNew);
+        }
+      } else if (isCBBandIdx(bandIdx)) {
+        const BandDesc &d = bandDesc[bandIdx];
+        uint16_t fNew = alignToGrid(bandState[bandIdx].currentFreq, d.gridBase, d.gridSpacing, d.minimumFreq, d.maximumFreq);
+        if (fNew != bandState[bandIdx].currentFreq) {
+          bandState[bandIdx].currentFreq = fNew;
+          rx.setFrequency(fNew);
+        }
+      }
+    }
+    rx.setAutomaticGainControl(disableAgc, agcNdx);
+    rx.setSeekAmLimits(bandDesc[bandIdx].minimumFreq, bandDesc[bandIdx].maximumFreq);
+    rx.setSeekAmSpacing(getSeekSpacingForCurrentBand());
+    rdsResetTop();
+  }
+
+  delay(50);
+  uint16_t fDev = rx.getFrequency();
+  antcapLearnFromStatus(fDev);
+  bandState[bandIdx].currentFreq = fDev;
+  currentFrequency = fDev;
+
+  currentStepIdx = bandState[bandIdx].currentStepIdx;
+
+  rssi = 0;
+  oledShowFrequencyScreen();
+  showCommandStatus((char *)(ssbFailed ? "SSB?" : "Band"));
+  ssbFailed = false;
+}
+
+// ========= Bandwidth/AGC/Step =========
+// Bandbreite über den Index im aktuellen Modus setzen
+static void setBandwidthIdx(int8_t idx) {
+  if (currentMode == LSB || currentMode == USB) {
+    bwIdxSSB = idx;
+    rx.setSSBAudioBandwidth(bandwidthSSB[bwIdxSSB].idx);
+    if (bandwidthSSB[bwIdxSSB].idx == 0 || bandwidthSSB[bwIdxSSB].idx == 4 || bandwidthSSB[bwIdxSSB].idx == 5)
+      rx.setSSBSidebandCutoffFilter(0);
+    else
+      rx.setSSBSidebandCutoffFilter(1);
+  } else if (currentMode == AM) {
+    bwIdxAM = idx;
+    rx.setBandwidth(bandwidthAM[bwIdxAM].idx, 1);
+  } else {
+    bwIdxFM = idx;
+    rx.setFmBandwidth(bandwidthFM[bwIdxFM].idx);
+  }
+  bandState[bandIdx].bandwidthIdx = idx;
+}
+
+void doBandwidth(int8_t v) {
+  int8_t idx, maxBw;
+  if (currentMode == LSB || currentMode == USB) { idx = bwIdxSSB; maxBw = maxSsbBw; }
+  else if (currentMode == AM)                   { idx = bwIdxAM;  maxBw = maxAmBw; }
+  else                                          { idx = bwIdxFM;  maxBw = maxFmBw; }
+  idx = (v == 1) ? idx + 1 : idx - 1;
+  if (idx > maxBw) idx = 0;
+  else if (idx < 0) idx = maxBw;
+  setBandwidthIdx(idx);
+  elapsedCommand = millis();
+}
+
+// AGC-Index: 0 = AGC an, 1 = AGC aus, >1 Dämpfung agcIdx - 1
+static void setAgcIdx(int8_t idx) {
+  agcIdx = idx;
+  disableAgc = (agcIdx > 0);
+  agcNdx = (agcIdx > 1) ? (agcIdx - 1) : 0;
+  rx.setAutomaticGainControl(disableAgc, agcNdx);
+}
+
+void doAgc(int8_t v) {
+  int8_t idx = (v == 1) ? agcIdx + 1 : agcIdx - 1;
+  if (idx < 0) idx = RADIO_AGC_MAX;
+  else if (idx > RADIO_AGC_MAX) idx = 0;
+  setAgcIdx(idx);
+  elapsedCommand = millis();
+}
+
+void doStep(int8_t v) {
+  if ( currentMode == FM ) {
+    idxFmStep = (v == 1) ? idxFmStep + 1 : idxFmStep - 1;
+    if (idxFmStep > lastFmStep) idxFmStep = 0;
+    else if (idxFmStep < 0)     idxFmStep = lastFmStep;
+    currentStepIdx = idxFmStep;
+    rx.setFrequencyStep(tabFmStep[currentStepIdx]);
+  } else {
+    idxAmStep = (v == 1) ? idxAmStep + 1 : idxAmStep - 1;
+    if (idxAmStep > lastAmStep) idxAmStep = 0;
+    else if (idxAmStep < 0)     idxAmStep = lastAmStep;
+    currentStepIdx = idxAmStep;
+    rx.setFrequencyStep(tabAmStep[currentStepIdx]);
+    rx.setSeekAmSpacing(getSeekSpacingForCurrentBand());
+  }
+  bandState[bandIdx].currentStepIdx = currentStepIdx;
+  elapsedCommand = millis();
+}
+
+// ========= Mode switch (AM/LSB/USB) =========
+void doMode(int8_t v) {
+  if (rx.isCurrentTuneFM()) return;
+
+  uint8_t nextMode;
+  if (v == 1) {
+    if (currentMode == AM) nextMode = LSB;
+    else if (currentMode == LSB) nextMode = USB;
+    else nextMode = AM; // USB -> AM
+  } else {
+    if (currentMode == AM) nextMode = USB;
+    else if (currentMode == USB) nextMode = LSB;
+    else nextMode = AM; // LSB -> AM
+  }
+
+  I2C_SCOPE(m, I2C_DEV_SI4735, I2C_OP_CONFIG, 0);
+  const BandDesc &d = bandDesc[bandIdx];
+  BandState &b = bandState[bandIdx];
+  const uint16_t minF = d.minimumFreq;
+  const uint16_t maxF = d.maximumFreq;
+  const uint16_t step = tabAmStep[b.currentStepIdx];
+
+  // Patch nur neu laden, wenn setAM() den Chip inzwischen neu gestartet hat
+  if (nextMode != AM && !ssbEnsure()) {
+    ssbFallback();
+    nextMode = AM;
+  }
+
+  if (nextMode == AM) {
+    rx.setAM(minF, maxF, currentFrequency, step);
+    siPowered(SI_POWER_AM);
+    bfoOn = false;
+    bwIdxAM = b.bandwidthIdx;
+    rx.setBandwidth(bandwidthAM[bwIdxAM].idx, 1);
+    rx.setAmSoftMuteMaxAttenuation(softMuteMaxAttIdx);
+
+    if (d.flags & BF_BCAST_MW) {
+      uint16_t fNew = alignMwToRegion(currentFrequency, minF, maxF, amRegion);
+      if (fNew != currentFrequency) rx.setFrequency(fNew);
+    } else if (d.flags & BF_CB) {
+      uint16_t fNew = alignToGrid(currentFrequency, d.gridBase, d.gridSpacing, minF, maxF);
+      if (fNew != currentFrequency) rx.setFrequency(fNew);
+    }
+  } else {
+    rx.setSSB(minF, maxF, currentFrequency, step, sbSelFromMode(nextMode)); // 0=LSB, 1=USB
+    rx.setSSBAutomaticVolumeControl(1);
+    rx.setSsbSoftMuteMaxAttenuation(softMuteMaxAttIdx);
+    bwIdxSSB = b.bandwidthIdx;
+    rx.setSSBAudioBandwidth(bandwidthSSB[bwIdxSSB].idx);
+    rx.setSSBBfo(currentBFO);
+  }
+
+  rx.setAutomaticGainControl(disableAgc, agcNdx);
+
+  delay(50);
+  currentFrequency = rx.getFrequency();
+  b.currentFreq = currentFrequency;
+  currentMode = nextMode;
+
+#if DEBUG_SSB
+  Serial.printf("[SSB] doMode: %s, usblsb=%u, f=%u kHz, patch=%s\n",
+                (currentMode==AM)?"AM":(currentMode==USB)?"USB":"LSB",
+                (currentMode==USB)?1:0, currentFrequency, ssbResident()?"true":"false");
+#endif
+
+  oledShowFrequencyScreen();
+  if (ssbFailed) {
+    showCommandStatus((char *) "SSB?");
+    ssbFailed = false;
+  }
+  elapsedCommand = millis();
+}
+
+// ========= Volume/Seek/SoftMute/Region/Menu =========
+void doVolume( int8_t v ) {
+  if ( v == 1) rx.volumeUp(); else rx.volumeDown();
+  elapsedCommand = millis();
+}
+
+void showFrequencySeek(uint16_t freq) {
+  currentFrequency = freq;
+  if (!oledEdit && !isMenuMode()) oledShowFrequencyScreen();
+}
+
+// Seek als Zustandsmaschine: seekStart() startet die Hardware-Suche, seekService()
+// fragt im Radio-Task periodisch den Tune-Status ab und meldet Zwischenfrequenzen.
+#define SEEK_POLL_MS  30     // Abstand der Statusabfragen
+#define SEEK_MAX_TIME 20000  // spätestens dann abbrechen (z. B. Band ALL)
+
+static struct {
+  bool     active;
+  uint8_t  dir;              // 1 = aufwärts, 0 = abwärts
+  uint32_t startedAt, polledAt;
+} seekSm;
+
+void seekStart(uint8_t dir) {
+  if (currentMode == LSB || currentMode == USB) return;
+  seekStop(true);
+  seekDirection = dir;
+  seekSm.dir = dir;
+  rx.seekStation(dir, 0);
+  seekSm.active = true;
+  seekSm.startedAt = seekSm.polledAt = millis();
+}
+
+void seekStop(bool cancel) {
+  if (!seekSm.active) return;
+  seekSm.active = false;
+  if (cancel) rx.getStatus(0, 1);   // CANCEL: laufende Suche im Chip beenden
+  currentFrequency = rx.getFrequency();
+  bandState[bandIdx].currentFreq = currentFrequency;
+  if (rx.isCurrentTuneFM()) {
+    rdsResetTop();
+  }
+  if (!oledEdit && !isMenuMode()) oledShowFrequencyScreen();
+  resetEepromDelay();
+}
+
+static void seekService() {
+  if (!seekSm.active) return;
+  if ((millis() - seekSm.polledAt) < SEEK_POLL_MS) return;
+  seekSm.polledAt = millis();
+
+  I2C_SCOPE(m, I2C_DEV_SI4735, I2C_OP_TUNE, 0);
+  uint16_t f = rx.getFrequency();   // liest den Tune-Status inkl. STC/VALID/BLTF
+  if (f != currentFrequency) showFrequencySeek(f);
+
+  if (rx.getTuneCompleteTriggered()) {
+    rx.getStatus(1, 0);             // STC quittieren
+    // Wie seekStationProgress(): fertig bei gültigem Sender oder Bandgrenze
+    if (rx.getStatusValid() || rx.getBandLimit()) { seekStop(false); return; }
+    rx.seekStation(seekSm.dir, 0);
+  }
+  if ((millis() - seekSm.startedAt) > SEEK_MAX_TIME) seekStop(true);
+}
+
+void doSoftMute(int8_t v) {
+  softMuteMaxAttIdx = (v == 1) ? softMuteMaxAttIdx + 1 : softMuteMaxAttIdx - 1;
+  if (softMuteMaxAttIdx > 32) softMuteMaxAttIdx = 0;
+  else if (softMuteMaxAttIdx < 0) softMuteMaxAttIdx = 32;
+
+  if (currentMode == FM) {
+    rx.setFmSoftMuteMaxAttenuation(softMuteMaxAttIdx);
+  } else if (currentMode == LSB || currentMode == USB) {
+    rx.setSsbSoftMuteMaxAttenuation(softMuteMaxAttIdx);
+  } else {
+    rx.setAmSoftMuteMaxAttenuation(softMuteMaxAttIdx);
+  }
+
+  elapsedCommand = millis();
+}
+
+void doRegion(int8_t v) {
+  if (v == 1 || v == -1) {
+    amRegion = (amRegion == REGION_9KHZ) ? REGION_10KHZ : REGION_9KHZ;
+  }
+  rx.setSeekAmSpacing(getSeekSpacingForCurrentBand());
+
+  if (isBroadcastMWBandIdx(bandIdx)) {
+    uint16_t fNew = alignMwToRegion(currentFrequency, bandDesc[bandIdx].minimumFreq, bandDesc[bandIdx].maximumFreq, amRegion);
+    if (fNew != currentFrequency) {
+      currentFrequency = fNew;
+      rxSetFrequency(currentFrequency);
+      oledShowFrequencyScreen();
+    }
+  }
+  if (oledEdit) {
+    oled.clearDisplay();
+    oled.setCursor(0, 0);
+    oled.setTextSize(1);
+    oled.print("Region");
+    oled.setCursor(0, 16);
+    oled.print((amRegion == REGION_9KHZ) ? "9 kHz" : "10 kHz");
+    oledRequestFlush();
+  }
+  elapsedCommand = millis();
+  resetEepromDelay();
+}
+
+// ========= Menu/Edit helpers =========
+void doMenu( int8_t v) {
+  menuIdx = (v == 1) ? menuIdx + 1 : menuIdx - 1;
+  if (menuIdx > lastMenu) menuIdx = 0;
+  else if (menuIdx < 0)   menuIdx = lastMenu;
+  showMenu();
+  elapsedCommand = millis();
+}
+
+void enterEditScreen() { oledEdit = true; }
+void leaveEditScreen() {
+  oledEdit = false;
+  disableCommands();
+  oledShowFrequencyScreen();
+}
+
+void doCurrentMenuCmd() {
+  disableCommands();
+  switch (currentMenuCmd) {
+    case 0: cmdVolume = true; enterEditScreen(); break;
+    case 1: cmdStep   = true; enterEditScreen(); break;
+    case 2: cmdMode   = true; enterEditScreen(); break;
+    case 3: bfoOn     = true; enterEditScreen(); break;
+    case 4: cmdBandwidth = true; enterEditScreen(); break;
+    case 5: cmdAgc    = true; enterEditScreen(); break;
+    case 6: cmdSoftMuteMaxAtt = true; enterEditScreen(); break;
+    case 7: cmdRegion = true; enterEditScreen(); break;
+    case 8: seekStart(1); oledShowFrequencyScreen(); break;
+    case 9: seekStart(0); oledShowFrequencyScreen(); break;
+    case 10: cmdRds = true; enterEditScreen(); break;
+    case 11: cmdAntcap = true; enterEditScreen(); break;
+    default: break;
+  }
+  currentMenuCmd = -1;
+  elapsedCommand = millis();
+}
+
+bool isMenuMode() {
+  return (cmdMenu || cmdStep || cmdBandwidth || cmdAgc || cmdVolume || cmdSoftMuteMaxAtt || cmdMode || cmdRds || cmdRegion || cmdAntcap || bfoOn || cmdBand);
+}
+
+// ========= Setup =========
+// Bootstufen siehe Boot.h: hier Hardware und Einstellungen, dann laufen Radio
+// (radioBoot im Radio-Task) und WLAN, Speicherkanäle, Webserver nebeneinander an
+static bool settingsFound = false;
+
+void setup() {
+  bootBegin();
+  Serial.begin(115200);
+
+  bootStageBegin(BOOT_ST_HW);
+  pinMode(ENCODER_PUSH_BUTTON, INPUT_PULLUP);
+  pinMode(ENCODER_PIN_A, INPUT_PULLUP);
+  pinMode(ENCODER_PIN_B, INPUT_PULLUP);
+
+  Wire.begin(ESP32_I2C_SDA, ESP32_I2C_SCL);
+
+  oled.begin(SSD1306_SWITCHCAPVCC, 0x3C);
+  oledFlushBegin(&oled, 0x3C);
+  oled.clearDisplay();
+  oled.setTextColor(SSD1306_WHITE);
+
+  attachInterrupt(digitalPinToInterrupt(ENCODER_PIN_A), rotaryEncoder, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(ENCODER_PIN_B), rotaryEncoder, CHANGE);
+  buttonBegin(ENCODER_PUSH_BUTTON);
+
+  rx.setI2CFastModeCustom(100000);
+#if PERF_PROFILE
+  perfBegin();
+#endif
+  bootStageEnd(BOOT_ST_HW);
+
+  // Vor dem Radio-Task: der Reset-Hinweis braucht noch die OLED
+  bootStageBegin(BOOT_ST_SETTINGS);
+  bandsBegin();
+  settingsBegin(app_id);
+
+  if (digitalRead(ENCODER_PUSH_BUTTON) == LOW) {
+    settingsErase();
+    EEPROM.begin(EEPROM_SIZE);
+    EEPROM.write(eeprom_address, 0);
+    EEPROM.commit();
+    EEPROM.end();
+    oled.setTextSize(2);
+    oled.setCursor(0,0); oled.print("EEPROM");
+    oled.setCursor(0,16); oled.print("RESET");
+    oledRequestFlush();
+    oledFlush(true);
+    delay(1500);
+    oled.clearDisplay();
+  }
+  settingsFound = loadReceiverInformation();
+  bootStageEnd(BOOT_ST_SETTINGS);
+
+  // Ab hier gehören rx und OLED ausschließlich dem Radio-Task
+  xTaskCreatePinnedToCore(radioTask, "radio", RADIO_TASK_STACK, NULL, RADIO_TASK_PRIO, NULL, RADIO_TASK_CORE);
+
+  // WLAN, Speicherkanäle und Webserver, während der Radio-Task den Chip startet
+  WebUI::beginNetwork();
+  bootStageBegin(BOOT_ST_MEMORIES);
+  memBegin();
+  bootStageEnd(BOOT_ST_MEMORIES);
+  WebUI::begin();
+}
+
+// Erster Teil des Radio-Tasks: Chip starten und den letzten Stand einstellen.
+// Die Wartezeiten hier geben die CPU an WLAN- und Webserver-Start ab.
+static void radioBoot() {
+  bootStageBegin(BOOT_ST_RADIO);
+  startRefClock();
+  rdsBegin(rx.getDeviceI2CAddress(RESET_PIN));
+  rx.setRefClock((uint32_t)round(g_realRefHz + REFCLK_TRIM_HZ));
+  rx.setRefClockPrescaler(1);
+  rx.setup(RESET_PIN, 0, MW_BAND_TYPE, SI473X_ANALOG_AUDIO, XOSCEN_RCLK);
+  siPowered(SI_POWER_AM);
+  delay(250);
+  bootStageEnd(BOOT_ST_RADIO);
+
+  bootStageBegin(BOOT_ST_TUNE);
+  if (settingsFound) readAllReceiverInformation();
+  else rx.setVolume(volume);
+  useBand();
+  oledShowFrequencyScreen();
+  oledFlush(true);
+  historyBegin();
+  radioPublishState();
+  bootStageEnd(BOOT_ST_TUNE);
+}
+
+// ========= EEPROM save/load =========
+// Es werden nur geänderte Werte als Datensatz angehängt (settingsPut vergleicht
+// mit dem zuletzt gespeicherten Stand), typischerweise ein bis drei Datensätze.
+void saveAllReceiverInformation() {
+  settingsPut(SK_VOLUME, 0, rx.getVolume());
+  settingsPut(SK_BAND_IDX, 0, bandIdx);
+  settingsPut(SK_RDS, 0, fmRDS);
+  settingsPut(SK_MODE, 0, currentMode);
+  settingsPut(SK_BFO, 0, (uint16_t)currentBFO);
+  uint8_t sm = (softMuteMaxAttIdx < 0) ? 0 : (softMuteMaxAttIdx > 32 ? 32 : (uint8_t)softMuteMaxAttIdx);
+  settingsPut(SK_SOFTMUTE, 0, sm);
+  uint8_t agcStore = (agcIdx < 0) ? 0 : (agcIdx > 35) ? 35 : (uint8_t)agcIdx;
+  settingsPut(SK_AGC, 0, agcStore);
+  settingsPut(SK_REGION, 0, amRegion);
+  settingsPut(SK_ANTCAP, 0, antcapAuto ? 1 : 0);
+
+  bandState[bandIdx].currentFreq = currentFrequency;
+  for (int i = 0; i <= lastBand; i++) {
+    uint32_t v = ((uint32_t)bandState[i].currentFreq << 16) | ((uint32_t)bandState[i].currentStepIdx << 8) | bandState[i].bandwidthIdx;
+    settingsPut(SK_BAND, i, v);
+  }
+  // Gelernte Antennenkapazitäten; nur belegte Fächer, unveränderte schreibt settingsPut nicht
+  for (uint16_t i = 0; i < BAND_COUNT * ANTCAP_BUCKETS; i++) {
+    uint32_t v;
+    if (antcapPack(i, v)) settingsPut(SK_ANTCAP_TAB, i, v);
+  }
+}
+
+// Ein Datensatz aus dem Log -> globale Variablen (rx wird noch nicht angefasst)
+static void applySetting(uint8_t key, uint8_t idx, uint32_t value) {
+  switch (key) {
+    case SK_VOLUME:   volume = value; break;
+    case SK_BAND_IDX: if (value <= (uint32_t)lastBand) bandIdx = value; break;
+    case SK_RDS:      fmRDS = value; break;
+    case SK_MODE:     currentMode = value; break;
+    case SK_BFO:      currentBFO = (int16_t)value; break;
+    case SK_SOFTMUTE: softMuteMaxAttIdx = (value > 32) ? 24 : (int8_t)value; break;
+    case SK_AGC:
+      agcIdx = (value > 35) ? 0 : (int8_t)value;
+      disableAgc = (agcIdx > 0);
+      agcNdx = (agcIdx > 1) ? (agcIdx - 1) : 0;
+      break;
+    case SK_REGION:   amRegion = (value > REGION_10KHZ) ? REGION_9KHZ : value; break;
+    case SK_ANTCAP:   antcapAuto = value ? true : false; break;
+    case SK_BAND:
+      if (idx > lastBand) break;
+      bandState[idx].currentFreq = value >> 16;
+      bandState[idx].currentStepIdx = (value >> 8) & 0xFF;
+      bandState[idx].bandwidthIdx = value & 0xFF;
+      break;
+    case SK_ANTCAP_TAB:
+      if (idx < BAND_COUNT * ANTCAP_BUCKETS) antcapUnpack(idx, value);
+      break;
+  }
+}
+
+// Alter EEPROM-Stand (Layout app_id) einmalig ins Log übernehmen
+static bool importLegacyEeprom() {
+  EEPROM.begin(EEPROM_SIZE);
+  if (EEPROM.read(eeprom_address) != app_id) {
+    EEPROM.end();
+    return false;
+  }
+  applySetting(SK_VOLUME, 0, EEPROM.read(eeprom_address + 1));
+  applySetting(SK_BAND_IDX, 0, EEPROM.read(eeprom_address + 2));
+  applySetting(SK_RDS, 0, EEPROM.read(eeprom_address + 3));
+  applySetting(SK_MODE, 0, EEPROM.read(eeprom_address + 4));
+  applySetting(SK_BFO, 0, (EEPROM.read(eeprom_address + 5) << 8) | EEPROM.read(eeprom_address + 6));
+  applySetting(SK_SOFTMUTE, 0, EEPROM.read(eeprom_address + 7));
+  applySetting(SK_AGC, 0, EEPROM.read(eeprom_address + 8));
+  applySetting(SK_REGION, 0, EEPROM.read(eeprom_address + 9));
+  uint8_t ac = EEPROM.read(eeprom_address + 10);
+  applySetting(SK_ANTCAP, 0, (ac == 0xFF) ? 1 : ac);
+
+  int addr_offset = 11;
+  for (int i = 0; i <= lastBand; i++) {
+    uint32_t v = (uint32_t)EEPROM.read(addr_offset++) << 24;
+    v |= (uint32_t)EEPROM.read(addr_offset++) << 16;
+    v |= (uint32_t)EEPROM.read(addr_offset++) << 8;
+    v |= EEPROM.read(addr_offset++);
+    applySetting(SK_BAND, i, v);
+  }
+  EEPROM.end();
+  return true;
+}
+
+// Gespeicherten Stand in die globalen Variablen laden. false = nichts gespeichert.
+bool loadReceiverInformation() {
+  if (settingsReplay(applySetting)) return true;
+  if (!importLegacyEeprom()) return false;
+  currentFrequency = bandState[bandIdx].currentFreq;
+  // Erst speichern, wenn der Radio-Task den Chip gestartet hat (Lautstärke kommt aus rx)
+  resetEepromDelay();
+  return true;
+}
+
+// Geladenen Stand auf den Empfänger anwenden
+void readAllReceiverInformation() {
+  int bwIdx;
+
+  currentFrequency = bandState[bandIdx].currentFreq;
+
+  if (bandDesc[bandIdx].type == FM_BAND_TYPE) {
+    currentStepIdx = idxFmStep = bandState[bandIdx].currentStepIdx;
+    rx.setFrequencyStep(tabFmStep[currentStepIdx]);
+  } else {
+    currentStepIdx = idxAmStep = bandState[bandIdx].currentStepIdx;
+    rx.setFrequencyStep(tabAmStep[currentStepIdx]);
+  }
+
+  bwIdx = bandState[bandIdx].bandwidthIdx;
+
+  // Ohne Patch in AM weiter; das folgende useBand() zeigt "SSB?"
+  if ((currentMode == LSB || currentMode == USB) && !ssbEnsure()) ssbFallback();
+  if (currentMode == LSB || currentMode == USB) {
+    bwIdxSSB = (bwIdx > 5) ? 5 : bwIdx;
+    rx.setSSBAudioBandwidth(bandwidthSSB[bwIdxSSB].idx);
+    if (bandwidthSSB[bwIdxSSB].idx == 0 || bandwidthSSB[bwIdxSSB].idx == 4 || bandwidthSSB[bwIdxSSB].idx == 5)
+      rx.setSSBSidebandCutoffFilter(0);
+    else
+      rx.setSSBSidebandCutoffFilter(1);
+  } else if (currentMode == AM) {
+    bwIdxAM = bwIdx;
+    rx.setBandwidth(bandwidthAM[bwIdxAM].idx, 1);
+  } else {
+    bwIdxFM = bwIdx;
+    rx.setFmBandwidth(bandwidthFM[bwIdxFM].idx);
+  }
+
+  delay(50);
+  rx.setVolume(volume);
+  rx.setSeekAmSpacing(getSeekSpacingForCurrentBand());
+}
+
+// ========= State helpers =========
+void resetEepromDelay() {
+  elapsedCommand = storeTime = millis();
+  itIsTimeToSave = true;
+}
+
+void disableCommands() {
+  cmdBand = false; bfoOn = false; cmdVolume = false; cmdAgc = false;
+  cmdBandwidth = false; cmdStep = false; cmdMode = false;
+  cmdMenu = false; cmdSoftMuteMaxAtt = false; cmdRds = false; cmdRegion = false; cmdAntcap = false;
+  oledEdit = false;
+}
+
+// ========= Band-Scan =========
+
+static struct {
+  bool     active;
+  uint16_t f, maxF, step, settleMs;
+  uint8_t  band, prevBandIdx;
+  uint32_t tunedAt;
+} sweep;
+
+void scanFinishSweep() {
+  if (!sweep.active) return;
+  sweep.active = false;
+  rxSetTuneDelay(TUNE_DELAY_DEFAULT);
+  // Vorheriges Band samt Modus und Frequenz wiederherstellen
+  bandIdx = sweep.prevBandIdx;
+  useBand();
+  scan.running.store(false, std::memory_order_release);
+}
+
+// Startet einen Scan mit den Parametern aus scan.req. Raster wie beim Abstimmen:
+// MW-Rundfunk nach Region, CB im 10-kHz-Raster, sonst Schrittweite des Bandes.
+void scanStartSweep() {
+  scanFinishSweep();
+  const ScanRequest &r = scan.req;
+  scan.count.store(0, std::memory_order_relaxed);
+  scan.generation.fetch_add(1, std::memory_order_release);
+
+  const int i = (r.bandIdx <= lastBand) ? r.bandIdx : bandIdx;
+  const BandDesc &b = bandDesc[i];
+  const bool fm = (b.type == FM_BAND_TYPE);
+  uint16_t minF = (r.minF > b.minimumFreq) ? r.minF : b.minimumFreq;
+  uint16_t maxF = (r.maxF && r.maxF < b.maximumFreq) ? r.maxF : b.maximumFreq;
+  uint16_t step = r.step;
+  uint16_t f0 = minF;
+
+  if (!fm && isBroadcastMWBandIdx(i)) {
+    if (!step) step = getAmSpacing();
+    f0 = alignMwToRegion(minF, 0, 0xFFFF, amRegion);
+    if (f0 < minF) f0 += getAmSpacing();
+  } else if (!fm && isCBBandIdx(i)) {
+    if (!step) step = b.gridSpacing;
+    f0 = alignToGrid(minF, b.gridBase, b.gridSpacing, 0, 0xFFFF);
+    if (f0 < minF) f0 += b.gridSpacing;
+  } else if (!step) {
+    step = fm ? tabFmStep[bandState[i].currentStepIdx] : tabAmStep[bandState[i].currentStepIdx];
+  }
+
+  if (f0 > maxF) { scan.running.store(false, std::memory_order_release); return; }
+  if ((uint32_t)(maxF - f0) / step >= SCAN_MAX_POINTS) maxF = f0 + (SCAN_MAX_POINTS - 1) * step;
+
+  bandState[bandIdx].currentFreq = currentFrequency;
+  bandState[bandIdx].currentStepIdx = currentStepIdx;
+  sweep.prevBandIdx = bandIdx;
+
+  // Abstimmen ohne Library-Wartezeit; die Messung wartet nicht blockierend settleMs
+  rxSetTuneDelay(0);
+  // Kapazität aus dem Cache des gescannten Bandes, nicht des eingestellten
+  antcapPrepare(i, f0);
+  if (fm) {
+    rx.setFM(b.minimumFreq, b.maximumFreq, f0, step);
+    siPowered(SI_POWER_FM);
+  } else {
+    rx.setAM(b.minimumFreq, b.maximumFreq, f0, step);
+    siPowered(SI_POWER_AM);
+    rx.setBandwidth(bandwidthAM[bwIdxAM].idx, 1);
+  }
+
+  sweep.band = i;
+  sweep.f = f0;
+  sweep.maxF = maxF;
+  sweep.step = step;
+  sweep.settleMs = r.settleMs;
+  sweep.tunedAt = millis();
+  sweep.active = true;
+  scan.running.store(true, std::memory_order_release);
+  showCommandStatus((char *) "Scan");
+}
+
+static void scanService() {
+  if (!sweep.active) return;
+  if ((millis() - sweep.tunedAt) < sweep.settleMs) return;
+
+  {
+    I2C_SCOPE(m, I2C_DEV_SI4735, I2C_OP_RSQ, 0);
+    rx.getCurrentReceivedSignalQuality();
+  }
+  uint16_t n = scan.count.load(std::memory_order_relaxed);
+  scan.rec[n].freq = sweep.f;
+  scan.rec[n].rssi = rx.getCurrentRSSI();
+  scan.rec[n].snr  = rx.getCurrentSNR();
+  scan.count.store(n + 1, std::memory_order_release);
+
+  if ((uint32_t)sweep.f + sweep.step > sweep.maxF || n + 1 >= SCAN_MAX_POINTS) {
+    scanFinishSweep();
+    return;
+  }
+  sweep.f += sweep.step;
+  rxSetFrequency(sweep.f, sweep.band);
+  sweep.tunedAt = millis();
+}
+
+// ========= Kanal-Scan =========
+// Läuft mscan.req.ch zyklisch ab. Gleiches Band und gleicher Modus: nur
+// rx.setFrequency, sonst ein useBand() mit vorbereitetem Bandzustand.
+static struct {
+  bool      active;
+  uint8_t   state;             // MemScanState
+  uint16_t  idx;
+  uint32_t  tunedAt, heldAt, belowAt, polledAt, busyFrom;
+  bool      below;
+  uint8_t   prevBandIdx, prevMode;
+  int16_t   prevBfo;
+  BandState prevState[BAND_COUNT];
+} msc;
+
+static void mscanTune(uint16_t i) {
+  const MemScanChannel &ch = mscan.req.ch[i];
+  const bool ssb = (ch.mode == LSB || ch.mode == USB);
+  if (ch.bandIdx != bandIdx || ch.mode != currentMode) {
+    bandState[bandIdx].currentFreq = currentFrequency;
+    bandState[bandIdx].currentStepIdx = currentStepIdx;
+    bandIdx = ch.bandIdx;
+    BandState &b = bandState[bandIdx];
+    b.currentFreq = ch.freq;
+    if (ch.bwIdx != MSCAN_BW_KEEP) b.bandwidthIdx = ch.bwIdx;
+    else if (ssb && b.bandwidthIdx > maxSsbBw) b.bandwidthIdx = maxSsbBw;
+    currentMode = ch.mode;
+    if (ssb) currentBFO = ch.bfo;
+    useBand();
+  } else {
+    if (ch.bwIdx != MSCAN_BW_KEEP && ch.bwIdx != bandState[bandIdx].bandwidthIdx) setBandwidthIdx(ch.bwIdx);
+    if (ssb && ch.bfo != currentBFO) { currentBFO = ch.bfo; rx.setSSBBfo(currentBFO); }
+    rxSetFrequency(ch.freq);
+    showFrequencySeek(ch.freq);
+  }
+  if (rx.isCurrentTuneFM()) rdsResetTop();
+  msc.idx = i;
+  msc.state = MSCAN_TUNE;
+  msc.tunedAt = millis();
+  mscan.current.store(i, std::memory_order_relaxed);
+  mscan.state.store(MSCAN_TUNE, std::memory_order_relaxed);
+}
+
+static void mscanNext() {
+  uint16_t i = msc.idx + 1;
+  if (i >= mscan.req.count) {
+    i = 0;
+    mscan.passes.fetch_add(1, std::memory_order_relaxed);
+  }
+  mscanTune(i);
+}
+
+// Auf einem Treffer anhalten lässt Band und Frequenz dort, sonst wird der
+// Zustand vor dem Scan wiederhergestellt
+void mscanStop() {
+  if (!msc.active) return;
+  msc.active = false;
+  rxSetTuneDelay(TUNE_DELAY_DEFAULT);
+  if (msc.state == MSCAN_HOLD) {
+    const uint8_t keep = bandIdx;
+    const BandState cur = bandState[keep];
+    memcpy(bandState, msc.prevState, sizeof(bandState));
+    bandState[keep] = cur;
+    bandState[keep].currentFreq = currentFrequency;
+  } else {
+    memcpy(bandState, msc.prevState, sizeof(bandState));
+    bandIdx = msc.prevBandIdx;
+    currentMode = msc.prevMode;
+    currentBFO = msc.prevBfo;
+    useBand();
+  }
+  mscan.state.store(MSCAN_IDLE, std::memory_order_relaxed);
+  mscan.running.store(false, std::memory_order_release);
+}
+
+void mscanStart() {
+  mscanStop();
+  const MemScanRequest &r = mscan.req;
+  memset(mscan.stat, 0, sizeof(mscan.stat));
+  mscan.measured.store(0, std::memory_order_relaxed);
+  mscan.hits.store(0, std::memory_order_relaxed);
+  mscan.passes.store(0, std::memory_order_relaxed);
+  mscan.busyMs.store(0, std::memory_order_relaxed);
+  mscan.startedMs.store(millis(), std::memory_order_relaxed);
+  if (r.count == 0) { mscan.running.store(false, std::memory_order_release); return; }
+
+  bandState[bandIdx].currentFreq = currentFrequency;
+  bandState[bandIdx].currentStepIdx = currentStepIdx;
+  memcpy(msc.prevState, bandState, sizeof(bandState));
+  msc.prevBandIdx = bandIdx;
+  msc.prevMode = currentMode;
+  msc.prevBfo = currentBFO;
+
+  // Kanäle aus src=bands: letzte Frequenz des Bandes
+  for (uint16_t i = 0; i < r.count; i++) {
+    MemScanChannel &c = mscan.req.ch[i];
+    if (c.freq == MSCAN_FREQ_BAND) c.freq = bandState[c.bandIdx].currentFreq;
+  }
+
+  // Abstimmen ohne Library-Wartezeit; die Messung wartet nicht blockierend settleMs
+  rxSetTuneDelay(0);
+  msc.active = true;
+  msc.busyFrom = millis();
+  showCommandStatus((char *) "MScan");
+  mscanTune(0);
+}
+
+static bool mscanMeasure(uint8_t &rssiOut, uint8_t &snrOut) {
+  {
+    I2C_SCOPE(m, I2C_DEV_SI4735, I2C_OP_RSQ, 0);
+    rx.getCurrentReceivedSignalQuality();
+  }
+  rssiOut = rx.getCurrentRSSI();
+  snrOut  = rx.getCurrentSNR();
+  MemScanStat &st = mscan.stat[msc.idx];
+  st.rssi = rssiOut;
+  st.snr  = snrOut;
+  if (rssiOut > st.peakRssi) st.peakRssi = rssiOut;
+  return rssiOut >= mscan.req.squelchRssi && snrOut >= mscan.req.minSnr;
+}
+
+static void mscanService() {
+  if (!msc.active) return;
+  const uint32_t now = millis();
+  uint8_t r, s;
+
+  if (msc.state == MSCAN_TUNE) {
+    if ((now - msc.tunedAt) < mscan.req.settleMs) return;
+    const bool open = mscanMeasure(r, s);
+    mscan.measured.fetch_add(1, std::memory_order_relaxed);
+    mscan.busyMs.fetch_add(now - msc.busyFrom, std::memory_order_relaxed);
+    msc.busyFrom = now;
+    if (!open) { mscanNext(); return; }
+
+    mscan.stat[msc.idx].hits++;
+    mscan.hits.fetch_add(1, std::memory_order_relaxed);
+    msc.state = MSCAN_HOLD;
+    msc.heldAt = msc.polledAt = now;
+    msc.below = false;
+    mscan.state.store(MSCAN_HOLD, std::memory_order_relaxed);
+    return;
+  }
+
+  // Halten: weiter bei abgelaufener Haltezeit oder hangMs lang unter der Sperre
+  if ((now - msc.polledAt) < MSCAN_HOLD_POLL_MS) return;
+  msc.polledAt = now;
+  if (mscanMeasure(r, s)) {
+    msc.below = false;
+  } else if (!msc.below) {
+    msc.below = true;
+    msc.belowAt = now;
+  }
+  const bool dwellOver = mscan.req.dwellMs && (now - msc.heldAt) >= mscan.req.dwellMs;
+  const bool hangOver  = msc.below && (now - msc.belowAt) >= mscan.req.hangMs;
+  if (dwellOver || hangOver) {
+    msc.busyFrom = now;
+    mscanNext();
+  }
+}
+
+// ========= Moduswechsel-Benchmark =========
+// Läuft modeBenchPath ab und misst jeden Wechsel über denselben Einstieg wie
+// die Bedienung: AM/LSB/USB untereinander mit doMode() (Taste, Encoder,
+// /api/mode), von und nach FM mit useBand() in einem FM- bzw. AM-Band wie bei
+// der Bandwahl. Beide enthalten ihre Wartezeit und das Neuzeichnen des OLED.
+// Danach werden Band, Modus und Frequenz von vorher wiederhergestellt.
+static struct {
+  bool      active;
+  uint8_t   rounds, round, step;
+  uint8_t   fmBand, amBand;
+  uint8_t   prevBandIdx, prevMode;
+  int16_t   prevBfo;
+  BandState prevState[BAND_COUNT];
+} mbn;
+
+static void mbenchBand(uint8_t mode) {
+  bandIdx = (mode == FM) ? mbn.fmBand : mbn.amBand;
+  currentMode = mode;
+  useBand();
+}
+
+static void mbenchSwitch(uint8_t from, uint8_t to) {
+  if (from == FM || to == FM) { mbenchBand(to); return; }
+  // doMode(1) schaltet AM -> LSB -> USB -> AM, doMode(-1) rückwärts
+  const uint8_t next = (from == AM) ? LSB : (from == LSB) ? USB : AM;
+  doMode((to == next) ? 1 : -1);
+}
+
+void mbenchStop() {
+  if (!mbn.active) return;
+  mbn.active = false;
+  memcpy(bandState, mbn.prevState, sizeof(bandState));
+  bandIdx = mbn.prevBandIdx;
+  currentMode = mbn.prevMode;
+  currentBFO = mbn.prevBfo;
+  useBand();
+  oledShowFrequencyScreen();
+  mbench.running.store(false, std::memory_order_release);
+}
+
+void mbenchStart(uint8_t rounds) {
+  mbenchStop();
+  if (rounds < 1) rounds = 1;
+  if (rounds > MBENCH_ROUNDS_MAX) rounds = MBENCH_ROUNDS_MAX;
+  modeBenchReset(rounds);
+
+  // Das aktuelle Band, sonst das erste FM- bzw. AM-Band der Tabelle
+  int fm = -1, am = -1;
+  for (int i = 0; i <= lastBand; i++) {
+    if (bandDesc[i].type == FM_BAND_TYPE) { if (fm < 0) fm = i; }
+    else if (am < 0) am = i;
+  }
+  if (bandDesc[bandIdx].type == FM_BAND_TYPE) fm = bandIdx;
+  else am = bandIdx;
+  if (fm < 0 || am < 0) { mbench.running.store(false, std::memory_order_release); return; }
+
+  bandState[bandIdx].currentFreq = currentFrequency;
+  bandState[bandIdx].currentStepIdx = currentStepIdx;
+  memcpy(mbn.prevState, bandState, sizeof(bandState));
+  mbn.prevBandIdx = bandIdx;
+  mbn.prevMode = currentMode;
+  mbn.prevBfo = currentBFO;
+  if (bandState[am].bandwidthIdx > maxSsbBw) bandState[am].bandwidthIdx = maxSsbBw;
+
+  mbn.fmBand = fm;
+  mbn.amBand = am;
+  mbn.rounds = rounds;
+  mbn.round = 0;
+  mbn.step = 0;
+  mbn.active = true;
+  showCommandStatus((char *) "Bench");
+  mbenchBand(modeBenchPath[0]);     // Ausgangsmodus, nicht gemessen
+}
+
+// Ein gemessener Wechsel je Schleifendurchlauf
+static void mbenchService() {
+  if (!mbn.active) return;
+  const uint8_t from = modeBenchPath[mbn.step];
+  const uint8_t to   = modeBenchPath[mbn.step + 1];
+  const uint32_t loads = modesw.patchLoads.load(std::memory_order_relaxed);
+  const uint32_t t0 = micros();
+  mbenchSwitch(from, to);
+  modeBenchRecord(from, to, micros() - t0, modesw.patchLoads.load(std::memory_order_relaxed) != loads);
+  if (++mbn.step < MBENCH_PATH_LEN - 1) return;
+  mbn.step = 0;
+  if (++mbn.round >= mbn.rounds) mbenchStop();
+}
+
+// ========= Speicherkanäle =========
+static bool bandCovers(int i, bool fm, uint16_t f) {
+  return ((bandDesc[i].type == FM_BAND_TYPE) == fm) && f >= bandDesc[i].minimumFreq && f <= bandDesc[i].maximumFreq;
+}
+
+// Kanal abrufen: passendes Band (aktuelles bevorzugt, sonst das schmalste), dann Modus, Schritt, Bandbreite und BFO
+static void memRecallSlot(uint16_t slot) {
+  MemRecord m;
+  if (!memRead(slot, m)) return;
+  const bool fm = (m.mode == FM);
+  const int idx = bandCovers(bandIdx, fm, m.freq) ? bandIdx : bandFind(fm, m.freq);
+  if (idx < 0) return;
+
+  bandState[bandIdx].currentFreq = currentFrequency;
+  bandState[bandIdx].currentStepIdx = currentStepIdx;
+  bandIdx = idx;
+  BandState &b = bandState[bandIdx];
+  b.currentFreq = m.freq;
+  if (m.stepIdx <= (fm ? lastFmStep : lastAmStep)) b.currentStepIdx = m.stepIdx;
+  const int8_t maxBw = fm ? maxFmBw : (m.mode == LSB || m.mode == USB) ? maxSsbBw : maxAmBw;
+  if (m.bwIdx <= maxBw) b.bandwidthIdx = m.bwIdx;
+  if (!fm) {
+    currentMode = (m.mode == LSB || m.mode == USB) ? m.mode : AM;
+    if (currentMode != AM) currentBFO = m.bfo;
+  }
+  useBand();
+}
+
+// ========= Batch =========
+// Ein Batch aus der Web-Queue als eine Transaktion: erst vollständig prüfen,
+// dann bei Band- oder Moduswechsel genau ein useBand() mit vorbereitetem
+// Bandzustand, sonst nur die Befehle für tatsächlich geänderte Werte.
+static uint32_t batchDoneId = 0;
+static RadioBatchResult batchDone[RADIO_BATCH_RESULTS];
+
+static void batchApply(uint32_t id) {
+  RadioBatch b;
+  if (!radioPollBatch(id, b)) return;
+  batchDoneId = id;
+  uint8_t mode;
+  const uint8_t err = radioBatchCheck(b, bandIdx, currentMode, mode);
+  batchDone[id % RADIO_BATCH_RESULTS] = { id, err };
+  if (err != RBE_OK) return;
+
+  const uint8_t band = (b.has & RB_BAND) ? b.band : bandIdx;
+  const bool fm  = (bandDesc[band].type == FM_BAND_TYPE);
+  const bool ssb = (mode == LSB || mode == USB);
+  const bool agcChanged = (b.has & RB_AGC) && b.agcIdx != agcIdx;
+  const bool bfoChanged = (b.has & RB_BFO) && b.bfo != currentBFO;
+  if (b.has & RB_BFO) currentBFO = b.bfo;
+  if (b.has & RB_STEP) {
+    if (fm) idxFmStep = b.stepIdx;
+    else    idxAmStep = b.stepIdx;
+  }
+
+  if (band != bandIdx || mode != currentMode) {
+    bandState[bandIdx].currentFreq = currentFrequency;
+    bandState[bandIdx].currentStepIdx = currentStepIdx;
+    bandIdx = band;
+    BandState &s = bandState[bandIdx];
+    if (b.has & RB_FREQ) s.currentFreq = b.freq;
+    if (b.has & RB_STEP) s.currentStepIdx = b.stepIdx;
+    if (b.has & RB_BW)   s.bandwidthIdx = b.bwIdx;
+    else if (ssb && s.bandwidthIdx > maxSsbBw) s.bandwidthIdx = maxSsbBw;
+    if (agcChanged) {
+      // useBand() setzt die AGC nur außerhalb von FM
+      agcIdx = b.agcIdx;
+      disableAgc = (agcIdx > 0);
+      agcNdx = (agcIdx > 1) ? (agcIdx - 1) : 0;
+    }
+    currentMode = mode;
+    useBand();
+    if (agcChanged && fm) rx.setAutomaticGainControl(disableAgc, agcNdx);
+  } else {
+    I2C_SCOPE(m, I2C_DEV_SI4735, I2C_OP_CONFIG, 0);
+    if ((b.has & RB_STEP) && b.stepIdx != currentStepIdx) {
+      currentStepIdx = b.stepIdx;
+      if (fm) {
+        rx.setFrequencyStep(tabFmStep[currentStepIdx]);
+      } else {
+        rx.setFrequencyStep(tabAmStep[currentStepIdx]);
+        rx.setSeekAmSpacing(getSeekSpacingForCurrentBand());
+      }
+      bandState[bandIdx].currentStepIdx = currentStepIdx;
+    }
+    if ((b.has & RB_BW) && b.bwIdx != bandState[bandIdx].bandwidthIdx) setBandwidthIdx(b.bwIdx);
+    if (agcChanged) setAgcIdx(b.agcIdx);
+    if (bfoChanged && ssb) rx.setSSBBfo(currentBFO);
+    if ((b.has & RB_FREQ) && b.freq != currentFrequency) {
+      currentFrequency = b.freq;
+      rxSetFrequency(currentFrequency);
+    }
+    oledShowFrequencyScreen();
+  }
+  if ((b.has & RB_VOLUME) && b.volume != rx.getVolume()) rx.setVolume(b.volume);
+  elapsedCommand = millis();
+}
+
+// ========= Radio-Task =========
+// Kommandos aus der Web-Queue ausführen (läuft im Radio-Task)
+static void radioExecute(const RadioCmd &c) {
+  if (c.type == RCMD_SCAN_START) { seekStop(true); mscanStop(); mbenchStop(); scanStartSweep(); return; }
+  // Jedes andere Kommando beendet einen laufenden Scan, Benchmark bzw. Seek
+  scanFinishSweep();
+  mscanStop();
+  mbenchStop();
+  if (c.type == RCMD_MSCAN_START) { seekStop(true); mscanStart(); return; }
+  if (c.type == RCMD_MBENCH_START) { seekStop(true); mbenchStart((uint8_t) c.arg); return; }
+  if (c.type == RCMD_SEEK_START) { seekStart((c.arg > 0) ? 1 : 0); return; }
+  seekStop(true);
+  if (c.type == RCMD_SCAN_STOP || c.type == RCMD_MSCAN_STOP || c.type == RCMD_SEEK_CANCEL) return;
+
+  switch (c.type) {
+    case RCMD_SET_FREQ:   setFrequencySafe((uint16_t)c.arg); break;
+    case RCMD_SET_FREQ_HZ: if (c.arg > 0) setFrequencyHz((uint32_t)c.arg); break;
+    case RCMD_TUNE_DELTA: tuneDelta(c.arg); break;
+    case RCMD_SET_BAND:   if (c.arg >= 0 && c.arg <= lastBand && c.arg != bandIdx) setBandIndex((uint8_t)c.arg); break;
+    case RCMD_BAND_STEP:  setBand((c.arg >= 0) ? 1 : -1); oledShowFrequencyScreen(); break;
+    case RCMD_MODE_STEP:  doMode((c.arg >= 0) ? 1 : -1); break;
+    case RCMD_MEM_RECALL: if (c.arg >= 0) memRecallSlot((uint16_t)c.arg); break;
+    case RCMD_BATCH:      batchApply((uint32_t)c.arg); break;
+    default: break;
+  }
+  resetEepromDelay();
+}
+
+// Zustand für Web-Handler veröffentlichen (nur bei Änderung)
+void radioPublishState() {
+  static RadioSnapshot last;
+  RadioSnapshot s;
+  memset(&s, 0, sizeof(s));
+  s.freq    = currentFrequency;
+  s.freqHz  = currentFrequencyHz();
+  s.mode    = currentMode;
+  s.bandIdx = bandIdx;
+  s.rssi    = rssi;
+  s.snr     = snr;
+  s.volume  = rx.getVolume();
+  s.isFM    = rx.isCurrentTuneFM();
+  s.pilot   = s.isFM && rx.getCurrentPilot();
+  s.stepKHz = s.isFM ? (tabFmStep[currentStepIdx] * 10) : tabAmStep[currentStepIdx];
+  s.bfo     = currentBFO;
+  s.seeking = seekSm.active;
+  s.stepIdx = currentStepIdx;
+  s.bwIdx   = bandState[bandIdx].bandwidthIdx;
+  s.agcIdx  = agcIdx;
+  s.batchId = batchDoneId;
+  memcpy(s.batchRes, batchDone, sizeof(s.batchRes));
+  if (s.isFM) { strncpy(s.ps, rdsPSShown, sizeof(s.ps)); s.ps[8] = '\0'; }
+
+  // Nächster Speicherkanal; Index-Suche und Namenslesen nur bei Änderung
+  static uint16_t memFreq = 0;
+  static bool     memFM = false;
+  static uint32_t memGen = 0;
+  static int16_t  memSlot = -1;
+  static char     memName[sizeof(s.memName)] = "";
+  const uint32_t gen = memGeneration();
+  // Beim Booten kann der Index der Speicherkanäle noch fehlen
+  static bool memReady = false;
+  if (!memReady && bootStageDone(BOOT_ST_MEMORIES)) { memReady = true; memGen = gen - 1; }
+  if (memReady && (s.freq != memFreq || s.isFM != memFM || gen != memGen)) {
+    memFreq = s.freq; memFM = s.isFM; memGen = gen;
+    const uint16_t dist = s.isFM ? tabFmStep[currentStepIdx] : tabAmStep[currentStepIdx];
+    MemRecord m;
+    memSlot = memNearest(s.isFM, s.freq, dist);
+    if (memSlot < 0 || !memRead(memSlot, m)) { memSlot = -1; memName[0] = '\0'; }
+    else { strncpy(memName, m.name, sizeof(memName)); memName[sizeof(memName) - 1] = '\0'; }
+  }
+  s.memSlot = memSlot;
+  memcpy(s.memName, memName, sizeof(s.memName));
+  if (memcmp(&s, &last, sizeof(s)) == 0) return;
+  last = s;
+  radioPublish(s);
+}
+
+static void radioService();
+
+void radioTask(void *) {
+  radioBoot();
+  for (;;) {
+    PERF_LOOP_BEGIN();
+    RadioCmd c;
+    while (radioPoll(c)) radioExecute(c);
+    PERF_LAP(PERF_ST_CMD);
+    radioService();
+    oledFlush();
+    PERF_LAP(PERF_ST_FLUSH);
+    radioPublishState();
+    PERF_LAP(PERF_ST_PUBLISH);
+    PERF_LOOP_END();
+    vTaskDelay(pdMS_TO_TICKS(5));
+  }
+}
+
+// ========= Loop =========
+// Der Arduino-Loop fasst rx/OLED nicht mehr an, er verteilt nur den Status
+void loop() {
+  WebUI::loop();
+  delay(5);
+}
+
+// Gesten des Encoder-Tasters:
+//   Klick:          im Menü Punkt wählen, sonst Editor/BFO verlassen bzw. Bandwahl umschalten
+//   Doppelklick:    Menü öffnen/schließen
+//   Lang:           zurück zur Frequenzanzeige
+//   Drücken+Drehen: Lautstärke
+static void handleButtonEvent(const ButtonEvent &ev) {
+  switch (ev.type) {
+    case BTN_CLICK:
+      if (cmdMenu) {
+        currentMenuCmd = menuIdx;
+        doCurrentMenuCmd();
+      } else if (oledEdit || isMenuMode()) {   // schließt auch den BFO-Modus
+        leaveEditScreen();
+      } else {
+        cmdBand = !cmdBand;
+        showCommandStatus((char *)"Band");
+      }
+      break;
+    case BTN_DOUBLE: {
+      const bool open = !cmdMenu;
+      disableCommands();
+      cmdMenu = open;
+      if (cmdMenu) showMenu();
+      else         oledShowFrequencyScreen();
+      break;
+    }
+    case BTN_LONG:
+      leaveEditScreen();
+      break;
+    case BTN_PRESS_TURN:
+      if (!cmdVolume) { disableCommands(); cmdVolume = true; enterEditScreen(); }
+      break;
+    default:
+      return;
+  }
+  elapsedCommand = millis();
+}
+
+static void radioService() {
+  int32_t encoderCount = encoderDrain();
+  const int8_t encDir = (encoderCount > 0) ? 1 : -1;
+  const int32_t encSteps = abs(encoderCount);
+
+  // Drehen am Encoder bricht Scan, Benchmark bzw. Seek ab
+  if ((sweep.active || seekSm.active || msc.active || mbn.active) && encoderCount != 0) {
+    scanFinishSweep();
+    mscanStop();
+    mbenchStop();
+    seekStop(true);
+    encoderCount = 0;
+  }
+  scanService();
+  mscanService();
+  mbenchService();
+  seekService();
+  PERF_LAP(PERF_ST_SCAN);
+
+  // Taster: Gesten auswerten; Drehen bei gedrücktem Taster öffnet den Lautstärke-Editor
+  if (encoderCount != 0) buttonTurn(encoderCount);
+  buttonSetDoubleClick(!cmdMenu);
+  buttonService();
+  ButtonEvent ev;
+  while (buttonPoll(ev)) handleButtonEvent(ev);
+
+  if (encoderCount != 0) {
+    if (bfoOn && isSSBMode()) {
+      fineTuneHz((int32_t) currentFrequencyHz() + encoderCount * encoderAccel(encoderCount) * currentBFOStep);
+#if DEBUG_SSB
+      Serial.printf("[SSB] fine: BFO=%d (step=%u Hz) @ f=%u kHz\n", (int)currentBFO, (unsigned)currentBFOStep, currentFrequency);
+#endif
+      if (oledEdit) {
+        char hzText[16];
+        formatFreqHz(hzText, sizeof(hzText), currentFrequencyHz());
+        oled.clearDisplay(); oled.setCursor(0,0); oled.print("BFO"); oled.setCursor(0,16); oled.print(hzText); oledRequestFlush();
+      }
+    } else if (cmdMenu) {
+      for (int32_t i = 0; i < encSteps; i++) doMenu(encDir);
+    } else if (cmdMode) {
+      doMode(encDir);
+      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("Mode"); oled.setCursor(0,16); oled.print((currentMode==FM)?"FM":(currentMode==AM)?"AM":(currentMode==LSB)?"LSB":"USB"); oledRequestFlush(); }
+    } else if (cmdStep) {
+      for (int32_t i = 0; i < encSteps; i++) doStep(encDir);
+      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("Step"); oled.setCursor(0,16); oled.print((currentMode==FM)? (tabFmStep[currentStepIdx]*10) : tabAmStep[currentStepIdx]); oledRequestFlush(); }
+    } else if (cmdAgc) {
+      for (int32_t i = 0; i < encSteps; i++) doAgc(encDir);
+      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("AGC/Att"); oled.setCursor(0,16); oled.print((disableAgc)?agcNdx:0); oledRequestFlush(); }
+    } else if (cmdBandwidth) {
+      for (int32_t i = 0; i < encSteps; i++) doBandwidth(encDir);
+      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("BW"); oled.setCursor(0,16); oled.print((currentMode==AM)? bandwidthAM[bwIdxAM].desc : (currentMode==FM)? bandwidthFM[bwIdxFM].desc : bandwidthSSB[bwIdxSSB].desc); oledRequestFlush(); }
+    } else if (cmdVolume) {
+      for (int32_t i = 0; i < encSteps; i++) doVolume(encDir);
+      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("Volume"); oled.setCursor(0,16); oled.print((int)rx.getVolume()); oledRequestFlush(); }
+    } else if (cmdSoftMuteMaxAtt) {
+      for (int32_t i = 0; i < encSteps; i++) doSoftMute(encDir);
+      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("SoftMute"); oled.setCursor(0,16); oled.print(softMuteMaxAttIdx); oledRequestFlush(); }
+    } else if (cmdRegion) {
+      doRegion(encDir);
+    } else if (cmdRds) {
+      fmRDS = !fmRDS;
+      rdsResetTop();
+      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("RDS"); oled.setCursor(0,16); oled.print(fmRDS?"ON":"OFF"); oledRequestFlush(); }
+      resetEepromDelay();
+      elapsedCommand = millis();
+    } else if (cmdAntcap) {
+      antcapAuto = !antcapAuto;
+      if (!rx.isCurrentTuneFM()) rxSetFrequency(currentFrequency);
+      if (oledEdit) { oled.clearDisplay(); oled.setCursor(0,0); oled.print("ANTCAP"); oled.setCursor(0,16); oled.print(antcapAuto?"Auto":"Hold"); oledRequestFlush(); }
+      resetEepromDelay();
+      elapsedCommand = millis();
+    } else if (cmdBand) {
+      // Mehrere Rastungen: direkt zum Zielband statt über jedes Zwischenband
+      int32_t target = ((int32_t) bandIdx + encoderCount) % (lastBand + 1);
+      if (target < 0) target += lastBand + 1;
+      setBandIndex((uint8_t) target);
+    } else {
+      uint16_t prev = currentFrequency;
+      tuneByDetents(encoderCount);
+      if (rx.isCurrentTuneFM() && currentFrequency != prev) {
+        rdsResetTop();
+      }
+      if (!isMenuMode() && !oledEdit) {
+        oledShowFrequencyScreen();
+      }
+    }
+    resetEepromDelay();
+  }
+  PERF_LAP(PERF_ST_INPUT);
+
+  // Signalqualität: Verlauf im eigenen Abstand (nicht während Scans und Seek),
+  // Anzeige und Snapshot weiterhin alle MIN_ELAPSED_RSSI_TIME * 6
+  const uint32_t now = millis();
+  const bool histDue = !sweep.active && !seekSm.active && !msc.active && !mbn.active && historyDue(now);
+  const bool showDue = (now - elapsedRSSI) > MIN_ELAPSED_RSSI_TIME * 6;
+  if (histDue || showDue) {
+    {
+      I2C_SCOPE(m, I2C_DEV_SI4735, I2C_OP_RSQ, 0);
+      rx.getCurrentReceivedSignalQuality();
+    }
+    uint8_t newRssi = rx.getCurrentRSSI();
+    uint8_t newSnr  = rx.getCurrentSNR();
+    if (histDue) {
+      const bool fm = rx.isCurrentTuneFM();
+      historyAdd(now, newRssi, newSnr, currentFrequency, fm, fm && rx.getCurrentPilot());
+    }
+    // Empfang am Lernpunkt der Antennenkapazität eingebrochen: Chip neu suchen lassen
+    if (antcapAuto && !rx.isCurrentTuneFM() && !sweep.active && !seekSm.active && !msc.active && !mbn.active &&
+        (now - antcapTunedMs) >= ANTCAP_SETTLE_MS && antcapRssi(bandIdx, currentFrequency, newRssi)) {
+      rxSetFrequency(currentFrequency);
+    }
+    if (showDue) {
+      if (rssi != newRssi || snr != newSnr) {
+        rssi = newRssi;
+        snr  = newSnr;
+        if (!isMenuMode() && !oledEdit) oledShowRSSI();
+      }
+      elapsedRSSI = now;
+    }
+  }
+  PERF_LAP(PERF_ST_RSSI);
+
+  // RDS-FIFO in Schüben abholen; das Intervall passt Rds.cpp an den Füllstand an
+  if (rx.isCurrentTuneFM() && fmRDS && !seekSm.active) {
+    if (rdsService()) rdsTopRender(rdsLocal().ps);
+  }
+  PERF_LAP(PERF_ST_RDS);
+
+  if ((millis() - elapsedCommand) > ELAPSED_COMMAND) {
+    if (oledEdit || isMenuMode()) {
+      leaveEditScreen();
+    }
+    elapsedCommand = millis();
+  }
+
+  if (itIsTimeToSave) {
+    if ((millis() - storeTime) > STORE_TIME) {
+      saveAllReceiverInformation();
+      storeTime = millis();
+      itIsTimeToSave = false;
+    }
+  }
+  PERF_LAP(PERF_ST_HOUSEKEEP);
+}
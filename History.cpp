@@ -0,0 +1,202 @@
+#include "History.h"
+#include <atomic>
+
+// ===== Zustand =====
+typedef struct {
+  uint32_t n;
+  uint32_t rssiSum, snrSum;
+  uint8_t  rssiMin, rssiMax, snrMin, snrMax;
+  uint16_t pilots;
+  uint16_t freq;
+  uint8_t  flags;
+} HistAcc;
+
+typedef struct {
+  uint32_t    periodMs;
+  uint16_t    len;
+  HistRollup *ring;
+  // Anzahl der Intervalle seit dem Start: das neueste endet bei head * periodMs
+  std::atomic<uint32_t> head;
+  HistAcc     acc;              // laufendes Intervall (nur Radio-Task)
+  uint32_t    accBucket;        // dessen Nummer
+} HistRoll;
+
+static HistSample rawRing[HIST_RAW_LEN];
+static std::atomic<uint32_t> rawHead{0};
+static std::atomic<uint32_t> rawLastMs{0};
+
+static HistRollup ring1s[300], ring10s[360], ring1min[360];
+static HistRoll rolls[HIST_TIER_COUNT - 1] = {
+  { 1000,  300, ring1s,   {0}, {}, 0 },
+  { 10000, 360, ring10s,  {0}, {}, 0 },
+  { 60000, 360, ring1min, {0}, {}, 0 },
+};
+
+static std::atomic<uint16_t> intervalMs{HIST_INTERVAL_MS};
+static uint32_t lastSampleMs = 0;
+static bool     haveSample = false;
+
+// ===== Verdichtung (Radio-Task) =====
+static void accReset(HistAcc &a) {
+  memset(&a, 0, sizeof(a));
+}
+
+static void accAdd(HistAcc &a, uint8_t rssi, uint8_t snr, uint16_t freq, uint8_t flags) {
+  if (a.n == 0 || rssi < a.rssiMin) a.rssiMin = rssi;
+  if (a.n == 0 || snr < a.snrMin)   a.snrMin = snr;
+  if (rssi > a.rssiMax) a.rssiMax = rssi;
+  if (snr > a.snrMax)   a.snrMax = snr;
+  if (a.n && (freq != a.freq || ((flags ^ a.flags) & HIST_F_FM))) a.flags |= HIST_F_RETUNED;
+  a.flags = (a.flags & HIST_F_RETUNED) | (flags & HIST_F_FM);
+  if (flags & HIST_F_PILOT) a.pilots++;
+  a.freq = freq;
+  a.rssiSum += rssi;
+  a.snrSum += snr;
+  a.n++;
+}
+
+static void accStore(const HistAcc &a, HistRollup &r) {
+  memset(&r, 0, sizeof(r));
+  if (a.n == 0) return;
+  r.rssiMin = a.rssiMin;  r.rssiMax = a.rssiMax;  r.rssiAvg = (a.rssiSum + a.n / 2) / a.n;
+  r.snrMin  = a.snrMin;   r.snrMax  = a.snrMax;   r.snrAvg  = (a.snrSum + a.n / 2) / a.n;
+  r.n     = (a.n > 255) ? 255 : a.n;
+  r.flags = a.flags | ((a.pilots * 2 >= a.n) ? HIST_F_PILOT : 0);
+  r.freq  = a.freq;
+}
+
+// Laufendes Intervall abschließen, wenn bucket schon weiter ist; übersprungene
+// Intervalle (Scan, Seek, größerer Abtastabstand) werden leer eingetragen
+static void rollAdvance(HistRoll &t, uint32_t bucket) {
+  if (bucket <= t.accBucket) return;
+  uint32_t h = t.head.load(std::memory_order_relaxed);
+  if (t.accBucket >= h) {
+    if (t.accBucket - h >= t.len) h = t.accBucket - t.len + 1;
+    for (; h < t.accBucket; h++) accStore(HistAcc(), t.ring[h % t.len]);
+    accStore(t.acc, t.ring[h % t.len]);
+    t.head.store(h + 1, std::memory_order_release);
+  }
+  accReset(t.acc);
+  t.accBucket = bucket;
+}
+
+// ===== Abtastung (Radio-Task) =====
+void historyBegin() {
+  const uint32_t now = millis();
+  for (uint8_t i = 0; i < HIST_TIER_COUNT - 1; i++) {
+    HistRoll &t = rolls[i];
+    accReset(t.acc);
+    t.accBucket = now / t.periodMs;
+    t.head.store(t.accBucket, std::memory_order_release);
+  }
+}
+
+bool historyDue(uint32_t now) {
+  return !haveSample || (now - lastSampleMs) >= intervalMs.load(std::memory_order_relaxed);
+}
+
+void historyAdd(uint32_t now, uint8_t rssi, uint8_t snr, uint16_t freq, bool isFM, bool pilot) {
+  HistSample s;
+  const uint32_t dt = haveSample ? now - lastSampleMs : 0;
+  s.dtMs  = (dt > 0xFFFF) ? 0xFFFF : dt;
+  s.rssi  = rssi;
+  s.snr   = snr;
+  s.freq  = freq;
+  s.flags = (isFM ? HIST_F_FM : 0) | (pilot ? HIST_F_PILOT : 0) | ((dt > 0xFFFF) ? HIST_F_GAP : 0);
+  lastSampleMs = now;
+  haveSample = true;
+
+  const uint32_t h = rawHead.load(std::memory_order_relaxed);
+  rawRing[h & (HIST_RAW_LEN - 1)] = s;
+  rawLastMs.store(now, std::memory_order_relaxed);
+  rawHead.store(h + 1, std::memory_order_release);
+
+  for (uint8_t i = 0; i < HIST_TIER_COUNT - 1; i++) {
+    HistRoll &t = rolls[i];
+    rollAdvance(t, now / t.periodMs);
+    accAdd(t.acc, rssi, snr, freq, s.flags);
+  }
+}
+
+// ===== Einstellung (Web-Handler) =====
+void historySetInterval(uint16_t ms) {
+  if (ms < HIST_INTERVAL_MIN) ms = HIST_INTERVAL_MIN;
+  if (ms > HIST_INTERVAL_MAX) ms = HIST_INTERVAL_MAX;
+  intervalMs.store(ms, std::memory_order_relaxed);
+}
+
+uint16_t historyInterval() {
+  return intervalMs.load(std::memory_order_relaxed);
+}
+
+// ===== Binärstrom (Web-Handler) =====
+static inline uint16_t tierLen(uint8_t tier)  { return (tier == HIST_TIER_RAW) ? HIST_RAW_LEN : rolls[tier - 1].len; }
+static inline uint8_t  tierSize(uint8_t tier) { return (tier == HIST_TIER_RAW) ? sizeof(HistSample) : sizeof(HistRollup); }
+
+static inline uint32_t tierHead(uint8_t tier) {
+  return (tier == HIST_TIER_RAW) ? rawHead.load(std::memory_order_acquire)
+                                 : rolls[tier - 1].head.load(std::memory_order_acquire);
+}
+
+void historyOpen(HistCursor &c, uint8_t tier, uint16_t maxRecords) {
+  if (tier >= HIST_TIER_COUNT) tier = HIST_TIER_1S;
+  memset(&c, 0, sizeof(c));
+  c.tier = tier;
+
+  uint32_t h, lastMs;
+  if (tier == HIST_TIER_RAW) {
+    // head und Zeitpunkt der neuesten Messung müssen zusammenpassen
+    do {
+      h = rawHead.load(std::memory_order_acquire);
+      lastMs = rawLastMs.load(std::memory_order_relaxed);
+    } while (rawHead.load(std::memory_order_acquire) != h);
+  } else {
+    h = tierHead(tier);
+    lastMs = h * rolls[tier - 1].periodMs;
+  }
+
+  // Die ältesten Plätze auslassen: die überschreibt der Schreiber, während der
+  // Strom noch läuft (bei 100 ms Abtastung bleiben so 12 s Vorlauf)
+  const uint32_t keep = tierLen(tier) - tierLen(tier) / 8;
+  const uint32_t avail = (h < keep) ? h : keep;
+  c.count = (maxRecords && maxRecords < avail) ? maxRecords : avail;
+  c.end = h;
+  c.seq = h - c.count;
+
+  HistHeader &hd = c.head;
+  hd.magic[0] = 'H';
+  hd.magic[1] = 'S';
+  hd.version  = 1;
+  hd.tier     = tier;
+  hd.recSize  = tierSize(tier);
+  hd.count    = c.count;
+  hd.periodMs = (tier == HIST_TIER_RAW) ? historyInterval() : rolls[tier - 1].periodMs;
+  hd.lastMs   = lastMs;
+}
+
+size_t historyRender(HistCursor &c, uint8_t *out, size_t maxLen) {
+  size_t n = 0;
+  if (!c.headerSent) {
+    if (maxLen < sizeof(HistHeader)) return 0;
+    memcpy(out, &c.head, sizeof(HistHeader));
+    n = sizeof(HistHeader);
+    c.headerSent = true;
+  }
+  const size_t   head = n;
+  const uint8_t  sz  = tierSize(c.tier);
+  const uint16_t len = tierLen(c.tier);
+  const uint32_t first = c.seq;
+  while (c.seq != c.end && n + sz <= maxLen) {
+    const uint32_t slot = c.seq % len;
+    if (c.tier == HIST_TIER_RAW) memcpy(out + n, &rawRing[slot], sz);
+    else                         memcpy(out + n, &rolls[c.tier - 1].ring[slot], sz);
+    n += sz;
+    c.seq++;
+  }
+  // Beim Kopieren überschrieben? Diesen Teil verwerfen und den Strom beenden
+  if (c.seq != first && (uint32_t)(tierHead(c.tier) - first) >= len) {
+    c.seq = c.end;
+    return head;
+  }
+  return n;
+}
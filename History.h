@@ -0,0 +1,83 @@
+#pragma once
+#include <Arduino.h>
+
+// ===== Signalverlauf =====
+// Der Radio-Task tastet RSSI/SNR im einstellbaren Abstand ab und legt jede
+// Messung als gepackten Datensatz in einen Ringpuffer. Parallel werden die
+// Messungen zu Intervallen von 1 s, 10 s und 1 min (min/avg/max) verdichtet,
+// jedes mit eigenem Ring; so passen Stunden Verlauf in wenige KB. Web-Handler
+// streamen einen Ring binär (historyRender), ohne den Radio-Task anzuhalten.
+
+#define HIST_RAW_LEN        1024   // Rohdatensätze, Zweierpotenz (100 s bei 100 ms)
+#define HIST_INTERVAL_MS    100    // Vorgabe Abtastabstand
+#define HIST_INTERVAL_MIN   20
+#define HIST_INTERVAL_MAX   5000
+
+// Stufen; HIST_TIER_RAW sind die Einzelmessungen
+enum HistTier : uint8_t {
+  HIST_TIER_RAW = 0,
+  HIST_TIER_1S,        // 300 Intervalle = 5 min
+  HIST_TIER_10S,       // 360 Intervalle = 1 h
+  HIST_TIER_1MIN,      // 360 Intervalle = 6 h
+  HIST_TIER_COUNT
+};
+
+enum HistFlag : uint8_t {
+  HIST_F_FM      = 0x01,
+  HIST_F_PILOT   = 0x02,   // Stereo-Pilot (Rollup: in mindestens der Hälfte der Messungen)
+  HIST_F_GAP     = 0x04,   // Roh: Abstand zum Vorgänger > 65535 ms, dtMs ist gekappt
+  HIST_F_RETUNED = 0x08,   // Rollup: Frequenz hat sich im Intervall geändert
+};
+
+// Einzelmessung, 7 Bytes little endian
+typedef struct __attribute__((packed)) {
+  uint16_t dtMs;       // Abstand zur vorigen Messung
+  uint8_t  rssi;       // dBµV
+  uint8_t  snr;        // dB
+  uint16_t freq;       // kHz bzw. 10-kHz-Einheiten (HIST_F_FM)
+  uint8_t  flags;      // HistFlag
+} HistSample;
+
+// Verdichtetes Intervall, 10 Bytes little endian; n == 0: keine Messung
+typedef struct __attribute__((packed)) {
+  uint8_t  rssiMin, rssiAvg, rssiMax;
+  uint8_t  snrMin, snrAvg, snrMax;
+  uint8_t  n;          // Messungen im Intervall, bei 255 gesättigt
+  uint8_t  flags;      // HistFlag
+  uint16_t freq;       // Frequenz der letzten Messung
+} HistRollup;
+
+// Kopf des Binärstroms, 16 Bytes little endian; danach count Datensätze, älteste zuerst
+typedef struct __attribute__((packed)) {
+  char     magic[2];   // "HS"
+  uint8_t  version;    // 1
+  uint8_t  tier;       // HistTier
+  uint8_t  recSize;    // sizeof(HistSample) bzw. sizeof(HistRollup)
+  uint8_t  reserved;
+  uint16_t count;
+  uint32_t periodMs;   // Intervalllänge; bei HIST_TIER_RAW der eingestellte Abtastabstand
+  uint32_t lastMs;     // millis() der neuesten Messung bzw. Ende des neuesten Intervalls
+} HistHeader;
+
+typedef struct {
+  uint8_t  tier;
+  uint16_t count;
+  uint32_t seq;        // nächster zu sendender Datensatz
+  uint32_t end;
+  bool     headerSent;
+  HistHeader head;
+} HistCursor;
+
+// Radio-Task
+void historyBegin();
+bool historyDue(uint32_t now);
+void historyAdd(uint32_t now, uint8_t rssi, uint8_t snr, uint16_t freq, bool isFM, bool pilot);
+
+// Web-Handler
+void     historySetInterval(uint16_t ms);   // wird auf HIST_INTERVAL_MIN..MAX begrenzt
+uint16_t historyInterval();
+// Strom vorbereiten: höchstens maxRecords der neuesten Datensätze
+void   historyOpen(HistCursor &c, uint8_t tier, uint16_t maxRecords);
+// Schreibt Kopf und ganze Datensätze; 0 = fertig. Werden noch nicht gesendete
+// Datensätze inzwischen überschrieben, endet der Strom vorzeitig.
+size_t historyRender(HistCursor &c, uint8_t *out, size_t maxLen);
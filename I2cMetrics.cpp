@@ -0,0 +1,120 @@
+#include "I2cMetrics.h"
+
+#if I2C_METRICS
+
+static I2cCounter counters[I2C_DEV_COUNT][I2C_OP_COUNT];
+
+static const char *const devNames[I2C_DEV_COUNT] = { "si4735", "ssd1306" };
+static const char *const opNames[I2C_OP_COUNT] = { "tune", "bfo", "rsq", "rds", "config", "patch", "flush" };
+
+void i2cRecord(uint8_t dev, uint8_t op, uint32_t bytes, uint32_t us, uint8_t nacks, uint8_t retries) {
+  if (dev >= I2C_DEV_COUNT || op >= I2C_OP_COUNT) return;
+  I2cCounter &c = counters[dev][op];
+  c.calls++;
+  c.bytes += bytes;
+  c.nacks += nacks;
+  c.retries += retries;
+  c.usTotal += us;
+  // Bucket i: us <= 16 << i
+  uint8_t b = 0;
+  for (uint32_t lim = 16; b < I2C_HIST_BUCKETS && us > lim; b++, lim <<= 1) {}
+  c.hist[b]++;
+}
+
+// ===== Prometheus-Ausgabe =====
+// Der Cursor kodiert Abschnitt, Serie (Gerät x Operation) und Zeile innerhalb
+// der Serie; jede Zeile wird erst geschrieben, wenn sie komplett in den Puffer passt.
+enum { SEC_CALLS = 0, SEC_BYTES, SEC_NACKS, SEC_RETRIES, SEC_HIST, SEC_END };
+
+#define CUR_SEC(c)    ((c) >> 24)
+#define CUR_SERIES(c) (((c) >> 8) & 0xFFFF)
+#define CUR_LINE(c)   ((c) & 0xFF)
+#define CUR(s, r, l)  (((uint32_t)(s) << 24) | ((uint32_t)(r) << 8) | (l))
+
+static const char *const secName[] = {
+  "i2c_transactions_total", "i2c_bytes_total", "i2c_nacks_total", "i2c_retries_total", "i2c_latency_seconds"
+};
+static const char *const secHelp[] = {
+  "I2C transactions issued by the firmware",
+  "I2C payload bytes (where known)",
+  "I2C transactions not acknowledged",
+  "I2C status polls repeated while waiting for CTS",
+  "I2C transaction latency",
+};
+
+static uint64_t readU64(const volatile uint64_t &v) {
+  uint64_t a, b;
+  do { a = v; b = v; } while (a != b);
+  return a;
+}
+
+// Erzeugt die Zeile an Position cur in line; liefert Länge (0 = keine Zeile) und den Folgecursor
+static size_t renderLine(uint32_t cur, uint32_t &next, char *line, size_t sz) {
+  const uint8_t sec = CUR_SEC(cur);
+  const uint16_t series = CUR_SERIES(cur);
+  const uint8_t ln = CUR_LINE(cur);
+  const uint16_t seriesCount = I2C_DEV_COUNT * I2C_OP_COUNT;
+
+  if (sec >= SEC_END) { next = cur; return 0; }
+
+  // Serie 0, Zeile 0: HELP und TYPE des Abschnitts
+  if (series == 0 && ln == 0) {
+    next = CUR(sec, 1, 0);
+    return snprintf(line, sz, "# HELP %s %s\n# TYPE %s %s\n", secName[sec], secHelp[sec], secName[sec],
+                    (sec == SEC_HIST) ? "histogram" : "counter");
+  }
+  const uint16_t idx = series - 1;
+  if (idx >= seriesCount) { next = CUR(sec + 1, 0, 0); return 0; }
+
+  const uint8_t dev = idx / I2C_OP_COUNT, op = idx % I2C_OP_COUNT;
+  const I2cCounter &c = counters[dev][op];
+  const uint32_t calls = c.calls;
+  // Serien ohne Transaktion auslassen
+  if (calls == 0) { next = CUR(sec, series + 1, 0); return 0; }
+
+  char labels[48];
+  snprintf(labels, sizeof(labels), "device=\"%s\",op=\"%s\"", devNames[dev], opNames[op]);
+
+  if (sec != SEC_HIST) {
+    uint32_t v = (sec == SEC_CALLS) ? calls : (sec == SEC_BYTES) ? c.bytes : (sec == SEC_NACKS) ? c.nacks : c.retries;
+    next = CUR(sec, series + 1, 0);
+    return snprintf(line, sz, "%s{%s} %lu\n", secName[sec], labels, (unsigned long) v);
+  }
+
+  // Histogramm: Buckets (kumuliert), +Inf, sum, count
+  if (ln < I2C_HIST_BUCKETS) {
+    uint32_t cum = 0;
+    for (uint8_t i = 0; i <= ln; i++) cum += c.hist[i];
+    next = CUR(sec, series, ln + 1);
+    return snprintf(line, sz, "i2c_latency_seconds_bucket{%s,le=\"%.6f\"} %lu\n", labels,
+                    (16UL << ln) / 1e6, (unsigned long) cum);
+  }
+  if (ln == I2C_HIST_BUCKETS) {
+    next = CUR(sec, series, ln + 1);
+    return snprintf(line, sz, "i2c_latency_seconds_bucket{%s,le=\"+Inf\"} %lu\n", labels, (unsigned long) calls);
+  }
+  if (ln == I2C_HIST_BUCKETS + 1) {
+    next = CUR(sec, series, ln + 1);
+    return snprintf(line, sz, "i2c_latency_seconds_sum{%s} %.6f\n", labels,
+                    readU64(c.usTotal) / 1e6);
+  }
+  next = CUR(sec, series + 1, 0);
+  return snprintf(line, sz, "i2c_latency_seconds_count{%s} %lu\n", labels, (unsigned long) calls);
+}
+
+size_t i2cMetricsRender(uint32_t &cursor, char *out, size_t maxLen) {
+  char line[192];
+  size_t n = 0;
+  while (CUR_SEC(cursor) < SEC_END) {
+    uint32_t next;
+    size_t len = renderLine(cursor, next, line, sizeof(line));
+    if (len >= sizeof(line)) len = sizeof(line) - 1;
+    if (n + len > maxLen) break;
+    memcpy(out + n, line, len);
+    n += len;
+    cursor = next;
+  }
+  return n;
+}
+
+#endif
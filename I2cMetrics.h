@@ -0,0 +1,78 @@
+#pragma once
+#include <Arduino.h>
+
+// ===== I2C-Metriken =====
+// Zähler je Gerät und Operation: Transaktionen, Bytes, NACKs, Wiederholungen
+// und ein Latenz-Histogramm mit Zweierpotenz-Grenzen (16 µs .. 131 ms).
+// Erfasst wird an unseren Aufrufstellen (rx-Kommandos, SSB-Patch, RDS, OLED),
+// die SI4735-Library selbst bleibt unverändert. Bytes werden nur gezählt, wo
+// sie bekannt sind. Mit I2C_METRICS 0 verschwinden alle Makros ersatzlos.
+
+#ifndef I2C_METRICS
+#define I2C_METRICS 1
+#endif
+
+#define I2C_HIST_BUCKETS  14   // le = 16 µs * 2^i, danach +Inf
+
+enum I2cDev : uint8_t {
+  I2C_DEV_SI4735 = 0,
+  I2C_DEV_SSD1306,
+  I2C_DEV_COUNT
+};
+
+enum I2cOp : uint8_t {
+  I2C_OP_TUNE = 0,   // Frequenz setzen, Seek
+  I2C_OP_BFO,         // SSB_BFO (Feinabstimmung)
+  I2C_OP_RSQ,        // Signalqualität
+  I2C_OP_RDS,        // FM_RDS_STATUS
+  I2C_OP_CONFIG,     // Band/Mode/Bandbreite/Properties
+  I2C_OP_PATCH,      // SSB-Patch-Download
+  I2C_OP_FLUSH,      // OLED-Fenster
+  I2C_OP_COUNT
+};
+
+#if I2C_METRICS
+
+typedef struct {
+  uint32_t calls;
+  uint32_t bytes;
+  uint32_t nacks;
+  uint32_t retries;
+  uint64_t usTotal;
+  uint32_t hist[I2C_HIST_BUCKETS + 1];
+} I2cCounter;
+
+// Nur vom Radio-Task beschrieben (einziger I2C-Nutzer); Leser sehen 32-Bit-Werte konsistent
+void i2cRecord(uint8_t dev, uint8_t op, uint32_t bytes, uint32_t us, uint8_t nacks, uint8_t retries);
+
+// Misst die Lebensdauer des Objekts als eine Transaktion
+class I2cScope {
+public:
+  I2cScope(uint8_t dev, uint8_t op, uint32_t bytes = 0)
+    : dev_(dev), op_(op), nacks_(0), retries_(0), bytes_(bytes), start_(micros()) {}
+  ~I2cScope() { i2cRecord(dev_, op_, bytes_, micros() - start_, nacks_, retries_); }
+  void nack()              { nacks_++; }
+  void retry()             { retries_++; }
+  void addBytes(uint32_t n) { bytes_ += n; }
+private:
+  uint8_t  dev_, op_, nacks_, retries_;
+  uint32_t bytes_, start_;
+};
+
+#define I2C_SCOPE(var, dev, op, bytes)  I2cScope var(dev, op, bytes)
+#define I2C_SCOPE_NACK(var)             var.nack()
+#define I2C_SCOPE_RETRY(var)            var.retry()
+#define I2C_SCOPE_BYTES(var, n)         var.addBytes(n)
+
+// Prometheus-Textformat stückweise erzeugen (für eine Chunked Response).
+// cursor startet bei 0; liefert die Anzahl geschriebener Bytes, 0 = fertig.
+size_t i2cMetricsRender(uint32_t &cursor, char *out, size_t maxLen);
+
+#else
+
+#define I2C_SCOPE(var, dev, op, bytes)
+#define I2C_SCOPE_NACK(var)             do {} while (0)
+#define I2C_SCOPE_RETRY(var)            do {} while (0)
+#define I2C_SCOPE_BYTES(var, n)         do {} while (0)
+
+#endif
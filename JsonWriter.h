@@ -0,0 +1,107 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+// ===== JSON-Writer =====
+// Schreibt JSON direkt in einen festen Puffer, ohne Heap und ohne Dokumentbaum.
+// Kommas setzt der Writer selbst (bis JSON_WRITER_DEPTH Ebenen). Passt etwas
+// nicht mehr in den Puffer, wird overflow() gesetzt und nichts mehr angehängt;
+// der Puffer bleibt immer nullterminiert.
+
+#define JSON_WRITER_DEPTH 16
+
+class JsonWriter {
+public:
+  JsonWriter(char *buf, size_t size) : buf_(buf), size_(size), len_(0), depth_(0), first_(1), overflow_(size == 0) {
+    if (size_) buf_[0] = '\0';
+  }
+
+  size_t      length() const   { return len_; }
+  bool        overflow() const { return overflow_; }
+  const char *c_str() const    { return buf_; }
+
+  JsonWriter &beginObject(const char *key = nullptr) { return open(key, '{'); }
+  JsonWriter &endObject()                            { return close('}'); }
+  JsonWriter &beginArray(const char *key = nullptr)  { return open(key, '['); }
+  JsonWriter &endArray()                             { return close(']'); }
+
+  // Schlüssel/Wert im aktuellen Objekt
+  JsonWriter &kv(const char *key, const char *s)     { member(key); return string(s); }
+  JsonWriter &kv(const char *key, bool v)            { member(key); return raw(v ? "true" : "false"); }
+  JsonWriter &kv(const char *key, int v)             { member(key); return fmt("%d", v); }
+  JsonWriter &kv(const char *key, unsigned v)        { member(key); return fmt("%u", v); }
+  JsonWriter &kv(const char *key, long v)            { member(key); return fmt("%ld", v); }
+  JsonWriter &kv(const char *key, unsigned long v)   { member(key); return fmt("%lu", v); }
+  // Fertiges JSON (z. B. vorformatierte Zahl oder Objekt) unverändert übernehmen
+  JsonWriter &kvRaw(const char *key, const char *json) { member(key); return raw(json); }
+
+  // Werte im aktuellen Array
+  JsonWriter &val(const char *s)   { member(nullptr); return string(s); }
+  JsonWriter &val(int v)           { member(nullptr); return fmt("%d", v); }
+  JsonWriter &val(unsigned v)      { member(nullptr); return fmt("%u", v); }
+  JsonWriter &val(long v)          { member(nullptr); return fmt("%ld", v); }
+  JsonWriter &val(unsigned long v) { member(nullptr); return fmt("%lu", v); }
+
+private:
+  char    *buf_;
+  size_t   size_, len_;
+  uint8_t  depth_;
+  uint32_t first_;      // Bit i: Ebene i hat noch kein Element
+  bool     overflow_;
+
+  void put(char c) {
+    if (overflow_ || len_ + 1 >= size_) { overflow_ = true; return; }
+    buf_[len_++] = c;
+    buf_[len_] = '\0';
+  }
+
+  JsonWriter &raw(const char *s) {
+    while (*s && !overflow_) put(*s++);
+    return *this;
+  }
+
+  template <typename T>
+  JsonWriter &fmt(const char *f, T v) {
+    char tmp[24];
+    snprintf(tmp, sizeof(tmp), f, v);
+    return raw(tmp);
+  }
+
+  JsonWriter &string(const char *s) {
+    if (!s) return raw("null");
+    put('"');
+    for (; *s && !overflow_; s++) {
+      const uint8_t c = (uint8_t) *s;
+      if (c == '"' || c == '\\') { put('\\'); put(c); }
+      else if (c < 0x20)         fmt("\\u%04x", (unsigned) c);
+      else                       put(c);
+    }
+    put('"');
+    return *this;
+  }
+
+  // Komma vor jedem Element außer dem ersten, dann ggf. "key":
+  void member(const char *key) {
+    const uint32_t bit = 1UL << depth_;
+    if (first_ & bit) first_ &= ~bit;
+    else              put(',');
+    if (key) { string(key); put(':'); }
+  }
+
+  JsonWriter &open(const char *key, char c) {
+    if (depth_ > 0) member(key);
+    put(c);
+    if (depth_ + 1 >= JSON_WRITER_DEPTH) { overflow_ = true; return *this; }
+    depth_++;
+    first_ |= 1UL << depth_;
+    return *this;
+  }
+
+  JsonWriter &close(char c) {
+    if (depth_ > 0) depth_--;
+    put(c);
+    return *this;
+  }
+};
@@ -0,0 +1,24 @@
+#include "MemScan.h"
+#include <stdlib.h>
+
+// Liste und Statistik: die Liste setzt der Web-Task bei stehendem Scan,
+// die Statistik schreibt nur der Radio-Task
+MemScanShared mscan;
+
+// Reihenfolge der Modi: FM und AM brauchen keinen Patch, LSB/USB teilen ihn
+static uint8_t modeRank(uint8_t mode) {
+  static const uint8_t rank[] = { 0, 2, 3, 1 };   // FM, LSB, USB, AM
+  return (mode < sizeof(rank)) ? rank[mode] : 4;
+}
+
+static int compareChannel(const void *a, const void *b) {
+  const MemScanChannel &x = *(const MemScanChannel *) a;
+  const MemScanChannel &y = *(const MemScanChannel *) b;
+  if (modeRank(x.mode) != modeRank(y.mode)) return modeRank(x.mode) - modeRank(y.mode);
+  if (x.bandIdx != y.bandIdx) return x.bandIdx - y.bandIdx;
+  return (int) x.freq - (int) y.freq;
+}
+
+void mscanSort(MemScanChannel *ch, uint16_t n) {
+  qsort(ch, n, sizeof(MemScanChannel), compareChannel);
+}
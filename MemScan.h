@@ -0,0 +1,69 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// ===== Kanal-Scan =====
+// Der Radio-Task läuft eine Liste von Kanälen zyklisch ab (Bandfrequenzen,
+// Speicherkanäle oder eine Liste vom Benutzer): abstimmen, settleMs warten,
+// RSSI/SNR messen. Liegt ein Kanal über der Rauschsperre, bleibt der Scan dort
+// stehen, bis die Haltezeit (dwell) abgelaufen ist oder das Signal hangMs lang
+// unter der Sperre lag. Die Liste wird vorher nach Modus und Band sortiert,
+// damit Modus- und Bandwechsel (setFM/setAM, SSB-Patch) möglichst selten sind.
+
+#define MSCAN_MAX_CH        128
+#define MSCAN_SETTLE_DEFAULT 30     // ms, wie SCAN_SETTLE_DEFAULT
+#define MSCAN_SQUELCH_DEFAULT 20    // dBµV
+#define MSCAN_DWELL_DEFAULT 5000    // ms, 0 = unbegrenzt
+#define MSCAN_HANG_DEFAULT  2000    // ms
+#define MSCAN_HOLD_POLL_MS  200     // Messabstand auf einem gehaltenen Kanal
+#define MSCAN_BW_KEEP       0xFF    // Bandbreite des Bandes beibehalten
+#define MSCAN_FREQ_BAND     0       // letzte Frequenz des Bandes, setzt der Radio-Task beim Start ein
+
+enum MemScanState : uint8_t {
+  MSCAN_IDLE = 0,
+  MSCAN_TUNE,          // abgestimmt, wartet settleMs bis zur Messung
+  MSCAN_HOLD,          // Treffer, bleibt bis dwell/hang
+};
+
+typedef struct {
+  uint16_t freq;       // kHz bzw. 10-kHz-Einheiten (FM)
+  uint8_t  mode;       // FM/LSB/USB/AM wie in der .ino
+  uint8_t  bandIdx;
+  uint8_t  bwIdx;      // MSCAN_BW_KEEP = Bandbreite des Bandes
+  int16_t  bfo;        // Hz, nur SSB
+  int16_t  memSlot;    // Herkunft, -1 = kein Speicherkanal
+} MemScanChannel;
+
+typedef struct {
+  uint16_t hits;
+  uint8_t  rssi, snr;  // letzte Messung
+  uint8_t  peakRssi;
+} MemScanStat;
+
+typedef struct {
+  MemScanChannel ch[MSCAN_MAX_CH];
+  uint16_t count;
+  uint8_t  squelchRssi;  // Treffer ab diesem RSSI (dBµV) ...
+  uint8_t  minSnr;       // ... und mindestens diesem SNR (dB)
+  uint16_t settleMs;
+  uint16_t dwellMs;
+  uint16_t hangMs;
+} MemScanRequest;
+
+typedef struct {
+  MemScanRequest req;                  // vom Web-Task vor RCMD_MSCAN_START gesetzt (bis auf MSCAN_FREQ_BAND)
+  MemScanStat    stat[MSCAN_MAX_CH];   // nur Radio-Task schreibt (einzelne Felder, ohne Lock gelesen)
+  std::atomic<bool>     running{false};
+  std::atomic<uint8_t>  state{MSCAN_IDLE};
+  std::atomic<uint16_t> current{0};    // Index in req.ch
+  std::atomic<uint32_t> measured{0};   // Messungen seit dem Start
+  std::atomic<uint32_t> hits{0};
+  std::atomic<uint32_t> passes{0};     // vollständige Durchläufe
+  std::atomic<uint32_t> busyMs{0};     // Zeit mit Abstimmen und Messen (ohne Halten)
+  std::atomic<uint32_t> startedMs{0};
+} MemScanShared;
+
+extern MemScanShared mscan;
+
+// Nach Modus (FM, AM, LSB, USB), dann Band, dann Frequenz sortieren
+void mscanSort(MemScanChannel *ch, uint16_t n);
@@ -0,0 +1,261 @@
+#include "Memories.h"
+#include <FS.h>
+#include <LittleFS.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#define SLOT_MASK     ((1UL << MEM_SLOT_BITS) - 1)
+#define LOAD_BATCH    32      // Datensätze pro Lesevorgang beim Aufbau
+
+// ===== Zustand =====
+// Web-Handler (AsyncTCP) und Radio-Task greifen gemeinsam zu: Datei, Indizes
+// und Belegung sind durch einen Mutex geschützt.
+static SemaphoreHandle_t lock = NULL;
+static File db;
+
+// Sortierte Schlüssel: Frequenz (FM-Bit | freq | slot), Name (3 Zeichen à 6 Bit | slot)
+static uint32_t freqIdx[MEM_MAX_CHANNELS];
+static uint32_t nameIdx[MEM_MAX_CHANNELS];
+static uint32_t used[(MEM_MAX_CHANNELS + 31) / 32];
+static uint16_t count = 0;
+static uint16_t fileSlots = 0;
+static std::atomic<uint32_t> generation{0};
+
+class MemLock {
+public:
+  MemLock()  { xSemaphoreTake(lock, portMAX_DELAY); }
+  ~MemLock() { xSemaphoreGive(lock); }
+};
+
+// ===== Schlüssel =====
+// Zeichen auf 6 Bit falten, Sortierung: Ende < Leerzeichen < Ziffern < Buchstaben < Rest
+static uint8_t foldChar(char c) {
+  if (c == 0) return 0;
+  if (c == ' ') return 1;
+  if (c >= '0' && c <= '9') return 2 + (c - '0');
+  if (c >= 'a' && c <= 'z') c -= 'a' - 'A';
+  if (c >= 'A' && c <= 'Z') return 12 + (c - 'A');
+  return 38 + ((uint8_t) c % 25);
+}
+
+// Die ersten drei Zeichen als 18-Bit-Wert; n = Anzahl der gültigen Zeichen
+static uint32_t nameBits(const char *s, uint8_t &n) {
+  uint32_t k = 0;
+  n = 0;
+  for (uint8_t i = 0; i < 3; i++) {
+    uint8_t f = (s && n == i && s[i]) ? foldChar(s[i]) : 0;
+    if (f) n++;
+    k = (k << 6) | f;
+  }
+  return k;
+}
+
+static uint32_t freqKey(bool isFM, uint16_t freq, uint16_t slot) {
+  return ((uint32_t) isFM << (16 + MEM_SLOT_BITS)) | ((uint32_t) freq << MEM_SLOT_BITS) | slot;
+}
+
+static uint32_t nameKey(const char *name, uint16_t slot) {
+  uint8_t n;
+  return (nameBits(name, n) << MEM_SLOT_BITS) | slot;
+}
+
+static uint32_t recFreqKey(const MemRecord &r, uint16_t slot) {
+  return freqKey(r.mode == MEM_MODE_FM, r.freq, slot);
+}
+
+// ===== Sortierte Arrays =====
+static uint16_t lowerBound(const uint32_t *a, uint32_t key) {
+  uint16_t lo = 0, hi = count;
+  while (lo < hi) {
+    uint16_t mid = (lo + hi) >> 1;
+    if (a[mid] < key) lo = mid + 1; else hi = mid;
+  }
+  return lo;
+}
+
+static void insertKey(uint32_t *a, uint32_t key) {
+  uint16_t pos = lowerBound(a, key);
+  memmove(&a[pos + 1], &a[pos], (count - pos) * sizeof(uint32_t));
+  a[pos] = key;
+}
+
+// count muss beim Aufruf noch die alte Anzahl enthalten
+static void removeKey(uint32_t *a, uint32_t key) {
+  uint16_t pos = lowerBound(a, key);
+  if (pos >= count || a[pos] != key) return;
+  memmove(&a[pos], &a[pos + 1], (count - pos - 1) * sizeof(uint32_t));
+}
+
+static int cmpU32(const void *a, const void *b) {
+  uint32_t x = *(const uint32_t *) a, y = *(const uint32_t *) b;
+  return (x < y) ? -1 : (x > y);
+}
+
+static bool isUsed(uint16_t slot) { return used[slot >> 5] & (1UL << (slot & 31)); }
+static void setUsed(uint16_t slot, bool on) {
+  if (on) used[slot >> 5] |= (1UL << (slot & 31));
+  else    used[slot >> 5] &= ~(1UL << (slot & 31));
+}
+
+// ===== Datei =====
+static bool readSlot(uint16_t slot, MemRecord &r) {
+  if (slot >= fileSlots) return false;
+  if (!db.seek((uint32_t) slot * sizeof(MemRecord))) return false;
+  return db.read((uint8_t *) &r, sizeof(r)) == sizeof(r);
+}
+
+static bool writeSlot(uint16_t slot, const MemRecord &r) {
+  if (!db.seek((uint32_t) slot * sizeof(MemRecord))) return false;
+  if (db.write((const uint8_t *) &r, sizeof(r)) != sizeof(r)) return false;
+  db.flush();
+  if (slot >= fileSlots) fileSlots = slot + 1;
+  return true;
+}
+
+static int freeSlot() {
+  for (uint16_t i = 0; i < fileSlots; i++) if (!isUsed(i)) return i;
+  return (fileSlots < MEM_MAX_CHANNELS) ? fileSlots : -1;
+}
+
+// ===== API =====
+bool memBegin() {
+  if (!lock) lock = xSemaphoreCreateMutex();
+  if (!LittleFS.begin(true)) return false;
+
+  if (!LittleFS.exists(MEM_FILE)) { File f = LittleFS.open(MEM_FILE, "w"); f.close(); }
+  db = LittleFS.open(MEM_FILE, "r+");
+  if (!db) return false;
+
+  MemLock l;
+  count = 0;
+  memset(used, 0, sizeof(used));
+  fileSlots = db.size() / sizeof(MemRecord);
+  if (fileSlots > MEM_MAX_CHANNELS) fileSlots = MEM_MAX_CHANNELS;
+
+  // Datei einmal sequenziell lesen, Indizes danach in einem Schritt sortieren
+  MemRecord batch[LOAD_BATCH];
+  db.seek(0);
+  for (uint16_t slot = 0; slot < fileSlots; ) {
+    uint16_t n = fileSlots - slot;
+    if (n > LOAD_BATCH) n = LOAD_BATCH;
+    if (db.read((uint8_t *) batch, n * sizeof(MemRecord)) != n * sizeof(MemRecord)) break;
+    for (uint16_t i = 0; i < n; i++, slot++) {
+      if (!(batch[i].flags & MEM_FLAG_USED)) continue;
+      batch[i].name[MEM_NAME_LEN] = '\0';
+      freqIdx[count] = recFreqKey(batch[i], slot);
+      nameIdx[count] = nameKey(batch[i].name, slot);
+      setUsed(slot, true);
+      count++;
+    }
+  }
+  qsort(freqIdx, count, sizeof(uint32_t), cmpU32);
+  qsort(nameIdx, count, sizeof(uint32_t), cmpU32);
+  generation++;
+  return true;
+}
+
+uint16_t memCount() { return count; }
+uint32_t memGeneration() { return generation.load(std::memory_order_acquire); }
+
+int memStore(int slot, const MemRecord &rec) {
+  if (!db) return -1;
+  MemLock l;
+  if (slot < 0) slot = freeSlot();
+  if (slot < 0 || slot >= MEM_MAX_CHANNELS) return -1;
+
+  MemRecord r = rec;
+  r.flags |= MEM_FLAG_USED;
+  r.name[MEM_NAME_LEN] = '\0';
+
+  // Überschreiben: alte Schlüssel entfernen
+  MemRecord old;
+  if (isUsed(slot) && readSlot(slot, old)) {
+    removeKey(freqIdx, recFreqKey(old, slot));
+    removeKey(nameIdx, nameKey(old.name, slot));
+    count--;
+  }
+  if (!writeSlot(slot, r)) { setUsed(slot, false); generation++; return -1; }
+  insertKey(freqIdx, recFreqKey(r, slot));
+  insertKey(nameIdx, nameKey(r.name, slot));
+  count++;
+  setUsed(slot, true);
+  generation++;
+  return slot;
+}
+
+bool memDelete(uint16_t slot) {
+  if (!db) return false;
+  MemLock l;
+  MemRecord r;
+  if (slot >= fileSlots || !isUsed(slot) || !readSlot(slot, r)) return false;
+  removeKey(freqIdx, recFreqKey(r, slot));
+  removeKey(nameIdx, nameKey(r.name, slot));
+  count--;
+  setUsed(slot, false);
+  r.flags = 0;
+  writeSlot(slot, r);
+  generation++;
+  return true;
+}
+
+bool memRead(uint16_t slot, MemRecord &out) {
+  if (!db) return false;
+  MemLock l;
+  if (slot >= fileSlots || !isUsed(slot)) return false;
+  if (!readSlot(slot, out)) return false;
+  out.name[MEM_NAME_LEN] = '\0';
+  return true;
+}
+
+int memNearest(bool isFM, uint16_t freq, uint16_t maxDist) {
+  if (!lock) return -1;
+  MemLock l;
+  const uint16_t pos = lowerBound(freqIdx, freqKey(isFM, freq, 0));
+  int best = -1;
+  uint32_t bestDist = (uint32_t) maxDist + 1;
+  // Kandidaten: erster Eintrag >= freq und letzter davor, jeweils gleiche Einheit
+  for (int p = (int) pos - 1; p <= (int) pos; p++) {
+    if (p < 0 || p >= count) continue;
+    const uint32_t k = freqIdx[p];
+    if ((bool)(k >> (16 + MEM_SLOT_BITS)) != isFM) continue;
+    const uint16_t f = (k >> MEM_SLOT_BITS) & 0xFFFF;
+    const uint32_t d = (f > freq) ? (f - freq) : (freq - f);
+    if (d < bestDist) { bestDist = d; best = k & SLOT_MASK; }
+  }
+  return best;
+}
+
+uint16_t memLowerBoundFreq(bool isFM, uint16_t freq) {
+  if (!lock) return 0;
+  MemLock l;
+  return lowerBound(freqIdx, freqKey(isFM, freq, 0));
+}
+
+void memPrefixRange(const char *prefix, uint16_t &first, uint16_t &end) {
+  first = end = 0;
+  if (!lock) return;
+  uint8_t n;
+  const uint32_t bits = nameBits(prefix, n);
+  // Nicht vorgegebene Zeichenpositionen dürfen beliebig sein
+  const uint32_t freeBits = (1UL << (6 * (3 - n))) - 1;
+  const uint32_t lo = bits << MEM_SLOT_BITS;
+  const uint32_t hi = ((bits | freeBits) << MEM_SLOT_BITS) | SLOT_MASK;
+  MemLock l;
+  first = lowerBound(nameIdx, lo);
+  end = (hi == 0xFFFFFFFFUL) ? count : lowerBound(nameIdx, hi + 1);
+}
+
+int memSlotAt(MemOrder order, uint16_t pos) {
+  if (!lock) return -1;
+  MemLock l;
+  if (pos >= count) return -1;
+  return ((order == MEM_BY_NAME) ? nameIdx[pos] : freqIdx[pos]) & SLOT_MASK;
+}
+
+bool memNameHasPrefix(const char *name, const char *prefix) {
+  for (; *prefix; prefix++, name++) {
+    if (!*name) return false;
+    if (tolower((uint8_t) *name) != tolower((uint8_t) *prefix)) return false;
+  }
+  return true;
+}
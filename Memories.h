@@ -0,0 +1,56 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// ===== Speicherkanäle =====
+// Kanäle liegen als Datensätze fester Größe in einer Datei auf LittleFS
+// (Slot n an Offset n * 32). Im RAM stehen nur zwei sortierte Indizes mit je
+// 4 Bytes pro Kanal (Frequenz bzw. Namensanfang, jeweils mit Slotnummer), die
+// statisch für MEM_MAX_CHANNELS angelegt sind – der Heap wächst nicht mit.
+
+#define MEM_FILE          "/memories.bin"
+#define MEM_MAX_CHANNELS  5000
+#define MEM_SLOT_BITS     13      // 2^13 > MEM_MAX_CHANNELS
+#define MEM_NAME_LEN      19
+#define MEM_MODE_FM       0       // wie FM in der .ino; FM-Frequenzen in 10-kHz-Einheiten
+
+#define MEM_FLAG_USED     0x01
+
+typedef struct __attribute__((packed)) {
+  uint16_t freq;       // kHz bzw. 10-kHz-Einheiten (FM)
+  uint8_t  mode;       // FM/LSB/USB/AM wie in der .ino
+  uint8_t  bwIdx;
+  uint8_t  stepIdx;
+  uint8_t  flags;      // MEM_FLAG_USED; 0 = Slot frei
+  int16_t  bfo;        // Hz, nur SSB
+  uint32_t tags;       // Bitmaske, Bedeutung legt der Benutzer fest
+  char     name[MEM_NAME_LEN + 1];
+} MemRecord;
+
+static_assert(sizeof(MemRecord) == 32, "MemRecord muss 32 Bytes groß sein");
+
+// Sortierung für die Iteration
+enum MemOrder : uint8_t {
+  MEM_BY_FREQ = 0,     // erst AM/SSB, dann FM, jeweils aufsteigend
+  MEM_BY_NAME,         // nach den ersten drei Zeichen (ohne Groß-/Kleinschreibung)
+};
+
+// LittleFS mounten und beide Indizes aus der Datei aufbauen
+bool memBegin();
+uint16_t memCount();
+// Wird bei jeder Änderung erhöht (für Caches, ohne Lock lesbar)
+uint32_t memGeneration();
+
+// Speichert rec in slot (< 0: neuer Slot). Liefert den Slot oder -1.
+int  memStore(int slot, const MemRecord &rec);
+bool memDelete(uint16_t slot);
+bool memRead(uint16_t slot, MemRecord &out);
+
+// Nächster Kanal zu freq (gleiche Frequenzeinheit) mit Abstand <= maxDist, sonst -1
+int  memNearest(bool isFM, uint16_t freq, uint16_t maxDist);
+
+// Positionen im Index für Paging. memSlotAt liefert -1 hinter dem Ende.
+uint16_t memLowerBoundFreq(bool isFM, uint16_t freq);
+void     memPrefixRange(const char *prefix, uint16_t &first, uint16_t &end);
+int      memSlotAt(MemOrder order, uint16_t pos);
+bool     memNameHasPrefix(const char *name, const char *prefix);
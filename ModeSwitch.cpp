@@ -0,0 +1,30 @@
+#include "ModeSwitch.h"
+#include "Bands.h"
+
+ModeSwitchShared modesw;
+ModeBenchShared  mbench;
+
+// Eulerweg durch alle gerichteten Paare: jeder Wechsel beginnt im Zielmodus
+// des vorigen, ein Durchlauf braucht also keine ungemessenen Zwischenschritte
+const uint8_t modeBenchPath[MBENCH_PATH_LEN] = {
+  BAND_MODE_FM, BAND_MODE_AM, BAND_MODE_LSB, BAND_MODE_USB, BAND_MODE_FM,
+  BAND_MODE_LSB, BAND_MODE_AM, BAND_MODE_USB, BAND_MODE_LSB, BAND_MODE_FM,
+  BAND_MODE_USB, BAND_MODE_AM, BAND_MODE_FM,
+};
+
+void modeBenchReset(uint8_t rounds) {
+  memset(mbench.cell, 0, sizeof(mbench.cell));
+  mbench.done.store(0, std::memory_order_relaxed);
+  mbench.total.store((uint16_t) rounds * (MBENCH_PATH_LEN - 1), std::memory_order_relaxed);
+}
+
+void modeBenchRecord(uint8_t from, uint8_t to, uint32_t us, bool reload) {
+  if (from >= MBENCH_MODES || to >= MBENCH_MODES) return;
+  ModeBenchCell &c = mbench.cell[from][to];
+  if (c.n == 0 || us < c.minUs) c.minUs = us;
+  if (us > c.maxUs) c.maxUs = us;
+  c.sumUs += us;
+  if (reload) c.reloads++;
+  c.n++;
+  mbench.done.fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// ===== Moduswechsel =====
+// Buchführung über den tatsächlichen Zustand des SI4735: mit welcher Firmware
+// er zuletzt gestartet wurde und ob der SSB-Patch noch im RAM liegt. setFM()
+// und setAM() der Library starten den Chip beim Wechsel der Firmware neu, dabei
+// geht der Patch verloren; solange das nicht passiert ist, wird er nicht neu
+// geladen. Dazu ein Benchmark, der jeden Wechsel zwischen FM/AM/LSB/USB misst.
+
+enum SiPower : uint8_t {
+  SI_POWER_OFF = 0,    // noch nicht gestartet oder Zustand unbekannt (Patch fehlgeschlagen)
+  SI_POWER_FM,
+  SI_POWER_AM,         // AM-Firmware aus dem ROM, kein Patch
+  SI_POWER_SSB,        // AM-Firmware mit SSB-Patch im RAM
+};
+
+// Nur der Radio-Task schreibt; Web-Handler lesen die Felder einzeln
+typedef struct {
+  std::atomic<uint8_t>  power{SI_POWER_OFF};
+  std::atomic<uint32_t> powerUps{0};     // Neustarts des Chips (Wechsel der Firmware)
+  std::atomic<uint32_t> patchLoads{0};   // erfolgreich geladene und geprüfte Patches
+  std::atomic<uint32_t> patchSkips{0};   // SSB gewählt, Patch war noch geladen
+  std::atomic<uint32_t> patchFails{0};   // verworfene Versuche (Download oder Rücklesen)
+  std::atomic<uint32_t> patchHz{0};      // Bustakt des letzten erfolgreichen Downloads
+  std::atomic<uint32_t> patchUs{0};      // Dauer des letzten Ladens samt Fehlversuchen
+} ModeSwitchShared;
+
+extern ModeSwitchShared modesw;
+
+// ===== Benchmark =====
+// Der Radio-Task läuft modeBenchPath rounds-mal ab, ein Wechsel je Schleifen-
+// durchlauf; gemessen wird die Zeit bis der Chip im neuen Modus abgestimmt ist.
+#define MBENCH_MODES          4     // Index = Modus FM/LSB/USB/AM wie in der .ino
+#define MBENCH_PATH_LEN       13    // 12 gerichtete Paare, jedes genau einmal
+#define MBENCH_ROUNDS_DEFAULT 3
+#define MBENCH_ROUNDS_MAX     20
+
+typedef struct {
+  uint16_t n;
+  uint16_t reloads;    // Wechsel mit Patch-Download
+  uint32_t minUs, maxUs;
+  uint32_t sumUs;
+} ModeBenchCell;
+
+typedef struct {
+  ModeBenchCell cell[MBENCH_MODES][MBENCH_MODES];   // [von][nach]
+  std::atomic<bool>     running{false};
+  std::atomic<uint16_t> done{0};                    // gemessene Wechsel
+  std::atomic<uint16_t> total{0};
+} ModeBenchShared;
+
+extern ModeBenchShared mbench;
+extern const uint8_t modeBenchPath[MBENCH_PATH_LEN];
+
+// Radio-Task
+void modeBenchReset(uint8_t rounds);
+void modeBenchRecord(uint8_t from, uint8_t to, uint32_t us, bool reload);
@@ -0,0 +1,90 @@
+#include "OledFlush.h"
+#include <Wire.h>
+#include "I2cMetrics.h"
+
+OledFlushStats oledStats;
+
+static Adafruit_SSD1306 *disp = NULL;
+static uint8_t  addr = 0x3C;
+static uint8_t  shadow[128 * 64 / 8];   // zuletzt gesendetes Bild
+static bool     shadowValid = false;
+static bool     pending = false;
+static uint32_t lastFlush = 0;
+
+// Ein Wire-Puffer muss Steuerbyte + Daten fassen
+#define OLED_CHUNK 31
+
+void oledFlushBegin(Adafruit_SSD1306 *display, uint8_t i2cAddr) {
+  disp = display;
+  addr = i2cAddr;
+  shadowValid = false;
+  pending = true;
+}
+
+void oledRequestFlush() {
+  pending = true;
+}
+
+static uint32_t sendWindow(uint8_t page, uint8_t c0, uint8_t c1, const uint8_t *data) {
+  I2C_SCOPE(m, I2C_DEV_SSD1306, I2C_OP_FLUSH, 0);
+  // Adressfenster: eine Seite, Spalten c0..c1 (horizontaler Adressmodus aus begin())
+  Wire.beginTransmission(addr);
+  Wire.write((uint8_t) 0x00);
+  Wire.write((uint8_t) SSD1306_PAGEADDR);
+  Wire.write(page);
+  Wire.write(page);
+  Wire.write((uint8_t) SSD1306_COLUMNADDR);
+  Wire.write(c0);
+  Wire.write(c1);
+  if (Wire.endTransmission() != 0) I2C_SCOPE_NACK(m);
+  uint32_t bytes = 7;
+
+  uint16_t n = (uint16_t)(c1 - c0) + 1;
+  while (n) {
+    uint8_t k = (n > OLED_CHUNK) ? OLED_CHUNK : n;
+    Wire.beginTransmission(addr);
+    Wire.write((uint8_t) 0x40);
+    Wire.write(data, k);
+    if (Wire.endTransmission() != 0) I2C_SCOPE_NACK(m);
+    bytes += 1 + k;
+    data += k;
+    n -= k;
+  }
+  I2C_SCOPE_BYTES(m, bytes);
+  return bytes;
+}
+
+void oledFlush(bool force) {
+  if (!disp || !pending) return;
+  if (!force && (millis() - lastFlush) < OLED_FRAME_MS) return;
+  pending = false;
+  lastFlush = millis();
+
+  const uint8_t w = disp->width();
+  const uint8_t pages = disp->height() / 8;
+  uint8_t *buf = disp->getBuffer();
+  uint32_t bytes = 0;
+  bool clockRaised = false;
+
+  for (uint8_t p = 0; p < pages; p++) {
+    uint8_t *row = buf + p * w;
+    uint8_t *old = shadow + p * w;
+    int c0 = 0, c1 = w - 1;
+    if (shadowValid) {
+      while (c0 < w && row[c0] == old[c0]) c0++;
+      if (c0 == w) continue;
+      while (c1 > c0 && row[c1] == old[c1]) c1--;
+    }
+    if (!clockRaised) { Wire.setClock(OLED_I2C_CLOCK); clockRaised = true; }
+    bytes += sendWindow(p, c0, c1, row + c0);
+    memcpy(old + c0, row + c0, c1 - c0 + 1);
+  }
+  if (clockRaised) Wire.setClock(OLED_I2C_CLOCK_AFTER);
+  shadowValid = true;
+
+  if (bytes == 0) { oledStats.skipped++; return; }
+  oledStats.frames++;
+  oledStats.bytesLastFrame = bytes;
+  oledStats.bytesTotal += bytes;
+  if (bytes > oledStats.bytesMaxFrame) oledStats.bytesMaxFrame = bytes;
+}
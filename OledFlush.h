@@ -0,0 +1,29 @@
+#pragma once
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+
+// ===== OLED-Flush mit Dirty-Regionen =====
+// Statt oled.display() (immer der ganze Puffer) werden Änderungen nur markiert.
+// oledFlush() vergleicht den Puffer seitenweise mit dem zuletzt gesendeten Bild
+// und überträgt pro Frame-Tick nur die geänderten Spaltenbereiche jeder Seite.
+
+#define OLED_FRAME_MS         40      // max. ein Flush je Frame-Tick
+#define OLED_I2C_CLOCK        400000  // Bustakt während des Flush
+#define OLED_I2C_CLOCK_AFTER  100000  // danach wieder für den SI4735
+
+typedef struct {
+  uint32_t frames;          // Flushes mit mindestens einer geänderten Seite
+  uint32_t bytesLastFrame;  // I2C-Bytes (ohne Adressbyte) des letzten Flush
+  uint32_t bytesMaxFrame;
+  uint32_t bytesTotal;
+  uint32_t skipped;         // Flush-Anforderungen ohne tatsächliche Änderung
+} OledFlushStats;
+
+extern OledFlushStats oledStats;
+
+void oledFlushBegin(Adafruit_SSD1306 *display, uint8_t i2cAddr);
+// Puffer wurde geändert; Übertragung erfolgt beim nächsten oledFlush()
+void oledRequestFlush();
+// Überträgt geänderte Bereiche, sofern angefordert und der Frame-Tick erreicht ist.
+// force = sofort senden (z. B. vor einem blockierenden delay()).
+void oledFlush(bool force = false);
@@ -0,0 +1,252 @@
+#include "Perf.h"
+
+#if PERF_PROFILE
+#include <atomic>
+#include "RadioTask.h"   // SeqlockSnapshot
+
+typedef struct {
+  uint8_t      n;
+  PerfSlowIter it[PERF_SLOW_N];   // absteigend nach totalUs
+} PerfSlowList;
+
+typedef struct {
+  const char *path;
+  const char *method;
+  PerfHist    h;
+} PerfRoute;
+
+static uint32_t cpuMhz = 240;
+static uint32_t resetAtMs = 0;
+static std::atomic<bool> loopResetReq{false};
+
+static const char *const stageNames[PERF_ST_COUNT] = {
+  "cmd", "scan", "input", "rssi", "rds", "housekeep", "flush", "publish"
+};
+
+// Radio-Task
+static PerfHist periodHist;              // Abstand der Durchlaufbeginne (Jitter)
+static PerfHist busyHist;                // Dauer eines Durchlaufs ohne vTaskDelay
+static PerfHist stageHist[PERF_ST_COUNT];
+static uint32_t loopStart = 0, lapStart = 0;
+static bool     loopStarted = false;
+static uint32_t stageCycles[PERF_ST_COUNT];
+static PerfSlowList slowLocal;
+static SeqlockSnapshot<PerfSlowList> slowPub;
+
+// AsyncTCP-Task
+static PerfRoute routes[PERF_MAX_ROUTES];
+static uint8_t   routeCount = 0;
+static uint32_t  routeMigrated = 0;      // Handler auf anderem Kern beendet: verworfen
+
+// ===== Histogramm =====
+// Bucket 0..3: 0..3 µs; danach je Zweierpotenz 4 Buckets
+static uint8_t bucketOf(uint32_t us) {
+  if (us < 4) return us;
+  const uint8_t msb = 31 - __builtin_clz(us);
+  const uint32_t b = (msb - 1) * 4 + ((us >> (msb - 2)) & 3);
+  return (b < PERF_HIST_BUCKETS) ? b : PERF_HIST_BUCKETS - 1;
+}
+
+// Größter Wert im Bucket
+static uint32_t bucketUpper(uint8_t b) {
+  if (b < 4) return b;
+  const uint8_t msb = b / 4 + 1;
+  return ((uint32_t)(5 + (b & 3)) << (msb - 2)) - 1;
+}
+
+static void histAdd(PerfHist &h, uint32_t us) {
+  if (h.count == 0 || us < h.minUs) h.minUs = us;
+  if (us > h.maxUs) h.maxUs = us;
+  h.count++;
+  h.sumUs += us;
+  h.hist[bucketOf(us)]++;
+}
+
+// Obergrenze des Buckets, in dem der Rang q/1000 liegt, begrenzt auf [min, max]
+static uint32_t histQuantile(const PerfHist &h, uint16_t q) {
+  if (h.count == 0) return 0;
+  const uint32_t rank = (uint32_t)(((uint64_t) h.count * q + 999) / 1000);
+  uint32_t cum = 0;
+  for (uint8_t b = 0; b < PERF_HIST_BUCKETS; b++) {
+    cum += h.hist[b];
+    if (cum >= rank) {
+      uint32_t v = bucketUpper(b);
+      if (v < h.minUs) v = h.minUs;
+      if (v > h.maxUs) v = h.maxUs;
+      return v;
+    }
+  }
+  return h.maxUs;
+}
+
+// ===== Schleife (Radio-Task) =====
+void perfBegin() {
+  cpuMhz = getCpuFrequencyMhz();
+  if (cpuMhz == 0) cpuMhz = 240;
+  resetAtMs = millis();
+}
+
+static void loopReset() {
+  memset(&periodHist, 0, sizeof(periodHist));
+  memset(&busyHist, 0, sizeof(busyHist));
+  memset(stageHist, 0, sizeof(stageHist));
+  memset(&slowLocal, 0, sizeof(slowLocal));
+  slowPub.publish(slowLocal);
+  loopStarted = false;
+}
+
+void perfLoopBegin() {
+  const uint32_t now = ESP.getCycleCount();
+  if (loopResetReq.exchange(false)) loopReset();
+  if (loopStarted) histAdd(periodHist, (now - loopStart) / cpuMhz);
+  loopStarted = true;
+  loopStart = lapStart = now;
+  memset(stageCycles, 0, sizeof(stageCycles));
+}
+
+void perfLap(uint8_t stage) {
+  const uint32_t now = ESP.getCycleCount();
+  if (stage < PERF_ST_COUNT) stageCycles[stage] += now - lapStart;
+  lapStart = now;
+}
+
+// Durchlauf in die Liste der langsamsten einsortieren (falls er dazugehört)
+static void slowInsert(uint32_t totalUs, const uint32_t *stageUs) {
+  uint8_t pos = slowLocal.n;
+  while (pos > 0 && slowLocal.it[pos - 1].totalUs < totalUs) pos--;
+  if (pos >= PERF_SLOW_N) return;
+  const uint8_t last = (slowLocal.n < PERF_SLOW_N) ? slowLocal.n : PERF_SLOW_N - 1;
+  memmove(&slowLocal.it[pos + 1], &slowLocal.it[pos], (last - pos) * sizeof(PerfSlowIter));
+  PerfSlowIter &e = slowLocal.it[pos];
+  e.atMs = millis();
+  e.totalUs = totalUs;
+  memcpy(e.stageUs, stageUs, sizeof(e.stageUs));
+  if (slowLocal.n < PERF_SLOW_N) slowLocal.n++;
+  slowPub.publish(slowLocal);
+}
+
+void perfLoopEnd() {
+  const uint32_t totalUs = (ESP.getCycleCount() - loopStart) / cpuMhz;
+  uint32_t stageUs[PERF_ST_COUNT];
+  histAdd(busyHist, totalUs);
+  for (uint8_t i = 0; i < PERF_ST_COUNT; i++) {
+    stageUs[i] = stageCycles[i] / cpuMhz;
+    histAdd(stageHist[i], stageUs[i]);
+  }
+  if (slowLocal.n < PERF_SLOW_N || totalUs > slowLocal.it[PERF_SLOW_N - 1].totalUs) slowInsert(totalUs, stageUs);
+}
+
+// ===== Routen (AsyncTCP-Task) =====
+int perfRouteRegister(const char *path, const char *method) {
+  if (routeCount >= PERF_MAX_ROUTES) return -1;
+  PerfRoute &r = routes[routeCount];
+  memset(&r, 0, sizeof(r));
+  r.path = path;
+  r.method = method;
+  return routeCount++;
+}
+
+void perfRouteRecord(uint8_t id, uint32_t cycles) {
+  if (id < routeCount) histAdd(routes[id].h, cycles / cpuMhz);
+}
+
+// Die Zykluszähler der beiden Kerne laufen nicht synchron
+PerfRouteScope::~PerfRouteScope() {
+  if (xPortGetCoreID() != core_) { routeMigrated++; return; }
+  perfRouteRecord(id_, ESP.getCycleCount() - start_);
+}
+
+void perfReset() {
+  for (uint8_t i = 0; i < routeCount; i++) memset(&routes[i].h, 0, sizeof(PerfHist));
+  routeMigrated = 0;
+  resetAtMs = millis();
+  loopResetReq.store(true);
+}
+
+// ===== JSON-Ausgabe =====
+// Der Cursor kodiert Abschnitt und Element; jedes Element wird erst
+// geschrieben, wenn es komplett in den Puffer passt.
+enum { SEC_HEAD = 0, SEC_STAGES, SEC_ROUTES, SEC_SLOW, SEC_TAIL, SEC_END };
+
+#define CUR_SEC(c)   ((c) >> 16)
+#define CUR_IDX(c)   ((c) & 0xFFFF)
+#define CUR(s, i)    (((uint32_t)(s) << 16) | (i))
+
+static size_t histJson(char *out, size_t sz, const PerfHist &src) {
+  PerfHist h;
+  memcpy(&h, &src, sizeof(h));   // Momentaufnahme, der Schreiber läuft weiter
+  return snprintf(out, sz, "\"count\":%lu,\"min_us\":%lu,\"p50_us\":%lu,\"p99_us\":%lu,\"max_us\":%lu,\"mean_us\":%lu",
+                  (unsigned long) h.count, (unsigned long) h.minUs,
+                  (unsigned long) histQuantile(h, 500), (unsigned long) histQuantile(h, 990),
+                  (unsigned long) h.maxUs, (unsigned long)(h.count ? h.sumUs / h.count : 0));
+}
+
+static size_t renderItem(uint32_t cur, uint32_t &next, char *line, size_t sz) {
+  const uint8_t sec = CUR_SEC(cur);
+  const uint16_t idx = CUR_IDX(cur);
+  size_t n = 0;
+  char hist[160];
+
+  switch (sec) {
+    case SEC_HEAD: {
+      n = snprintf(line, sz, "{\"cpu_mhz\":%lu,\"uptime_ms\":%lu,\"window_ms\":%lu,\"route_migrated\":%lu,",
+                   (unsigned long) cpuMhz, (unsigned long) millis(), (unsigned long)(millis() - resetAtMs),
+                   (unsigned long) routeMigrated);
+      histJson(hist, sizeof(hist), periodHist);
+      n += snprintf(line + n, (n < sz) ? sz - n : 0, "\"loop\":{\"period\":{%s},", hist);
+      histJson(hist, sizeof(hist), busyHist);
+      n += snprintf(line + n, (n < sz) ? sz - n : 0, "\"busy\":{%s}},\"stages\":[", hist);
+      next = CUR(SEC_STAGES, 0);
+      return n;
+    }
+    case SEC_STAGES:
+      if (idx >= PERF_ST_COUNT) { next = CUR(SEC_ROUTES, 0); return snprintf(line, sz, "],\"routes\":["); }
+      histJson(hist, sizeof(hist), stageHist[idx]);
+      next = CUR(sec, idx + 1);
+      return snprintf(line, sz, "%s{\"name\":\"%s\",%s}", idx ? "," : "", stageNames[idx], hist);
+    case SEC_ROUTES:
+      if (idx >= routeCount) { next = CUR(SEC_SLOW, 0); return snprintf(line, sz, "],\"slowest\":["); }
+      histJson(hist, sizeof(hist), routes[idx].h);
+      next = CUR(sec, idx + 1);
+      return snprintf(line, sz, "%s{\"path\":\"%s\",\"method\":\"%s\",%s}", idx ? "," : "",
+                      routes[idx].path, routes[idx].method, hist);
+    case SEC_SLOW: {
+      PerfSlowList sl;
+      slowPub.read(sl);
+      if (idx >= sl.n) { next = CUR(SEC_TAIL, 0); return 0; }
+      const PerfSlowIter &e = sl.it[idx];
+      n = snprintf(line, sz, "%s{\"at_ms\":%lu,\"total_us\":%lu,\"stages\":{", idx ? "," : "",
+                   (unsigned long) e.atMs, (unsigned long) e.totalUs);
+      for (uint8_t i = 0; i < PERF_ST_COUNT; i++) {
+        n += snprintf(line + n, (n < sz) ? sz - n : 0, "%s\"%s\":%lu", i ? "," : "", stageNames[i],
+                      (unsigned long) e.stageUs[i]);
+      }
+      n += snprintf(line + n, (n < sz) ? sz - n : 0, "}}");
+      next = CUR(sec, idx + 1);
+      return n;
+    }
+    case SEC_TAIL:
+      next = CUR(SEC_END, 0);
+      return snprintf(line, sz, "]}");
+    default:
+      next = cur;
+      return 0;
+  }
+}
+
+size_t perfRenderJson(uint32_t &cursor, char *out, size_t maxLen) {
+  char line[512];
+  size_t n = 0;
+  while (CUR_SEC(cursor) < SEC_END) {
+    uint32_t next;
+    size_t len = renderItem(cursor, next, line, sizeof(line));
+    if (len >= sizeof(line)) len = sizeof(line) - 1;
+    if (n + len > maxLen) break;
+    memcpy(out + n, line, len);
+    n += len;
+    cursor = next;
+  }
+  return n;
+}
+
+#endif
@@ -0,0 +1,89 @@
+#pragma once
+#include <Arduino.h>
+
+// ===== Laufzeitprofil =====
+// Zeitmessung über den Zykluszähler der CPU für die Stufen der Radio-Task-Schleife
+// (früher loop()) und für jeden Web-Handler. Jede Stufe und jede Route hat ein
+// Histogramm fester Größe mit vier Unterteilungen je Zweierpotenz (0 µs .. ~0,5 s);
+// p50/p99 werden daraus geschätzt (Fehler < 25 %), min/max sind exakt. Zusätzlich
+// bleiben die PERF_SLOW_N langsamsten Durchläufe mit Aufschlüsselung nach Stufen
+// erhalten. Schreiber sind nur der Radio-Task (Schleife) bzw. der AsyncTCP-Task
+// (Routen). Mit PERF_PROFILE 0 verschwinden alle Makros ersatzlos.
+
+#ifndef PERF_PROFILE
+#define PERF_PROFILE 1
+#endif
+
+#define PERF_HIST_BUCKETS 72   // bis 2^19 µs, größere Werte landen im letzten Bucket
+#define PERF_MAX_ROUTES   40
+#define PERF_SLOW_N       8
+
+// Stufen eines Schleifendurchlaufs in Ausführungsreihenfolge
+enum PerfStage : uint8_t {
+  PERF_ST_CMD = 0,     // Kommandos aus der Web-Queue
+  PERF_ST_SCAN,        // Sweep und Seek
+  PERF_ST_INPUT,       // Encoder und Taster
+  PERF_ST_RSSI,        // Signalqualität und Verlauf (History.h)
+  PERF_ST_RDS,
+  PERF_ST_HOUSEKEEP,   // Timeouts, Einstellungen speichern
+  PERF_ST_FLUSH,       // OLED
+  PERF_ST_PUBLISH,     // Snapshot für die Web-Handler
+  PERF_ST_COUNT
+};
+
+#if PERF_PROFILE
+
+typedef struct {
+  uint32_t count;
+  uint32_t minUs;
+  uint32_t maxUs;
+  uint64_t sumUs;
+  uint32_t hist[PERF_HIST_BUCKETS];
+} PerfHist;
+
+typedef struct {
+  uint32_t atMs;                    // millis() am Ende des Durchlaufs
+  uint32_t totalUs;
+  uint32_t stageUs[PERF_ST_COUNT];
+} PerfSlowIter;
+
+// CPU-Takt merken; vor dem Start des Radio-Tasks
+void perfBegin();
+
+// Radio-Task: Durchlauf beginnen, Stufe abschließen (Zeit seit der letzten
+// Marke), Durchlauf beenden
+void perfLoopBegin();
+void perfLap(uint8_t stage);
+void perfLoopEnd();
+
+// AsyncTCP-Task: Route anmelden (-1 = Tabelle voll) und Handler messen
+int  perfRouteRegister(const char *path, const char *method);
+void perfRouteRecord(uint8_t id, uint32_t cycles);
+
+class PerfRouteScope {
+public:
+  explicit PerfRouteScope(uint8_t id) : id_(id), core_(xPortGetCoreID()), start_(ESP.getCycleCount()) {}
+  ~PerfRouteScope();
+private:
+  uint8_t  id_, core_;
+  uint32_t start_;
+};
+
+// Alles zurücksetzen: Routen sofort, die Schleife zu Beginn ihres nächsten Durchlaufs
+void perfReset();
+
+// JSON stückweise erzeugen (für eine Chunked Response).
+// cursor startet bei 0; liefert die Anzahl geschriebener Bytes, 0 = fertig.
+size_t perfRenderJson(uint32_t &cursor, char *out, size_t maxLen);
+
+#define PERF_LOOP_BEGIN()   perfLoopBegin()
+#define PERF_LAP(stage)     perfLap(stage)
+#define PERF_LOOP_END()     perfLoopEnd()
+
+#else
+
+#define PERF_LOOP_BEGIN()   do {} while (0)
+#define PERF_LAP(stage)     do {} while (0)
+#define PERF_LOOP_END()     do {} while (0)
+
+#endif
@@ -0,0 +1,79 @@
+#include "RadioLogic.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// ===== Frequenzraster =====
+uint16_t alignMwToRegion(uint16_t f, uint16_t minF, uint16_t maxF, uint8_t region) {
+  const uint8_t sp = (region == REGION_9KHZ) ? 9 : 10;
+  const int base = (region == REGION_9KHZ) ? 531 : 530;
+  return alignToGrid(f, base, sp, minF, maxF);
+}
+
+uint16_t alignToGrid(uint16_t f, uint16_t base, uint8_t step, uint16_t minF, uint16_t maxF) {
+  long n = lround((f - base) / (double)step);
+  long aligned = base + n * (long)step;
+  if (aligned < minF) aligned = minF;
+  if (aligned > maxF) aligned = maxF;
+  return (uint16_t)aligned;
+}
+
+uint16_t wrapTune(uint16_t f, int32_t delta, uint16_t minF, uint16_t maxF) {
+  int32_t n = (int32_t) f + delta;
+  if (n > maxF) n = minF;
+  else if (n < minF) n = maxF;
+  return (uint16_t) n;
+}
+
+// ===== Anzeige =====
+// FM dreistellig vor dem Komma wie bisher ("087.5 MHz")
+size_t formatFreq(char *out, size_t outsz, uint16_t freq, bool isFM) {
+  int n = isFM ? snprintf(out, outsz, "%03u.%u MHz", (unsigned)(freq / 10), (unsigned)(freq % 10))
+               : snprintf(out, outsz, "%u kHz", (unsigned) freq);
+  if (n < 0) n = 0;
+  return ((size_t) n < outsz) ? (size_t) n : (outsz ? outsz - 1 : 0);
+}
+
+size_t formatFreqHz(char *out, size_t outsz, uint32_t hz) {
+  const uint32_t d = (hz + 5) / 10;   // 10-Hz-Einheiten
+  int n = snprintf(out, outsz, "%lu.%02lu kHz", (unsigned long)(d / 100), (unsigned long)(d % 100));
+  if (n < 0) n = 0;
+  return ((size_t) n < outsz) ? (size_t) n : (outsz ? outsz - 1 : 0);
+}
+
+// ===== SSB-Feinabstimmung =====
+bool fineTuneSplit(uint32_t hz, uint16_t curKHz, uint16_t window, uint16_t minKHz, uint16_t maxKHz,
+                   uint16_t &kHz, int16_t &bfo) {
+  if (hz < (uint32_t) minKHz * 1000) hz = (uint32_t) minKHz * 1000;
+  if (hz > (uint32_t) maxKHz * 1000) hz = (uint32_t) maxKHz * 1000;
+  const int32_t keep = (int32_t) curKHz * 1000 - (int32_t) hz;
+  if (keep >= -(int32_t) window && keep <= (int32_t) window) {
+    kHz = curKHz;
+    bfo = (int16_t) keep;
+    return false;
+  }
+  kHz = (uint16_t)((hz + 500) / 1000);
+  bfo = (int16_t)((int32_t) kHz * 1000 - (int32_t) hz);
+  return true;
+}
+
+// ===== Encoder-Beschleunigung =====
+// Schrittfaktor abhängig von der Drehgeschwindigkeit (Rastungen pro Sekunde)
+static const struct { uint16_t rate; uint8_t mult; } encAccelTab[] = {
+  {  0, 1 },
+  { 15, 2 },
+  { 30, 5 },
+  { 60, 10 },
+};
+
+uint8_t encAccelUpdate(EncAccel &st, uint32_t nowMs, int32_t detents) {
+  const uint32_t dt = nowMs - st.lastMs;
+  st.lastMs = nowMs;
+  if (dt > ENC_ACCEL_IDLE_MS) { st.rate = 0; return 1; }
+  const uint32_t inst = (uint32_t) labs(detents) * 1000UL / (dt ? dt : 1);
+  st.rate = (uint16_t)((inst + 3UL * st.rate) / 4);
+  uint8_t mult = 1;
+  for (uint8_t i = 0; i < sizeof(encAccelTab) / sizeof(encAccelTab[0]); i++)
+    if (st.rate >= encAccelTab[i].rate) mult = encAccelTab[i].mult;
+  return mult;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// ===== Radio-Logik ohne Hardware =====
+// Reine Rechenfunktionen aus der .ino (Frequenzraster, Bandgrenzen, Anzeige-
+// format, Encoder-Beschleunigung). Sie hängen weder von Arduino noch von rx,
+// OLED oder Zeitquellen ab – die Zeit wird als Parameter übergeben – und lassen
+// sich daher auch auf dem Host übersetzen, testen und messen.
+
+enum AMRegion : uint8_t { REGION_9KHZ = 0, REGION_10KHZ = 1 };
+
+// Auf das MW-Raster der Region runden (9 kHz ab 531, 10 kHz ab 530), begrenzt auf [minF, maxF]
+uint16_t alignMwToRegion(uint16_t f, uint16_t minF, uint16_t maxF, uint8_t region);
+// Auf base + n * step runden, begrenzt auf [minF, maxF]
+uint16_t alignToGrid(uint16_t f, uint16_t base, uint8_t step, uint16_t minF, uint16_t maxF);
+
+// f + delta; außerhalb des Bandes wird auf die andere Bandgrenze gesprungen
+uint16_t wrapTune(uint16_t f, int32_t delta, uint16_t minF, uint16_t maxF);
+
+// "101.3 MHz" (FM, 10-kHz-Einheiten) bzw. "1440 kHz"; liefert die Länge
+size_t formatFreq(char *out, size_t outsz, uint16_t freq, bool isFM);
+// "7074.35 kHz" aus Hz (SSB, 10-Hz-Auflösung); liefert die Länge
+size_t formatFreqHz(char *out, size_t outsz, uint32_t hz);
+
+// ===== SSB-Feinabstimmung =====
+// Empfangsfrequenz in Hz = kHz * 1000 - BFO. Passt der nötige BFO ins Fenster
+// ±window, bleibt der Chip auf kHz und nur der BFO ändert sich; sonst wird auf
+// den nächsten kHz-Wert neu abgestimmt und der Rest (höchstens ±500 Hz) über
+// den BFO gelegt. hz wird auf [minKHz, maxKHz] begrenzt.
+#define SSB_FINE_WINDOW_HZ 1000
+
+// Liefert true, wenn der Chip neu abgestimmt werden muss
+bool fineTuneSplit(uint32_t hz, uint16_t curKHz, uint16_t window, uint16_t minKHz, uint16_t maxKHz,
+                   uint16_t &kHz, int16_t &bfo);
+
+// ===== Encoder-Beschleunigung =====
+#define ENC_ACCEL_IDLE_MS 150   // längere Pause: Geschwindigkeit zurücksetzen
+
+typedef struct {
+  uint32_t lastMs;
+  uint16_t rate;        // geglättet, Rastungen/s
+} EncAccel;
+
+// Schrittfaktor für detents Rastungen zum Zeitpunkt nowMs
+uint8_t encAccelUpdate(EncAccel &st, uint32_t nowMs, int32_t detents);
@@ -0,0 +1,82 @@
+#include "RadioTask.h"
+#include "Bands.h"
+
+// ===== Queue und Snapshot =====
+static SpscQueue<RadioCmd, RADIO_CMD_QUEUE_LEN> cmdQueue;
+static SeqlockSnapshot<RadioSnapshot> snapshot;
+static SpscQueue<RadioBatch, RADIO_BATCH_QUEUE_LEN> batchQueue;
+static uint32_t batchSeq = 0;
+
+bool radioPost(uint8_t type, int32_t arg) {
+  RadioCmd c;
+  c.type = type;
+  c.arg = arg;
+  return cmdQueue.push(c);
+}
+
+bool radioPoll(RadioCmd &cmd) {
+  return cmdQueue.pop(cmd);
+}
+
+void radioPublish(const RadioSnapshot &s) {
+  snapshot.publish(s);
+}
+
+void radioGetSnapshot(RadioSnapshot &out) {
+  snapshot.read(out);
+}
+
+// ===== Batch =====
+// Zuerst den Batch, dann das Kommando einstellen (beide Queues haben denselben
+// Produzenten). Schlägt das Kommando fehl, bleibt ein verwaister Batch liegen;
+// radioPollBatch überspringt ihn beim nächsten RCMD_BATCH anhand der id.
+bool radioPostBatch(RadioBatch &b) {
+  b.id = ++batchSeq;
+  if (!batchQueue.push(b)) return false;
+  return radioPost(RCMD_BATCH, (int32_t) b.id);
+}
+
+bool radioPollBatch(uint32_t id, RadioBatch &b) {
+  while (batchQueue.pop(b)) {
+    if (b.id == id) return true;
+  }
+  return false;
+}
+
+uint8_t radioBatchCheck(const RadioBatch &b, uint8_t curBand, uint8_t curMode, uint8_t &mode) {
+  if (!b.has) return RBE_EMPTY;
+  const uint8_t band = (b.has & RB_BAND) ? b.band : curBand;
+  if (band >= BAND_COUNT) return RBE_BAND;
+  const BandDesc &d = bandDesc[band];
+  const bool fm = (d.type == FM_BAND_TYPE);
+
+  // Ohne Modusangabe: FM-Band -> FM, sonst bleibt SSB erhalten, alles andere wird AM
+  if (b.has & RB_MODE) mode = b.mode;
+  else if (fm) mode = BAND_MODE_FM;
+  else mode = (curMode == BAND_MODE_LSB || curMode == BAND_MODE_USB) ? curMode : BAND_MODE_AM;
+  if (fm != (mode == BAND_MODE_FM) || mode > BAND_MODE_AM) return RBE_MODE;
+
+  if ((b.has & RB_FREQ) && (b.freq < d.minimumFreq || b.freq > d.maximumFreq)) return RBE_FREQ;
+  if ((b.has & RB_STEP) && b.stepIdx >= (fm ? BAND_FM_STEPS : BAND_AM_STEPS)) return RBE_STEP;
+  if (b.has & RB_BW) {
+    const uint8_t n = fm ? BAND_FM_BWS : (mode == BAND_MODE_AM) ? BAND_AM_ONLY_BWS : BAND_AM_BWS;
+    if (b.bwIdx >= n) return RBE_BW;
+  }
+  if ((b.has & RB_AGC) && b.agcIdx > RADIO_AGC_MAX) return RBE_AGC;
+  if ((b.has & RB_VOLUME) && b.volume > RADIO_VOLUME_MAX) return RBE_VOLUME;
+  if ((b.has & RB_BFO) && (b.bfo > RADIO_BFO_LIMIT || b.bfo < -RADIO_BFO_LIMIT)) return RBE_BFO;
+  return RBE_OK;
+}
+
+const char *radioBatchErrStr(uint8_t err) {
+  static const char *const names[RBE_COUNT] = {
+    "ok", "empty batch", "invalid band", "mode not available in band", "freq outside band",
+    "invalid step", "invalid bw", "invalid agc", "invalid volume", "invalid bfo", "result unknown"
+  };
+  return (err < RBE_COUNT) ? names[err] : "unknown";
+}
+
+uint8_t radioBatchResult(const RadioSnapshot &s, uint32_t id) {
+  const RadioBatchResult &r = s.batchRes[id % RADIO_BATCH_RESULTS];
+  return (id != 0 && r.id == id) ? r.err : RBE_UNKNOWN;
+}
@@ -0,0 +1,191 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// ===== Radio-Task =====
+// Der Radio-Task ist der einzige, der rx (SI4735), die OLED und damit den
+// I2C-Bus bedient. Andere Tasks (AsyncTCP/Web) schicken Kommandos über eine
+// Queue und lesen nur den veröffentlichten Zustands-Snapshot.
+
+#define RADIO_TASK_CORE     1
+#define RADIO_TASK_PRIO     2
+#define RADIO_TASK_STACK    8192
+#define RADIO_CMD_QUEUE_LEN 16   // Zweierpotenz
+
+// ===== Kommandos =====
+enum RadioCmdType : uint8_t {
+  RCMD_NONE = 0,
+  RCMD_SET_FREQ,    // arg = Frequenz (kHz bzw. 10-kHz-Einheiten bei FM)
+  RCMD_SET_FREQ_HZ, // arg = Frequenz in Hz; LSB/USB über die BFO-Feinabstimmung
+  RCMD_TUNE_DELTA,  // arg = Delta in denselben Einheiten
+  RCMD_SET_BAND,    // arg = Band-Index
+  RCMD_BAND_STEP,   // arg = +1 / -1
+  RCMD_MODE_STEP,   // arg = +1 / -1
+  RCMD_SCAN_START,  // Parameter in scan.req (BandScan.h)
+  RCMD_SCAN_STOP,
+  RCMD_SEEK_START,  // arg = 1 aufwärts, 0 abwärts
+  RCMD_SEEK_CANCEL,
+  RCMD_MEM_RECALL,  // arg = Slot des Speicherkanals
+  RCMD_BATCH,       // Parameter in der Batch-Queue (radioPostBatch)
+  RCMD_MSCAN_START, // Kanalliste in mscan.req (MemScan.h)
+  RCMD_MSCAN_STOP,
+  RCMD_MBENCH_START, // arg = Durchläufe des Moduswechsel-Benchmarks (ModeSwitch.h)
+};
+
+typedef struct {
+  uint8_t type;
+  int32_t arg;
+} RadioCmd;
+
+// ===== Veröffentlichter Zustand =====
+// Ergebnisse der letzten Batches; ein späterer Batch überschreibt den Fehler-
+// code eines früheren so erst nach RADIO_BATCH_RESULTS weiteren Batches
+#define RADIO_BATCH_RESULTS 8
+
+typedef struct {
+  uint32_t id;
+  uint8_t  err;      // RadioBatchErr
+} RadioBatchResult;
+
+typedef struct {
+  uint16_t freq;     // kHz bzw. 10-kHz-Einheiten (FM)
+  uint32_t freqHz;   // Empfangsfrequenz in Hz, in LSB/USB samt BFO
+  uint8_t  mode;     // FM/LSB/USB/AM wie in der .ino
+  uint8_t  bandIdx;
+  uint8_t  rssi;     // dBµV
+  uint8_t  snr;      // dB
+  uint8_t  volume;
+  bool     isFM;
+  bool     pilot;
+  bool     seeking;  // Seek läuft, freq ist die aktuelle Zwischenfrequenz
+  int16_t  stepKHz;
+  int16_t  bfo;
+  uint8_t  stepIdx;
+  uint8_t  bwIdx;
+  int16_t  memSlot;  // nächster Speicherkanal im Abstand einer Schrittweite, sonst -1
+  char     ps[9];    // RDS-PS (nur FM), 8 Zeichen + 0
+  char     memName[20];
+  uint8_t  agcIdx;   // 0 = AGC an, 1 = AGC aus, >1 Dämpfung agcIdx-1
+  uint32_t batchId;  // zuletzt ausgeführter Batch
+  RadioBatchResult batchRes[RADIO_BATCH_RESULTS];   // Index id % RADIO_BATCH_RESULTS
+} RadioSnapshot;
+
+// ===== Batch =====
+// Mehrere Einstellungen als eine Transaktion: der Web-Task prüft alle Werte
+// vorab, der Radio-Task prüft sie gegen den dann aktuellen Stand erneut und
+// wendet sie gemeinsam an (höchstens ein Bandwechsel, nur geänderte Werte).
+#define RADIO_BATCH_QUEUE_LEN 4     // Zweierpotenz
+#define RADIO_AGC_MAX         35
+#define RADIO_VOLUME_MAX      63
+#define RADIO_BFO_LIMIT       16383 // Hz, Eigenschaft SSB_BFO des SI4735
+
+enum RadioBatchField : uint8_t {
+  RB_BAND   = 0x01,
+  RB_MODE   = 0x02,
+  RB_FREQ   = 0x04,
+  RB_STEP   = 0x08,
+  RB_BW     = 0x10,
+  RB_AGC    = 0x20,
+  RB_VOLUME = 0x40,
+  RB_BFO    = 0x80,
+};
+
+enum RadioBatchErr : uint8_t {
+  RBE_OK = 0,
+  RBE_EMPTY,
+  RBE_BAND,
+  RBE_MODE,     // Modus passt nicht zum Bandtyp
+  RBE_FREQ,     // außerhalb des Zielbandes
+  RBE_STEP,
+  RBE_BW,
+  RBE_AGC,
+  RBE_VOLUME,
+  RBE_BFO,
+  RBE_UNKNOWN,  // Ergebnis nicht mehr im Snapshot (bzw. Batch verworfen)
+  RBE_COUNT
+};
+
+typedef struct {
+  uint32_t id;
+  uint8_t  has;      // RadioBatchField
+  uint8_t  band, mode, stepIdx, bwIdx, agcIdx, volume;
+  uint16_t freq;     // kHz bzw. 10-kHz-Einheiten (FM)
+  int16_t  bfo;      // Hz
+} RadioBatch;
+
+// Lock-freie Ring-Queue für genau einen Produzenten und einen Konsumenten.
+// Produzent ist der AsyncTCP-Task (alle Web-Handler laufen dort), Konsument
+// der Radio-Task.
+template <typename T, uint16_t N>
+class SpscQueue {
+  static_assert((N & (N - 1)) == 0, "N muss eine Zweierpotenz sein");
+public:
+  bool push(const T &v) {
+    uint16_t h = head.load(std::memory_order_relaxed);
+    uint16_t t = tail.load(std::memory_order_acquire);
+    if ((uint16_t)(h - t) == N) return false;
+    buf[h & (N - 1)] = v;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+  bool pop(T &v) {
+    uint16_t t = tail.load(std::memory_order_relaxed);
+    uint16_t h = head.load(std::memory_order_acquire);
+    if (h == t) return false;
+    v = buf[t & (N - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+private:
+  std::atomic<uint16_t> head{0};
+  std::atomic<uint16_t> tail{0};
+  T buf[N];
+};
+
+// Doppelt gepufferter Seqlock für genau einen Schreiber. Der Schreiber füllt
+// immer den gerade nicht veröffentlichten Slot, Leser kopieren den zuletzt
+// fertigen Slot und müssen nur wiederholen, wenn der Schreiber in der
+// Zwischenzeit zweimal veröffentlicht hat. Niemand wartet auf einen Lock.
+template <typename T>
+class SeqlockSnapshot {
+public:
+  void publish(const T &v) {
+    uint32_t s = seq.load(std::memory_order_relaxed);
+    seq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(&slot[((s >> 1) + 1) & 1], &v, sizeof(T));
+    seq.store(s + 2, std::memory_order_release);
+  }
+  void read(T &out) const {
+    for (;;) {
+      uint32_t s1 = seq.load(std::memory_order_acquire);
+      memcpy(&out, &slot[(s1 >> 1) & 1], sizeof(T));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      uint32_t s2 = seq.load(std::memory_order_relaxed);
+      if ((uint32_t)(s2 - (s1 & ~1u)) < 3) return;
+    }
+  }
+  uint32_t version() const { return seq.load(std::memory_order_acquire) >> 1; }
+private:
+  std::atomic<uint32_t> seq{0};
+  T slot[2];
+};
+
+// Von Web-Handlern aufrufbar (nur Speicherzugriffe, kein I2C, kein delay)
+bool radioPost(uint8_t type, int32_t arg = 0);
+void radioGetSnapshot(RadioSnapshot &out);
+// Vergibt b.id und stellt den Batch samt RCMD_BATCH ein; false = Queue voll
+bool radioPostBatch(RadioBatch &b);
+
+// Prüft b gegen Band und Modus (curBand/curMode gelten für fehlende Felder).
+// Liefert auch den Zielmodus; reine Tabellenzugriffe, von beiden Tasks aufrufbar.
+uint8_t radioBatchCheck(const RadioBatch &b, uint8_t curBand, uint8_t curMode, uint8_t &mode);
+const char *radioBatchErrStr(uint8_t err);
+// Ergebnis des Batches id aus dem Snapshot; RBE_UNKNOWN, wenn nicht (mehr) enthalten
+uint8_t radioBatchResult(const RadioSnapshot &s, uint32_t id);
+
+// Nur vom Radio-Task aufzurufen
+bool radioPoll(RadioCmd &cmd);
+// Batch zum Kommando RCMD_BATCH mit arg = id holen
+bool radioPollBatch(uint32_t id, RadioBatch &b);
+void radioPublish(const RadioSnapshot &s);
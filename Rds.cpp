@@ -0,0 +1,269 @@
+#include "Rds.h"
+#include <Wire.h>
+#include "RadioTask.h"
+#include "I2cMetrics.h"
+
+#define CMD_FM_RDS_STATUS   0x24
+#define RDS_STATUS_LEN      13
+#define CTS_TRIES           10
+
+// ===== Zustand =====
+static uint8_t  addr = 0x11;
+static RdsState st;                       // nur Radio-Task
+static SeqlockSnapshot<RdsState> published;
+static bool     dirty = false;
+
+// Ringpuffer der Rohgruppen; Schreiber ist der Radio-Task
+static RdsGroup ring[RDS_RING_LEN];
+static std::atomic<uint32_t> ringHead{0};
+
+static uint32_t nextPollAt = 0;
+static uint32_t lastValidAt = 0;
+
+// Zwischenspeicher für Texte, die erst vollständig übernommen werden
+static char     psCand[9], psPrev[9];
+static uint8_t  psMask = 0;
+static char     rtCand[65];
+static uint16_t rtMask = 0;
+static int8_t   rtAB = -1;
+static char     ptynCand[9];
+static uint8_t  ptynMask = 0;
+
+static inline uint8_t blkErr(const RdsGroup &g, uint8_t b) { return (g.err >> (6 - 2 * b)) & 3; }
+
+static inline char rdsChar(uint8_t c) { return (c >= 32 && c < 127) ? (char) c : ' '; }
+
+// ===== I2C =====
+// Eine Gruppe aus der FIFO holen. fifoUsed == 0: keine Gruppe enthalten.
+static bool readStatus(RdsGroup &g, uint8_t &fifoUsed, bool &sync) {
+  I2C_SCOPE(m, I2C_DEV_SI4735, I2C_OP_RDS, 2);
+  Wire.beginTransmission(addr);
+  Wire.write(CMD_FM_RDS_STATUS);
+  Wire.write(0x01);                      // INTACK
+  if (Wire.endTransmission() != 0) { I2C_SCOPE_NACK(m); return false; }
+
+  uint8_t r[RDS_STATUS_LEN];
+  for (uint8_t t = 0; t < CTS_TRIES; t++) {
+    if (t) I2C_SCOPE_RETRY(m);
+    delayMicroseconds(300);
+    if (Wire.requestFrom(addr, (uint8_t) RDS_STATUS_LEN) != RDS_STATUS_LEN) { I2C_SCOPE_NACK(m); return false; }
+    I2C_SCOPE_BYTES(m, RDS_STATUS_LEN);
+    for (uint8_t i = 0; i < RDS_STATUS_LEN; i++) r[i] = Wire.read();
+    if (r[0] & 0x80) break;              // CTS
+    if (t == CTS_TRIES - 1) return false;
+  }
+  sync = r[2] & 0x01;
+  fifoUsed = r[3];
+  for (uint8_t b = 0; b < 4; b++) g.blk[b] = ((uint16_t) r[4 + 2 * b] << 8) | r[5 + 2 * b];
+  g.err = r[12];
+  return true;
+}
+
+// ===== Dekoder =====
+static void clearState() {
+  const uint16_t poll = st.pollMs;
+  memset(&st, 0, sizeof(st));
+  st.pollMs = poll;
+  psMask = rtMask = ptynMask = 0;
+  psPrev[0] = '\0';
+  rtAB = -1;
+  dirty = true;
+}
+
+static void addAf(uint8_t code) {
+  if (code < 1 || code > 204) return;              // 205.. Füllcodes, Anzahl, LF/MF
+  const uint16_t f = 8750 + code * 10;
+  for (uint8_t i = 0; i < st.afCount; i++) if (st.af[i] == f) return;
+  if (st.afCount < RDS_MAX_AF) { st.af[st.afCount++] = f; dirty = true; }
+}
+
+// Gruppe 0A/0B: PS, TA/MS, AF (nur 0A)
+static void decodePs(const RdsGroup &g, bool versionB) {
+  const uint16_t b = g.blk[1];
+  if (st.ta != (bool)(b & 0x10) || st.ms != (bool)(b & 0x08)) { st.ta = b & 0x10; st.ms = b & 0x08; dirty = true; }
+  if (!versionB && blkErr(g, 2) <= RDS_ERR_OK) { addAf(g.blk[2] >> 8); addAf(g.blk[2] & 0xFF); }
+  if (blkErr(g, 3) > RDS_ERR_OK) return;
+
+  const uint8_t seg = b & 3;
+  psCand[seg * 2]     = rdsChar(g.blk[3] >> 8);
+  psCand[seg * 2 + 1] = rdsChar(g.blk[3] & 0xFF);
+  psMask |= 1 << seg;
+  if (psMask != 0x0F) return;
+
+  // Vollständig: erst übernehmen, wenn zwei Durchläufe übereinstimmen
+  psCand[8] = '\0';
+  psMask = 0;
+  if (strcmp(psCand, psPrev) == 0 && strcmp(psCand, st.ps) != 0) { strcpy(st.ps, psCand); dirty = true; }
+  strcpy(psPrev, psCand);
+}
+
+// Gruppe 2A/2B: RadioText, A/B-Flag löscht den Text
+static void decodeRt(const RdsGroup &g, bool versionB) {
+  const uint16_t b = g.blk[1];
+  const uint8_t ab = (b >> 4) & 1;
+  if (rtAB != ab) {
+    rtAB = ab;
+    memset(rtCand, ' ', sizeof(rtCand) - 1);
+    rtCand[64] = '\0';
+    rtMask = 0;
+  }
+  const uint8_t seg = b & 0x0F;
+  char c[4];
+  uint8_t n = 0;
+  if (!versionB) {
+    if (blkErr(g, 2) > RDS_ERR_OK || blkErr(g, 3) > RDS_ERR_OK) return;
+    c[n++] = g.blk[2] >> 8; c[n++] = g.blk[2] & 0xFF;
+  } else if (blkErr(g, 3) > RDS_ERR_OK) {
+    return;
+  }
+  c[n++] = g.blk[3] >> 8; c[n++] = g.blk[3] & 0xFF;
+
+  const uint8_t pos = seg * n;
+  int8_t end = -1;
+  for (uint8_t i = 0; i < n && pos + i < 64; i++) {
+    if (c[i] == 0x0D) { end = pos + i; break; }
+    rtCand[pos + i] = rdsChar(c[i]);
+  }
+  rtMask |= 1 << seg;
+
+  // Übernehmen, sobald alle Segmente bis zum Textende da sind
+  uint8_t lastSeg = 15;
+  if (end >= 0) { rtCand[end] = '\0'; lastSeg = seg; }
+  const uint16_t need = (lastSeg >= 15) ? 0xFFFF : (uint16_t)((1u << (lastSeg + 1)) - 1);
+  if ((rtMask & need) != need) return;
+  char text[65];
+  strncpy(text, rtCand, sizeof(text));
+  text[versionB ? 32 : 64] = '\0';
+  // Leerzeichen am Ende abschneiden
+  for (int i = strlen(text) - 1; i >= 0 && text[i] == ' '; i--) text[i] = '\0';
+  if (strcmp(text, st.rt) != 0 || st.rtAB != ab) { strcpy(st.rt, text); st.rtAB = ab; dirty = true; }
+}
+
+// Gruppe 4A: Uhrzeit (nur fehlerfreie Blöcke)
+static void decodeCt(const RdsGroup &g) {
+  if (blkErr(g, 1) || blkErr(g, 2) || blkErr(g, 3)) return;
+  const uint16_t b = g.blk[1], c = g.blk[2], d = g.blk[3];
+  const uint8_t hour = ((c & 1) << 4) | (d >> 12);
+  const uint8_t minute = (d >> 6) & 0x3F;
+  if (hour > 23 || minute > 59) return;
+  st.ctMjd = ((uint32_t)(b & 3) << 15) | (c >> 1);
+  st.ctHour = hour;
+  st.ctMinute = minute;
+  st.ctOffset = (d & 0x20) ? -(int8_t)(d & 0x1F) : (int8_t)(d & 0x1F);
+  st.ctAtMs = millis();
+  st.ctValid = true;
+  dirty = true;
+}
+
+// Gruppe 10A: PTYN
+static void decodePtyn(const RdsGroup &g) {
+  if (blkErr(g, 2) > RDS_ERR_OK || blkErr(g, 3) > RDS_ERR_OK) return;
+  const uint8_t seg = g.blk[1] & 1;
+  ptynCand[seg * 4]     = rdsChar(g.blk[2] >> 8);
+  ptynCand[seg * 4 + 1] = rdsChar(g.blk[2] & 0xFF);
+  ptynCand[seg * 4 + 2] = rdsChar(g.blk[3] >> 8);
+  ptynCand[seg * 4 + 3] = rdsChar(g.blk[3] & 0xFF);
+  ptynMask |= 1 << seg;
+  if (ptynMask != 3) return;
+  ptynCand[8] = '\0';
+  ptynMask = 0;
+  if (strcmp(ptynCand, st.ptyn) != 0) { strcpy(st.ptyn, ptynCand); dirty = true; }
+}
+
+static void decodeGroup(const RdsGroup &g) {
+  if (blkErr(g, 1) > RDS_ERR_OK) { st.errors++; return; }
+  const uint16_t b = g.blk[1];
+  const uint8_t type = b >> 12;
+  const bool versionB = b & 0x0800;
+
+  // PI aus Block A (bzw. Block C bei B-Gruppen); Senderwechsel setzt alles zurück
+  uint16_t pi = 0;
+  if (blkErr(g, 0) <= RDS_ERR_OK) pi = g.blk[0];
+  else if (versionB && blkErr(g, 2) <= RDS_ERR_OK) pi = g.blk[2];
+  if (pi && st.valid && pi != st.pi) clearState();
+  if (pi && pi != st.pi) { st.pi = pi; dirty = true; }
+
+  st.valid = true;
+  st.groups++;
+  lastValidAt = millis();
+
+  const uint8_t pty = (b >> 5) & 0x1F;
+  const bool tp = b & 0x0400;
+  if (pty != st.pty || tp != st.tp) { st.pty = pty; st.tp = tp; dirty = true; }
+
+  switch (type) {
+    case 0:  decodePs(g, versionB); break;
+    case 2:  decodeRt(g, versionB); break;
+    case 4:  if (!versionB) decodeCt(g); break;
+    case 10: if (!versionB) decodePtyn(g); break;
+    default: break;
+  }
+}
+
+// ===== API =====
+void rdsBegin(uint8_t i2cAddr) {
+  if (i2cAddr) addr = i2cAddr;
+  st.pollMs = RDS_POLL_MIN_MS;
+  rdsReset();
+}
+
+void rdsReset() {
+  clearState();
+  nextPollAt = millis() + RDS_POLL_MIN_MS;
+  published.publish(st);
+  dirty = false;
+}
+
+bool rdsService() {
+  const uint32_t now = millis();
+  if ((int32_t)(now - nextPollAt) < 0) return false;
+
+  char psBefore[9];
+  strcpy(psBefore, st.ps);
+
+  // FIFO in einem Schub leeren
+  uint8_t n = 0;
+  bool sync = false;
+  for (; n < RDS_MAX_BURST; ) {
+    RdsGroup g;
+    uint8_t used;
+    if (!readStatus(g, used, sync) || used == 0) break;
+    const uint32_t h = ringHead.load(std::memory_order_relaxed);
+    ring[h & (RDS_RING_LEN - 1)] = g;
+    ringHead.store(h + 1, std::memory_order_release);
+    decodeGroup(g);
+    n++;
+    if (used <= 1) break;
+  }
+
+  // Intervall an den Füllstand anpassen: volle Schübe -> öfter, leere -> seltener
+  uint16_t poll = st.pollMs;
+  if (!sync && n == 0)                  poll = RDS_POLL_IDLE_MS;
+  else if (n >= 2 * RDS_BURST_TARGET)   poll = poll / 2;
+  else if (n > RDS_BURST_TARGET)        poll = poll * 3 / 4;
+  else if (n < RDS_BURST_TARGET)        poll = poll + poll / 4 + 1;
+  if (sync || n) poll = constrain(poll, RDS_POLL_MIN_MS, RDS_POLL_MAX_MS);
+  if (poll != st.pollMs) { st.pollMs = poll; dirty = true; }
+  nextPollAt = now + poll;
+
+  // lastValidAt kann während des Schubs hinter now liegen: mit der aktuellen Zeit vergleichen
+  if (st.valid && (millis() - lastValidAt) > RDS_LOSS_MS) clearState();
+
+  if (dirty) { published.publish(st); dirty = false; }
+  return strcmp(psBefore, st.ps) != 0;
+}
+
+const RdsState &rdsLocal() { return st; }
+
+void rdsGetState(RdsState &out) { published.read(out); }
+
+uint16_t rdsGetRaw(RdsGroup *out, uint16_t max) {
+  for (;;) {
+    const uint32_t h = ringHead.load(std::memory_order_acquire);
+    uint16_t n = (h < RDS_RING_LEN) ? h : RDS_RING_LEN;
+    if (n > max) n = max;
+    for (uint16_t i = 0; i < n; i++) out[i] = ring[(h - n + i) & (RDS_RING_LEN - 1)];
+    // Während des Kopierens überschrieben? Dann erneut
+    if ((uint32_t)(ringHead.load(std::memory_order_acquire) - h) <= (uint32_t)(RDS_RING_LEN - n)) return n;
+  }
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// ===== RDS =====
+// Der Radio-Task leert die RDS-FIFO des SI4735 per FM_RDS_STATUS direkt über
+// Wire in Schüben, legt die Rohgruppen (Blöcke A-D mit Fehlerstufen) in einen
+// Ringpuffer und dekodiert sie inkrementell. Der dekodierte Stand wird wie der
+// Radio-Snapshot über einen Seqlock veröffentlicht.
+
+#define RDS_RING_LEN        64     // Rohgruppen, Zweierpotenz
+#define RDS_MAX_BURST       16     // Gruppen pro Abfrage
+#define RDS_POLL_MIN_MS     40
+#define RDS_POLL_MAX_MS     400
+#define RDS_POLL_IDLE_MS    500    // ohne Sync
+#define RDS_BURST_TARGET    4      // angestrebte Gruppen pro Abfrage
+#define RDS_LOSS_MS         2500   // so lange ohne gültige Gruppe: Stand löschen
+#define RDS_MAX_AF          25
+
+// Fehlerstufe je Block (BLEx): 0 fehlerfrei, 1 = 1-2 Bit, 2 = 3-5 Bit korrigiert, 3 unbrauchbar
+#define RDS_ERR_OK          1      // höchste akzeptierte Stufe für Textdaten
+
+typedef struct {
+  uint16_t blk[4];     // A, B, C, D
+  uint8_t  err;        // BLEA<<6 | BLEB<<4 | BLEC<<2 | BLED
+} RdsGroup;
+
+typedef struct {
+  bool     valid;      // seit dem letzten Reset mindestens eine gültige Gruppe
+  uint16_t pi;
+  uint8_t  pty;
+  bool     tp, ta, ms;
+  char     ps[9];
+  char     ptyn[9];
+  char     rt[65];
+  uint8_t  rtAB;
+  uint8_t  afCount;
+  uint16_t af[RDS_MAX_AF];   // 10-kHz-Einheiten wie die FM-Frequenz
+  bool     ctValid;
+  uint32_t ctMjd;
+  uint8_t  ctHour, ctMinute;
+  int8_t   ctOffset;   // lokale Abweichung in halben Stunden
+  uint32_t ctAtMs;     // millis() beim Empfang
+  uint32_t groups;     // gültige Gruppen seit dem Reset
+  uint32_t errors;     // verworfene Gruppen (Block B unbrauchbar)
+  uint16_t pollMs;     // aktuelles Abfrageintervall
+} RdsState;
+
+// Radio-Task
+void rdsBegin(uint8_t i2cAddr);
+void rdsReset();
+// Abfrage fällig? Dann FIFO leeren und dekodieren. true = PS geändert
+bool rdsService();
+const RdsState &rdsLocal();
+
+// Web-Handler
+void rdsGetState(RdsState &out);
+// Kopiert bis zu max der neuesten Rohgruppen (älteste zuerst), liefert die Anzahl
+uint16_t rdsGetRaw(RdsGroup *out, uint16_t max);
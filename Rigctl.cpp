@@ -0,0 +1,462 @@
+#include "Rigctl.h"
+#include <AsyncTCP.h>
+#include <stdarg.h>
+#include "RadioTask.h"
+#include "Bands.h"
+
+// ===== Hamlib-Konstanten =====
+// RPRT-Werte sind die negierten RIG_E*-Codes
+#define RPRT_OK        0
+#define RPRT_EINVAL   -1
+#define RPRT_ENIMPL   -4
+#define RPRT_ERJCTED  -9
+#define RPRT_ENAVAIL  -11
+
+#define HL_MODE_AM    0x01
+#define HL_MODE_USB   0x04
+#define HL_MODE_LSB   0x08
+#define HL_MODE_WFM   0x40
+#define HL_MODE_RX    (HL_MODE_AM | HL_MODE_USB | HL_MODE_LSB)
+#define HL_LEVEL_STRENGTH 0x40000000UL
+
+#define HL_MODEL_NETRIGCTL 2
+#define S9_DBUV       34     // S9 = 50 µV an 50 Ohm
+
+// Durchlassbreiten in Hz, Reihenfolge wie bandwidthFM/SSB/AM in der .ino
+static const uint32_t bwFmHz[BAND_FM_BWS]      = { 0, 110000, 84000, 60000, 40000 };   // 0 = automatisch
+static const uint32_t bwSsbHz[BAND_AM_BWS]     = { 500, 1000, 1200, 2200, 3000, 4000 };
+static const uint32_t bwAmHz[BAND_AM_ONLY_BWS] = { 1000, 1800, 2000, 2500, 3000, 4000, 6000 };
+
+// ===== Zustand (nur AsyncTCP-Task) =====
+typedef struct {
+  AsyncClient *c;
+  char    line[RIGCTL_LINE_MAX];
+  uint8_t len;
+  bool    overflow;
+  bool    quit;                  // nach dem Senden der Antworten schließen
+  char    tx[RIGCTL_TX_MAX];     // noch nicht an TCP übergeben
+  size_t  txLen;
+  uint8_t in[RIGCTL_IN_MAX];     // noch nicht ausgeführt, Empfang nicht quittiert
+  size_t  inLen;
+  size_t  ackOwed;               // ausgeführte, noch nicht quittierte Bytes
+} RigClient;
+
+static AsyncServer *server = nullptr;
+static RigClient clients[RIGCTL_MAX_CLIENTS];
+
+// Gerade gesetzte Werte: der Snapshot zieht erst nach einigen ms nach, ein
+// "F ..." gefolgt von "f" im selben Paket soll trotzdem den neuen Wert sehen.
+// Werte, die erst der Radio-Task kennt (Frequenz und Bandbreite des neuen
+// Bandes, bandState gehört ihm), bleiben offen und kommen aus dem Snapshot.
+static struct {
+  bool     active;
+  bool     freqSet, bwSet;
+  uint32_t ms;
+  uint32_t freqHz;
+  uint16_t freq;
+  uint8_t  band, mode, bwIdx;
+} pending;
+
+// Client, dessen Zeilen gerade ausgeführt werden; outf schreibt in seinen Puffer
+static RigClient *cur = nullptr;
+
+// ===== Ausgabe =====
+static void outf(const char *fmt, ...) {
+  char *out = cur->tx;
+  size_t &len = cur->txLen;
+  if (len >= RIGCTL_TX_MAX - 1) return;
+  va_list ap;
+  va_start(ap, fmt);
+  const int n = vsnprintf(out + len, RIGCTL_TX_MAX - len, fmt, ap);
+  va_end(ap);
+  if (n > 0) len += ((size_t) n < RIGCTL_TX_MAX - len) ? (size_t) n : RIGCTL_TX_MAX - 1 - len;
+}
+
+static void rprt(int code) { outf("RPRT %d\n", code); }
+
+// Ausstehende Antworten übergeben, soweit der TCP-Sendepuffer Platz hat
+static void outFlush(RigClient &rc) {
+  size_t n = rc.c->space();
+  if (n > rc.txLen) n = rc.txLen;
+  if (n) n = rc.c->add(rc.tx, n);
+  if (!n) return;
+  memmove(rc.tx, rc.tx + n, rc.txLen - n);
+  rc.txLen -= n;
+  rc.c->send();
+}
+
+// Platz für die längste Antwort; sonst erst senden, was geht
+static bool outRoom(RigClient &rc) {
+  if (RIGCTL_TX_MAX - rc.txLen < RIGCTL_REPLY_MAX) outFlush(rc);
+  return RIGCTL_TX_MAX - rc.txLen >= RIGCTL_REPLY_MAX;
+}
+
+// ===== Umrechnung =====
+static inline bool bandIsFM(uint8_t band) { return bandDesc[band].type == FM_BAND_TYPE; }
+
+static uint32_t unitsToHz(uint16_t f, bool fm) {
+  return fm ? (uint32_t) f * 10000UL : (uint32_t) f * 1000UL;
+}
+
+static inline bool modeIsSSB(uint8_t mode) { return mode == BAND_MODE_LSB || mode == BAND_MODE_USB; }
+
+// Wie currentFrequencyHz() in der .ino: LSB/USB samt BFO
+static uint32_t snapHz(const RadioSnapshot &st) {
+  if (modeIsSSB(st.mode)) return (uint32_t)((int32_t) st.freq * 1000 - st.bfo);
+  return unitsToHz(st.freq, st.isFM);
+}
+
+static const char *hlModeName(uint8_t mode) {
+  switch (mode) {
+    case BAND_MODE_FM:  return "WFM";
+    case BAND_MODE_LSB: return "LSB";
+    case BAND_MODE_USB: return "USB";
+    default:            return "AM";
+  }
+}
+
+static int hlModeParse(const char *s) {
+  if (!strcmp(s, "WFM") || !strcmp(s, "FM"))     return BAND_MODE_FM;
+  if (!strcmp(s, "LSB") || !strcmp(s, "PKTLSB")) return BAND_MODE_LSB;
+  if (!strcmp(s, "USB") || !strcmp(s, "PKTUSB")) return BAND_MODE_USB;
+  if (!strcmp(s, "AM"))                          return BAND_MODE_AM;
+  return -1;
+}
+
+static const uint32_t *bwTable(uint8_t mode, uint8_t &n) {
+  if (mode == BAND_MODE_FM) { n = BAND_FM_BWS;      return bwFmHz; }
+  if (mode == BAND_MODE_AM) { n = BAND_AM_ONLY_BWS; return bwAmHz; }
+  n = BAND_AM_BWS;
+  return bwSsbHz;
+}
+
+static uint32_t passbandHz(uint8_t mode, uint8_t bwIdx) {
+  uint8_t n;
+  const uint32_t *t = bwTable(mode, n);
+  return (bwIdx < n) ? t[bwIdx] : 0;
+}
+
+static uint8_t passbandIdx(uint8_t mode, uint32_t hz) {
+  uint8_t n, best = 0;
+  const uint32_t *t = bwTable(mode, n);
+  uint32_t bestDiff = UINT32_MAX;
+  for (uint8_t i = 0; i < n; i++) {
+    if (!t[i]) continue;
+    const uint32_t d = (t[i] > hz) ? t[i] - hz : hz - t[i];
+    if (d < bestDiff) { bestDiff = d; best = i; }
+  }
+  return best;
+}
+
+// ===== Befehle =====
+// Snapshot, überlagert von gerade gesetzten Werten
+static void rigState(RadioSnapshot &st) {
+  radioGetSnapshot(st);
+  if (pending.active && (millis() - pending.ms) < RIGCTL_PENDING_MS) {
+    if (pending.freqSet) {
+      st.freq = pending.freq;
+      st.freqHz = pending.freqHz;
+    }
+    st.bandIdx = pending.band;
+    st.mode = pending.mode;
+    if (pending.bwSet) st.bwIdx = pending.bwIdx;
+    st.isFM = bandIsFM(pending.band);
+  } else {
+    pending.active = false;
+  }
+}
+
+static void pendingSet(const RadioSnapshot &st, bool freqSet, bool bwSet) {
+  pending.freqSet = freqSet;
+  pending.bwSet = bwSet;
+  pending.freq = st.freq;
+  pending.freqHz = st.freqHz;
+  pending.band = st.bandIdx;
+  pending.mode = st.mode;
+  pending.bwIdx = st.bwIdx;
+  pending.ms = millis();
+  pending.active = true;
+}
+
+// Frequenz im aktuellen Band per RCMD_SET_FREQ (LSB/USB Hz-genau per
+// RCMD_SET_FREQ_HZ), sonst Bandwechsel als Batch
+static int rigSetFreq(const char *arg) {
+  char *end;
+  const double v = strtod(arg, &end);
+  if (end == arg || v <= 0 || v > 4e9) return RPRT_EINVAL;
+  const uint32_t hz = (uint32_t)(v + 0.5);
+  const bool fm = hz >= 30000000UL;
+  const uint32_t u = fm ? (hz + 5000) / 10000 : (hz + 500) / 1000;
+  if (u < 1 || u > 0xFFFF) return RPRT_EINVAL;
+  const uint16_t f = (uint16_t) u;
+
+  RadioSnapshot st;
+  rigState(st);
+  bool bwSet = pending.active && pending.bwSet;
+  const BandDesc &d = bandDesc[st.bandIdx];
+  if (bandIsFM(st.bandIdx) == fm && f >= d.minimumFreq && f <= d.maximumFreq) {
+    if (!radioPost(modeIsSSB(st.mode) ? RCMD_SET_FREQ_HZ : RCMD_SET_FREQ, modeIsSSB(st.mode) ? (int32_t) hz : f))
+      return RPRT_ERJCTED;
+  } else {
+    const int band = bandFind(fm, f);
+    if (band < 0) return RPRT_EINVAL;
+    RadioBatch b;
+    memset(&b, 0, sizeof(b));
+    b.has = RB_BAND | RB_FREQ;
+    b.band = band;
+    b.freq = f;
+    uint8_t mode;
+    if (radioBatchCheck(b, st.bandIdx, st.mode, mode) != RBE_OK) return RPRT_EINVAL;
+    if (!radioPostBatch(b)) return RPRT_ERJCTED;
+    // Den Hz-Anteil legt danach die Feinabstimmung über den BFO
+    if (modeIsSSB(mode)) radioPost(RCMD_SET_FREQ_HZ, (int32_t) hz);
+    st.bandIdx = band;
+    st.mode = mode;
+    bwSet = false;    // Bandbreite des neuen Bandes kommt mit dem Snapshot
+  }
+  st.freq = f;
+  st.isFM = fm;
+  st.freqHz = modeIsSSB(st.mode) ? hz : unitsToHz(f, fm);
+  pendingSet(st, true, bwSet);
+  return RPRT_OK;
+}
+
+// Modus samt Durchlassbreite (0 = Vorgabe des Bandes, -1 = unverändert);
+// FM bzw. AM/SSB außerhalb des passenden Bandtyps wechselt ins erste Hauptband dafür
+static int rigSetMode(const char *name, const char *pb) {
+  const int mode = hlModeParse(name);
+  if (mode < 0) return RPRT_EINVAL;
+  const long width = pb ? strtol(pb, NULL, 10) : -1;
+
+  RadioSnapshot st;
+  rigState(st);
+  bool freqSet = pending.active && pending.freqSet;
+  bool bwSet = pending.active && pending.bwSet;
+  RadioBatch b;
+  memset(&b, 0, sizeof(b));
+  b.has = RB_MODE;
+  b.mode = mode;
+  if ((mode == BAND_MODE_FM) != bandIsFM(st.bandIdx)) {
+    int band = -1;
+    for (int i = 0; i < BAND_COUNT && band < 0; i++)
+      if ((bandDesc[i].flags & BF_MAIN) && bandIsFM(i) == (mode == BAND_MODE_FM)) band = i;
+    if (band < 0) return RPRT_ENAVAIL;
+    b.has |= RB_BAND;
+    b.band = band;
+  }
+  if (width > 0) {
+    b.has |= RB_BW;
+    b.bwIdx = passbandIdx(mode, width);
+  }
+  if (b.has == RB_MODE && mode == st.mode) return RPRT_OK;
+
+  uint8_t m;
+  if (radioBatchCheck(b, st.bandIdx, st.mode, m) != RBE_OK) return RPRT_EINVAL;
+  if (!radioPostBatch(b)) return RPRT_ERJCTED;
+  if (b.has & RB_BAND) {
+    // Frequenz und Bandbreite des neuen Bandes kommen mit dem Snapshot
+    st.bandIdx = b.band;
+    freqSet = bwSet = false;
+  }
+  if (b.has & RB_BW) {
+    st.bwIdx = b.bwIdx;
+    bwSet = true;
+  }
+  st.mode = m;
+  st.isFM = bandIsFM(st.bandIdx);
+  st.freqHz = snapHz(st);
+  pendingSet(st, freqSet, bwSet);
+  return RPRT_OK;
+}
+
+static void rigDumpState() {
+  // Empfangsbereiche aus der Bandtabelle
+  uint16_t amMin = 0xFFFF, amMax = 0, fmMin = 0xFFFF, fmMax = 0;
+  for (int i = 0; i < BAND_COUNT; i++) {
+    const BandDesc &d = bandDesc[i];
+    uint16_t &lo = bandIsFM(i) ? fmMin : amMin;
+    uint16_t &hi = bandIsFM(i) ? fmMax : amMax;
+    if (d.minimumFreq < lo) lo = d.minimumFreq;
+    if (d.maximumFreq > hi) hi = d.maximumFreq;
+  }
+  outf("0\n%d\n2\n", HL_MODEL_NETRIGCTL);   // Protokoll 0, Modell, ITU-Region
+  outf("%lu.000000 %lu.000000 0x%x -1 -1 0x1 0x0\n",
+       (unsigned long) unitsToHz(amMin, false), (unsigned long) unitsToHz(amMax, false), HL_MODE_RX);
+  outf("%lu.000000 %lu.000000 0x%x -1 -1 0x1 0x0\n",
+       (unsigned long) unitsToHz(fmMin, true), (unsigned long) unitsToHz(fmMax, true), HL_MODE_WFM);
+  outf("0 0 0 0 0 0 0\n");   // Ende der Empfangsbereiche
+  outf("0 0 0 0 0 0 0\n");   // kein Sender
+  outf("0x%x 10\n0x%x 1000\n0x%x 50000\n0 0\n",                 // Abstimmschritte, SSB über den BFO
+       HL_MODE_USB | HL_MODE_LSB, HL_MODE_AM, HL_MODE_WFM);
+  for (uint8_t i = 0; i < BAND_AM_BWS; i++)      outf("0x%x %lu\n", HL_MODE_USB | HL_MODE_LSB, (unsigned long) bwSsbHz[i]);
+  for (uint8_t i = 0; i < BAND_AM_ONLY_BWS; i++) outf("0x%x %lu\n", HL_MODE_AM, (unsigned long) bwAmHz[i]);
+  for (uint8_t i = 1; i < BAND_FM_BWS; i++)      outf("0x%x %lu\n", HL_MODE_WFM, (unsigned long) bwFmHz[i]);
+  outf("0 0\n");             // Ende der Filter
+  outf("0\n0\n0\n0\n");      // max_rit, max_xit, max_ifshift, announces
+  outf("0\n0\n");            // Vorverstärker, Abschwächer
+  outf("0x0\n0x0\n0x%lx\n0x0\n0x0\n0x0\n", HL_LEVEL_STRENGTH);   // get/set func, level, parm
+}
+
+static const struct { const char *name; char cmd; } longNames[] = {
+  { "set_freq", 'F' }, { "get_freq", 'f' }, { "set_mode", 'M' }, { "get_mode", 'm' },
+  { "get_level", 'l' }, { "set_vfo", 'V' }, { "get_vfo", 'v' }, { "set_ptt", 'T' },
+  { "get_ptt", 't' }, { "get_split_vfo", 's' },
+};
+
+// Eine Zeile ausführen und die Antwort anhängen; false = Verbindung schließen
+static bool rigCommand(char *line) {
+  char *argv[4];
+  int argc = 0;
+  char *save = nullptr;
+  for (char *p = strtok_r(line, " \t", &save); p && argc < 4; p = strtok_r(NULL, " \t", &save)) argv[argc++] = p;
+  if (argc == 0) return true;
+
+  char cmd = argv[0][0];
+  if (cmd == '\\') {
+    const char *name = argv[0] + 1;
+    if (!strcmp(name, "dump_state"))    { rigDumpState(); return true; }
+    if (!strcmp(name, "chk_vfo"))       { outf("CHKVFO 0\n"); return true; }
+    if (!strcmp(name, "get_powerstat")) { outf("1\n"); return true; }
+    cmd = 0;
+    for (size_t i = 0; i < sizeof(longNames) / sizeof(longNames[0]); i++)
+      if (!strcmp(name, longNames[i].name)) cmd = longNames[i].cmd;
+  } else if (argv[0][1]) {
+    // Kurzbefehl ohne Leerzeichen vor dem Argument ("F7074000")
+    if (argc == 4) argc--;
+    for (int i = argc; i > 1; i--) argv[i] = argv[i - 1];
+    argv[1] = argv[0] + 1;
+    argc++;
+  }
+  const char *arg1 = (argc > 1) ? argv[1] : nullptr;
+  const char *arg2 = (argc > 2) ? argv[2] : nullptr;
+
+  RadioSnapshot st;
+  switch (cmd) {
+    case 'f':
+      rigState(st);
+      outf("%lu\n", (unsigned long) st.freqHz);
+      break;
+    case 'F':
+      rprt(arg1 ? rigSetFreq(arg1) : RPRT_EINVAL);
+      break;
+    case 'm':
+      rigState(st);
+      outf("%s\n%lu\n", hlModeName(st.mode), (unsigned long) passbandHz(st.mode, st.bwIdx));
+      break;
+    case 'M':
+      rprt(arg1 ? rigSetMode(arg1, arg2) : RPRT_EINVAL);
+      break;
+    case 'l':
+      if (!arg1) { rprt(RPRT_EINVAL); break; }
+      if (strcmp(arg1, "STRENGTH")) { rprt(RPRT_ENAVAIL); break; }
+      rigState(st);
+      outf("%d\n", (int) st.rssi - S9_DBUV);
+      break;
+    case 'v':
+      outf("VFOA\n");
+      break;
+    case 'V':
+      if (!arg1) rprt(RPRT_EINVAL);
+      else rprt((!strcmp(arg1, "VFOA") || !strcmp(arg1, "currVFO") || !strcmp(arg1, "Main")) ? RPRT_OK : RPRT_ENAVAIL);
+      break;
+    case 't':
+      outf("0\n");
+      break;
+    case 'T':
+      rprt((arg1 && !strcmp(arg1, "0")) ? RPRT_OK : RPRT_ENAVAIL);   // nur Empfänger
+      break;
+    case 's':
+      outf("0\nVFOA\n");
+      break;
+    case 'q':
+    case 'Q':
+      return false;
+    default:
+      rprt(RPRT_ENIMPL);
+      break;
+  }
+  return true;
+}
+
+// ===== Server =====
+// Zeilen ausführen, solange Platz für eine Antwort ist; Rückgabe = verbrauchte Bytes
+static size_t rigParse(RigClient &rc, const uint8_t *data, size_t len) {
+  cur = &rc;
+  size_t i = 0;
+  while (i < len && !rc.quit && outRoom(rc)) {
+    const char ch = (char) data[i++];
+    if (ch == '\n' || ch == '\r') {
+      if (rc.overflow) rprt(RPRT_EINVAL);
+      else if (rc.len) { rc.line[rc.len] = '\0'; rc.quit = !rigCommand(rc.line); }
+      rc.len = 0;
+      rc.overflow = false;
+    } else if (rc.len + 1 < RIGCTL_LINE_MAX) {
+      rc.line[rc.len++] = ch;
+    } else {
+      rc.overflow = true;
+    }
+  }
+  return i;
+}
+
+static void rigDone(RigClient &rc) {
+  outFlush(rc);
+  if (rc.quit && !rc.txLen) rc.c->close();
+}
+
+// Neues Paket; liegt schon Eingabe zurück, wird es der Reihe nach angehängt.
+// Was nicht ausgeführt werden kann, bleibt unquittiert, damit die Gegenstelle bremst.
+static void rigData(RigClient &rc, const uint8_t *data, size_t len) {
+  const size_t used = rc.inLen ? 0 : rigParse(rc, data, len);
+  if (used < len && !rc.quit) {
+    // Gegenstelle liest ihre Antworten nicht
+    if (rc.inLen + (len - used) > RIGCTL_IN_MAX) { rc.c->close(); return; }
+    memcpy(rc.in + rc.inLen, data + used, len - used);
+    rc.inLen += len - used;
+    rc.ackOwed += used;
+    rc.c->ackLater();
+  }
+  rigDone(rc);
+}
+
+// ACK/Poll: Antworten nachschieben, zurückgestellte Eingabe ausführen
+static void rigResume(RigClient &rc) {
+  outFlush(rc);
+  if (rc.inLen) {
+    const size_t n = rc.quit ? rc.inLen : rigParse(rc, rc.in, rc.inLen);
+    memmove(rc.in, rc.in + n, rc.inLen - n);
+    rc.inLen -= n;
+    rc.ackOwed += n;
+  }
+  if (rc.ackOwed) { rc.c->ack(rc.ackOwed); rc.ackOwed = 0; }
+  rigDone(rc);
+}
+
+static void rigClient(void *, AsyncClient *c) {
+  RigClient *rc = nullptr;
+  for (uint8_t i = 0; i < RIGCTL_MAX_CLIENTS && !rc; i++)
+    if (!clients[i].c) rc = &clients[i];
+
+  c->onDisconnect([](void *arg, AsyncClient *c) {
+    if (arg) ((RigClient *) arg)->c = nullptr;
+    delete c;
+  }, rc);
+  if (!rc) { c->close(true); return; }
+
+  memset(rc, 0, sizeof(*rc));
+  rc->c = c;
+  c->setNoDelay(true);
+  c->onData([](void *arg, AsyncClient *, void *data, size_t len) {
+    rigData(*(RigClient *) arg, (const uint8_t *) data, len);
+  }, rc);
+  c->onAck([](void *arg, AsyncClient *, size_t, uint32_t) { rigResume(*(RigClient *) arg); }, rc);
+  c->onPoll([](void *arg, AsyncClient *) { rigResume(*(RigClient *) arg); }, rc);
+}
+
+void rigctlBegin() {
+  if (server) return;
+  server = new AsyncServer(RIGCTL_PORT);
+  server->onClient(rigClient, nullptr);
+  server->setNoDelay(true);
+  server->begin();
+}
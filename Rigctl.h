@@ -0,0 +1,24 @@
+#pragma once
+#include <Arduino.h>
+
+// ===== rigctld-Server =====
+// TCP-Server für einen Ausschnitt des Hamlib-Netzprotokolls (rigctld), damit
+// Log- und Digimode-Programme den Empfänger direkt steuern können: f/F, m/M,
+// l STRENGTH, v/V, t/T, s, \dump_state, \chk_vfo, \get_powerstat sowie die
+// langen Namen (\get_freq ...). Verbindungen bleiben offen, ein Paket darf
+// beliebig viele Zeilen enthalten; die Antworten gehen gesammelt zurück.
+// Was nicht mehr in den TCP-Sendepuffer passt, wartet je Client und wird bei
+// ACK/Poll nachgeschoben; ist auch dieser Puffer voll, ruht die Eingabe.
+// Läuft wie die Web-Handler im AsyncTCP-Task: Befehle über radioPost bzw.
+// radioPostBatch, Werte aus dem Snapshot, nie I2C.
+
+#define RIGCTL_PORT        4532
+#define RIGCTL_MAX_CLIENTS 4
+#define RIGCTL_LINE_MAX    64     // längere Zeilen werden verworfen (RPRT -1)
+#define RIGCTL_TX_MAX      1024   // ungesendete Antworten je Client
+#define RIGCTL_REPLY_MAX   512    // längste Antwort (\dump_state); weniger frei: Eingabe ruht
+#define RIGCTL_IN_MAX      256    // zurückgestellte Eingabe je Client, mehr: Verbindung schließen
+#define RIGCTL_PENDING_MS  500    // so lange gelten gesetzte Werte vor dem nächsten Snapshot
+
+// Startet den Server; nach WiFi (WebUI::begin)
+void rigctlBegin();
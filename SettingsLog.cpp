@@ -0,0 +1,190 @@
+#include "SettingsLog.h"
+#include <esp_partition.h>
+
+#define SECTOR_SIZE     4096
+#define SECTOR_MAGIC    0x53455431UL   // "SET1"
+#define RECORDS_OFFSET  16             // Sektorkopf, danach Datensätze
+
+// Sektorkopf; wird erst nach dem kompletten Stand geschrieben, ein halb
+// geschriebener Sektor ist dadurch nie gültig.
+typedef struct {
+  uint32_t magic;
+  uint32_t gen;
+  uint8_t  layout;
+  uint8_t  reserved[5];
+  uint16_t crc;
+} SectorHeader;
+
+// Ein Wert; key == 0xFF markiert freien Flash
+typedef struct {
+  uint8_t  key;
+  uint8_t  idx;
+  uint16_t crc;
+  uint32_t seq;
+  uint32_t value;
+} LogRecord;
+
+typedef struct {
+  uint8_t  key;
+  uint8_t  idx;
+  uint32_t value;
+} MirrorEntry;
+
+SettingsStats settingsStats;
+
+static const esp_partition_t *part = NULL;
+static uint8_t  layout = 0;
+static uint8_t  active = 0;
+static uint32_t gen = 0;
+static uint32_t seq = 0;
+static uint32_t writePos = RECORDS_OFFSET;
+static bool     valid = false;
+
+// Zuletzt gespeicherter Stand (für Delta-Erkennung und Kompaktierung)
+static MirrorEntry mirror[SETTINGS_MAX_ENTRIES];
+static uint16_t mirrorCount = 0;
+
+static uint16_t crc16(const uint8_t *p, size_t n, uint16_t crc = 0xFFFF) {
+  while (n--) {
+    crc ^= (uint16_t)(*p++) << 8;
+    for (uint8_t b = 0; b < 8; b++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+  }
+  return crc;
+}
+
+static uint16_t headerCrc(const SectorHeader &h) {
+  return crc16((const uint8_t *) &h, offsetof(SectorHeader, crc));
+}
+
+static uint16_t recordCrc(const LogRecord &r) {
+  uint16_t c = crc16(&r.key, 2);
+  return crc16((const uint8_t *) &r.seq, 8, c);
+}
+
+static uint32_t sectorAddr(uint8_t s) { return (uint32_t) s * SECTOR_SIZE; }
+
+static bool readHeader(uint8_t s, SectorHeader &h) {
+  if (esp_partition_read(part, sectorAddr(s), &h, sizeof(h)) != ESP_OK) return false;
+  return h.magic == SECTOR_MAGIC && h.layout == layout && h.crc == headerCrc(h);
+}
+
+static MirrorEntry *mirrorFind(uint8_t key, uint8_t idx) {
+  for (uint16_t i = 0; i < mirrorCount; i++)
+    if (mirror[i].key == key && mirror[i].idx == idx) return &mirror[i];
+  return NULL;
+}
+
+static bool mirrorSet(uint8_t key, uint8_t idx, uint32_t value) {
+  MirrorEntry *e = mirrorFind(key, idx);
+  if (!e) {
+    if (mirrorCount >= SETTINGS_MAX_ENTRIES) return false;
+    e = &mirror[mirrorCount++];
+    e->key = key;
+    e->idx = idx;
+  }
+  e->value = value;
+  return true;
+}
+
+static bool writeRecord(uint8_t s, uint32_t pos, uint8_t key, uint8_t idx, uint32_t value) {
+  LogRecord r;
+  r.key = key;
+  r.idx = idx;
+  r.seq = ++seq;
+  r.value = value;
+  r.crc = recordCrc(r);
+  return esp_partition_write(part, sectorAddr(s) + pos, &r, sizeof(r)) == ESP_OK;
+}
+
+// Aktuellen Stand in den nächsten Sektor schreiben und diesen aktivieren
+static bool compact() {
+  const uint8_t next = (active + 1) % settingsStats.sectors;
+  if (esp_partition_erase_range(part, sectorAddr(next), SECTOR_SIZE) != ESP_OK) return false;
+
+  uint32_t pos = RECORDS_OFFSET;
+  for (uint16_t i = 0; i < mirrorCount; i++) {
+    if (!writeRecord(next, pos, mirror[i].key, mirror[i].idx, mirror[i].value)) return false;
+    pos += sizeof(LogRecord);
+  }
+
+  SectorHeader h;
+  memset(&h, 0, sizeof(h));
+  h.magic = SECTOR_MAGIC;
+  h.gen = gen + 1;
+  h.layout = layout;
+  h.crc = headerCrc(h);
+  if (esp_partition_write(part, sectorAddr(next), &h, sizeof(h)) != ESP_OK) return false;
+
+  active = next;
+  gen = h.gen;
+  writePos = pos;
+  valid = true;
+  settingsStats.compactions++;
+  settingsStats.generation = gen;
+  settingsStats.sector = active;
+  settingsStats.used = writePos;
+  return true;
+}
+
+bool settingsBegin(uint8_t layoutId) {
+  layout = layoutId;
+  part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, SETTINGS_PARTITION);
+  if (!part || part->size < 2 * SECTOR_SIZE) { part = NULL; return false; }
+  settingsStats.sectors = part->size / SECTOR_SIZE;
+
+  valid = false;
+  for (uint8_t s = 0; s < settingsStats.sectors; s++) {
+    SectorHeader h;
+    if (!readHeader(s, h)) continue;
+    if (!valid || (int32_t)(h.gen - gen) > 0) { active = s; gen = h.gen; valid = true; }
+  }
+  settingsStats.generation = gen;
+  settingsStats.sector = active;
+  return true;
+}
+
+bool settingsReplay(void (*apply)(uint8_t key, uint8_t idx, uint32_t value)) {
+  mirrorCount = 0;
+  writePos = RECORDS_OFFSET;
+  if (!part || !valid) return false;
+
+  LogRecord r;
+  for (uint32_t pos = RECORDS_OFFSET; pos + sizeof(r) <= SECTOR_SIZE; pos += sizeof(r)) {
+    if (esp_partition_read(part, sectorAddr(active) + pos, &r, sizeof(r)) != ESP_OK) break;
+    if (r.key == 0xFF && r.idx == 0xFF && r.seq == 0xFFFFFFFFUL) break;   // freier Bereich
+    writePos = pos + sizeof(r);
+    // Beim Schreiben unterbrochener Datensatz: überspringen, Rest bleibt gültig
+    if (r.crc != recordCrc(r)) continue;
+    if ((int32_t)(r.seq - seq) > 0) seq = r.seq;
+    mirrorSet(r.key, r.idx, r.value);
+  }
+  settingsStats.used = writePos;
+
+  for (uint16_t i = 0; i < mirrorCount; i++) apply(mirror[i].key, mirror[i].idx, mirror[i].value);
+  return mirrorCount > 0;
+}
+
+bool settingsPut(uint8_t key, uint8_t idx, uint32_t value) {
+  if (!part) return false;
+  MirrorEntry *e = mirrorFind(key, idx);
+  if (e && e->value == value) return true;
+  if (!mirrorSet(key, idx, value)) return false;
+
+  // Noch kein gültiger Sektor oder Sektor voll: kompletten Stand neu anlegen
+  if (!valid || writePos + sizeof(LogRecord) > SECTOR_SIZE) return compact();
+
+  if (!writeRecord(active, writePos, key, idx, value)) return false;
+  writePos += sizeof(LogRecord);
+  settingsStats.records++;
+  settingsStats.used = writePos;
+  return true;
+}
+
+void settingsErase() {
+  if (!part) return;
+  esp_partition_erase_range(part, 0, (size_t) settingsStats.sectors * SECTOR_SIZE);
+  valid = false;
+  gen = 0;
+  mirrorCount = 0;
+  writePos = RECORDS_OFFSET;
+}
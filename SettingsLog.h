@@ -0,0 +1,48 @@
+#pragma once
+#include <Arduino.h>
+
+// ===== Einstellungen als Log =====
+// Statt bei jeder Änderung das ganze EEPROM (= einen Flash-Sektor) neu zu
+// schreiben, werden nur geänderte Werte als kleine Datensätze an das Log im
+// aktiven Sektor der Partition "settings" angehängt. Ist der Sektor voll, wird
+// der aktuelle Stand kompakt in den nächsten Sektor geschrieben (Rotation über
+// alle Sektoren). Beim Start wird der neueste gültige Sektor abgespielt.
+
+#define SETTINGS_PARTITION   "settings"
+#define SETTINGS_MAX_ENTRIES 256   // verschiedene (Schlüssel, Index)-Paare
+
+enum SettingKey : uint8_t {
+  SK_VOLUME = 1,
+  SK_BAND_IDX,
+  SK_RDS,
+  SK_MODE,
+  SK_BFO,
+  SK_SOFTMUTE,
+  SK_AGC,
+  SK_REGION,
+  SK_ANTCAP,
+  SK_BAND = 0x20,    // idx = Band, value = freq << 16 | stepIdx << 8 | bwIdx
+  SK_ANTCAP_TAB,     // idx = Band * ANTCAP_BUCKETS + Fach, value siehe antcapPack()
+};
+
+typedef struct {
+  uint32_t records;      // angehängte Datensätze seit dem Start
+  uint32_t compactions;  // Sektorwechsel seit dem Start
+  uint32_t generation;   // Generation des aktiven Sektors
+  uint16_t used;         // belegte Bytes im aktiven Sektor
+  uint8_t  sector;       // aktiver Sektor
+  uint8_t  sectors;      // Sektoren der Partition
+} SettingsStats;
+
+extern SettingsStats settingsStats;
+
+// Partition suchen und den neuesten gültigen Sektor bestimmen.
+// layoutId wird im Sektorkopf geprüft; ein anderes Layout gilt als leer.
+bool settingsBegin(uint8_t layoutId);
+// Spielt alle gültigen Datensätze des aktiven Sektors in Schreibreihenfolge ab.
+// Liefert false, wenn keine Einstellungen gespeichert sind.
+bool settingsReplay(void (*apply)(uint8_t key, uint8_t idx, uint32_t value));
+// Hängt einen Datensatz an, sofern sich der Wert geändert hat
+bool settingsPut(uint8_t key, uint8_t idx, uint32_t value);
+// Löscht alle gespeicherten Einstellungen
+void settingsErase();
@@ -0,0 +1,304 @@
+// Automatisch erzeugt von tools/embed_web.py - nicht von Hand bearbeiten.
+#pragma once
+#include <Arduino.h>
+
+// web/index.html: 10271 Bytes, gzip 3663 Bytes
+static const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x5a,0xcd,0x72,0xdb,0xc8,
+  0x11,0xbe,0xeb,0x29,0xc6,0x74,0xca,0x04,0x62,0x02,0x14,0x25,0x59,0x71,0xf8,0xa7,
+  0x92,0xbd,0xf2,0xda,0x89,0x65,0xab,0x44,0x6f,0xf9,0xa0,0x38,0xae,0x01,0x30,0x24,
+  0x21,0x02,0x03,0x68,0x30,0x20,0x25,0xd1,0xac,0xca,0x5b,0xe4,0x05,0xb6,0x72,0xdf,
+  0x4b,0x4e,0x7b,0x5a,0xdf,0xf3,0x10,0x79,0x92,0x74,0xcf,0x00,0x20,0x40,0x41,0xb4,
+  0x5c,0x1b,0xb9,0x2c,0x82,0xf3,0xd3,0xdd,0xf3,0x4d,0xff,0x7c,0x33,0x50,0xff,0x91,
+  0x17,0xb9,0xf2,0x26,0x66,0x64,0x2a,0xc3,0x60,0xb8,0xd3,0xc7,0x0f,0x12,0x50,0x3e,
+  0x19,0x34,0x3c,0xd6,0x18,0xf6,0xa7,0x8c,0x7a,0xc3,0x7e,0xc8,0x24,0x25,0xee,0x94,
+  0x8a,0x84,0xc9,0x41,0x23,0x95,0x63,0xeb,0x79,0x23,0x6b,0xe5,0x34,0x64,0x83,0xc6,
+  0xdc,0x67,0x8b,0x38,0x12,0xb2,0x41,0xdc,0x88,0x4b,0xc6,0x61,0xd4,0xc2,0xf7,0xe4,
+  0x74,0xe0,0xb1,0xb9,0xef,0x32,0x4b,0x7d,0x69,0xf9,0xdc,0x97,0x3e,0x0d,0xac,0xc4,
+  0xa5,0x01,0x1b,0x74,0x1a,0xa0,0x4f,0xfa,0x32,0x60,0xc3,0x93,0xd1,0xd9,0xfe,0x1e,
+  0x19,0xbd,0x39,0xf8,0x13,0x7c,0x7c,0x64,0x0e,0xf9,0xe9,0x4d,0xbf,0xad,0xbb,0x76,
+  0xfa,0x89,0xbc,0xc1,0x4f,0x42,0xba,0x22,0x8a,0x24,0x59,0x12,0xcb,0x9a,0xd0,0xb8,
+  0x4b,0x9e,0xc7,0xd7,0x3d,0x78,0x76,0x24,0xb7,0x9c,0x49,0xf7,0xf1,0xf8,0x10,0xfe,
+  0x3d,0xcf,0x5b,0xa8,0x2b,0xbb,0x8f,0x77,0x0f,0xdd,0xd2,0x77,0x0b,0x5a,0xc6,0xe3,
+  0x71,0x8f,0xac,0x40,0x96,0x13,0x79,0x37,0xcb,0x31,0xd8,0x6a,0x8d,0x69,0xe8,0x07,
+  0x37,0xdd,0xe4,0x26,0x91,0x2c,0xb4,0x52,0xbf,0x75,0x2c,0xc0,0xc6,0x56,0x42,0x79,
+  0x62,0x25,0x4c,0xf8,0xe3,0x5e,0x48,0xc5,0xc4,0xe7,0xdd,0xce,0x61,0x7c,0x8d,0x53,
+  0x6d,0x11,0x2d,0x96,0x9e,0x9f,0xc4,0x01,0xbd,0xe9,0x8e,0x03,0x76,0xdd,0x43,0x73,
+  0xe6,0x54,0x18,0xca,0x30,0xb3,0x87,0x6d,0xd6,0x42,0x40,0x23,0xfe,0xca,0xa7,0x83,
+  0xb9,0x64,0x57,0xcd,0x9f,0x08,0xdf,0xab,0x0a,0xd8,0x98,0x51,0x95,0x97,0xcd,0x89,
+  0xd2,0x78,0x99,0x5b,0xb2,0x5b,0x92,0x05,0xed,0x64,0xba,0xbf,0x2c,0x6b,0x21,0x87,
+  0xf8,0xbb,0xa7,0x96,0x97,0xf8,0xb7,0xac,0x30,0xdd,0x49,0xa5,0x8c,0xf8,0xb2,0xd4,
+  0xf1,0x0c,0x40,0x8c,0xa9,0xe7,0xf9,0x7c,0xa2,0xe6,0x76,0xf6,0xa0,0xc1,0x89,0x84,
+  0xc7,0x44,0xb7,0x03,0xdf,0x93,0x28,0xf0,0x3d,0xf2,0xd8,0xf3,0xbc,0x9e,0x43,0xdd,
+  0x19,0xaa,0xe3,0x5e,0x66,0x9c,0x46,0xde,0xcc,0x86,0x5b,0x82,0x7a,0x7e,0x9a,0x74,
+  0x41,0x55,0xcf,0x4d,0x45,0x12,0x89,0x6e,0x1c,0xf9,0xe0,0x0c,0x62,0xad,0xd9,0x86,
+  0x6d,0xf0,0xe7,0x6c,0x59,0x2b,0x0a,0xfa,0xcc,0x9e,0x1b,0x05,0x30,0xb1,0xd2,0x68,
+  0xc9,0x42,0x45,0x4d,0xaf,0x86,0x27,0x91,0x54,0x96,0x97,0x85,0xbe,0x91,0x21,0x72,
+  0x90,0x63,0x95,0x84,0x34,0x08,0x96,0x5a,0xc4,0xe3,0xc3,0xc3,0x43,0x6c,0xa3,0xf9,
+  0x77,0x74,0x15,0xc9,0xae,0xa5,0xe5,0x31,0x37,0x12,0x54,0xfa,0x11,0xef,0xf2,0x88,
+  0xb3,0xd5,0x4e,0xbf,0x9d,0x39,0x60,0xbf,0xad,0x82,0x61,0xa7,0x8f,0xbe,0x83,0xfe,
+  0xd8,0x9f,0x76,0x2a,0x9e,0x0b,0x03,0x3a,0xaa,0xdd,0xf3,0xe7,0xc4,0x0d,0x68,0x92,
+  0x0c,0x1a,0x68,0x58,0x63,0xf8,0x4a,0xb0,0xab,0x94,0xf1,0xdb,0x2e,0xe9,0x27,0x31,
+  0xe5,0xc4,0xf7,0x06,0x8d,0x31,0xb4,0x35,0x86,0x16,0x88,0x87,0x96,0x61,0xa9,0x23,
+  0x4e,0x20,0xb6,0x8a,0x56,0x34,0x5a,0x35,0x87,0x2c,0x54,0xed,0xd8,0x00,0x9f,0xa0,
+  0xa3,0x5e,0xd7,0x69,0xe4,0xb1,0xb2,0x9e,0x30,0xc2,0x40,0x2e,0xf4,0x7c,0x21,0x2f,
+  0x28,0xc0,0x5e,0x1a,0xe0,0xc0,0x77,0x5c,0xfa,0x7a,0xd0,0x16,0xe9,0xe7,0xa3,0xd1,
+  0x9b,0xf2,0x64,0x91,0x24,0x7e,0x49,0xba,0xf7,0xe2,0x3f,0xbf,0xb6,0xc8,0xe8,0xdd,
+  0x79,0x79,0x4c,0xc2,0x45,0x65,0x48,0x26,0x7e,0x43,0xbe,0xf2,0x64,0xcc,0x38,0xfb,
+  0xc3,0xd7,0x34,0x8d,0xa5,0xf3,0xf5,0x67,0x0e,0x7b,0x0e,0xa0,0xee,0x0f,0xab,0xe3,
+  0x7c,0xaf,0xa1,0xe4,0x4e,0x44,0x6c,0x85,0xd4,0xe7,0x8d,0xcc,0xe0,0x5a,0xb3,0x4b,
+  0x62,0xcf,0xc1,0xdf,0xc6,0x29,0x9f,0x3d,0x4c,0xb2,0xe3,0x3e,0x54,0xee,0x71,0x48,
+  0x25,0x4b,0xc5,0xc3,0x45,0x4f,0x69,0xb8,0x21,0x7b,0x43,0x38,0x64,0x98,0x06,0x51,
+  0x6e,0x07,0xfb,0xa7,0xdc,0xd8,0x92,0x51,0x8c,0xa1,0xd5,0x40,0x3b,0x60,0xb0,0x8e,
+  0x27,0xbd,0x7f,0x1d,0x85,0xae,0x6e,0xa9,0xe9,0xde,0xdb,0xde,0xbd,0xbf,0xbd,0xfb,
+  0x60,0xa3,0x7b,0x0d,0xc6,0xda,0x35,0xa7,0x10,0xe6,0x8d,0xe1,0x6b,0x9f,0x2f,0x98,
+  0x9f,0x74,0xc9,0xc8,0x9d,0x0a,0x5f,0x4a,0x46,0x16,0x0c,0xa2,0x96,0x13,0x9a,0x26,
+  0x04,0x40,0x21,0x74,0x26,0x53,0x06,0x53,0x18,0x24,0x1b,0x06,0xd9,0x36,0x08,0xa0,
+  0x52,0xe4,0xa3,0x61,0x2a,0xcc,0xa0,0xce,0x84,0x05,0xf8,0x24,0xed,0xdc,0xd5,0x1f,
+  0x88,0x0d,0xe6,0xc4,0x1c,0x1c,0x9f,0xc7,0xa9,0x54,0x96,0x81,0x73,0x10,0x2c,0x6f,
+  0x83,0x06,0x4f,0x43,0x87,0x89,0x06,0x09,0x7d,0x3e,0x68,0x74,0x50,0x02,0x8b,0xb3,
+  0x07,0x25,0x4a,0x55,0xa8,0xee,0xde,0x1e,0x8a,0x21,0x90,0x99,0x5d,0x36,0x8d,0x02,
+  0xb0,0x7a,0xd0,0x98,0xbd,0xbe,0x25,0xc6,0xf1,0x69,0x7b,0xf4,0xb1,0xfd,0xf6,0xa3,
+  0x49,0x9c,0xdb,0x85,0x4d,0x3a,0xbb,0x16,0x34,0x5b,0x27,0x3e,0x9f,0xa2,0xb5,0x9c,
+  0x18,0xaf,0x4e,0xcd,0x9a,0xbd,0x81,0x7a,0x09,0x79,0xaa,0x31,0x1c,0x31,0x79,0x3f,
+  0xc6,0x18,0xa1,0x6a,0x14,0x86,0x2e,0x80,0xe6,0x4e,0x13,0x16,0xf0,0xfb,0xc7,0x27,
+  0x8c,0xcd,0x3c,0x18,0xfe,0x24,0xa0,0x57,0x69,0xd4,0x23,0x23,0xf8,0xbe,0x7d,0x34,
+  0x7a,0x2a,0x8e,0x22,0x4f,0x84,0x9a,0x52,0xb3,0xa1,0xf7,0xbb,0xf7,0x28,0x66,0xbe,
+  0x3b,0x65,0x62,0x46,0xf9,0xd7,0x9f,0x03,0xa6,0x7c,0x5b,0x6b,0xd9,0xd8,0x15,0xdd,
+  0x5a,0xc1,0x1f,0x92,0x16,0x12,0x04,0x80,0x9d,0x5e,0x07,0x8c,0x4f,0x80,0x11,0x34,
+  0x3a,0x7f,0xde,0x00,0xbd,0x73,0x78,0x17,0xf4,0x77,0x30,0x8b,0x18,0x01,0x03,0xb7,
+  0x19,0x90,0xf3,0x1f,0x46,0xd6,0xd9,0xc8,0x5c,0x2b,0x28,0x83,0xc7,0xc2,0x84,0xce,
+  0x21,0xc3,0xe5,0x66,0x6e,0x00,0xb7,0x69,0xce,0xd5,0x03,0x94,0x8f,0x52,0x10,0x04,
+  0xcc,0xc6,0x9d,0x12,0xb4,0xe3,0x3e,0xbd,0xb1,0x60,0xf3,0x62,0x17,0xee,0x68,0xad,
+  0x8e,0xe5,0x2a,0xc1,0xd6,0xc0,0x5f,0x8a,0xa8,0xcd,0x1d,0xc8,0x53,0x06,0x4c,0x0f,
+  0xfc,0x44,0x36,0x4a,0x89,0x68,0xbd,0x67,0x71,0x4d,0x2c,0x3c,0xc7,0x50,0xe8,0x53,
+  0x32,0x15,0x6c,0x3c,0x68,0xb4,0x17,0xfe,0x18,0x72,0xf4,0xc7,0xb7,0xc7,0xef,0xc8,
+  0x2c,0xe2,0x63,0x7f,0x92,0x0a,0x9f,0x09,0x06,0x40,0x51,0x10,0x19,0x67,0x72,0x86,
+  0xc7,0x67,0x98,0xd9,0x5d,0xf0,0xc1,0x61,0x9b,0xc6,0x7e,0x1b,0x13,0x7e,0x9a,0xf4,
+  0xdb,0xaa,0xa5,0x55,0xee,0x61,0x73,0x60,0x78,0xb5,0x3d,0x58,0x4b,0xee,0xed,0x68,
+  0x43,0x34,0x1c,0xf9,0xde,0xf5,0xc0,0xb6,0xed,0xba,0x31,0x32,0xe5,0xec,0xc8,0x63,
+  0x81,0xa4,0xf7,0x8d,0x00,0x01,0x58,0x36,0x8f,0xe6,0x34,0xb8,0x6f,0x08,0x06,0xd3,
+  0x11,0xa2,0x3d,0xe8,0xd4,0x4b,0x60,0xb3,0x23,0xcf,0x17,0xf5,0xbd,0x68,0xe5,0xfd,
+  0xbd,0xb0,0x0f,0x11,0x20,0x97,0x1c,0x45,0xe3,0x31,0x12,0xe1,0xdd,0x27,0x34,0x8c,
+  0x7b,0x81,0x1f,0xfa,0x72,0xf0,0x4c,0x7f,0xb9,0x2a,0x99,0xa5,0xa1,0xed,0x27,0xae,
+  0xf0,0x63,0x39,0xdc,0x09,0x98,0x24,0x28,0xff,0x2d,0x6c,0x25,0xf8,0xf4,0xc5,0xa7,
+  0x9e,0x6a,0x02,0xaa,0x04,0x5b,0x21,0xb1,0x28,0xbf,0xf1,0xae,0xa1,0xc3,0xea,0xf4,
+  0x76,0x76,0xa0,0x96,0xb8,0xc8,0x41,0x20,0x6e,0x66,0xec,0x85,0xe4,0x06,0x24,0x99,
+  0xd0,0x5c,0xc2,0x46,0x01,0xbf,0x86,0xf9,0x0e,0x0c,0x04,0xe6,0x9e,0x86,0x30,0xd5,
+  0x76,0x05,0x83,0x02,0x74,0x12,0x30,0xfc,0x66,0x34,0xb5,0x6f,0x35,0xcd,0x1e,0xd2,
+  0x2e,0x1b,0x2b,0xfb,0x4b,0xcd,0xc9,0x61,0x0e,0x8a,0xb1,0x31,0x22,0x6d,0x29,0xfc,
+  0xd0,0xc8,0xc6,0x78,0x54,0x52,0x58,0x90,0xed,0x2b,0x03,0xd4,0x18,0x78,0xd4,0x7d,
+  0xc0,0x0d,0x4f,0x70,0xbb,0xd1,0x6c,0xc6,0x99,0x30,0x9a,0x6e,0xe0,0xbb,0xb3,0x66,
+  0x8b,0xd0,0xe4,0x86,0xbb,0xc4,0x30,0x07,0xc3,0xa5,0x72,0x5e,0xba,0xa0,0xbe,0x24,
+  0x63,0x26,0xdd,0xa9,0xd1,0xbc,0xbb,0xe9,0xcd,0xa7,0x8c,0x23,0x2e,0x3f,0x9d,0xbf,
+  0x79,0x19,0x85,0x31,0x70,0x2b,0x30,0x36,0xd7,0x65,0x2a,0x4b,0x08,0x01,0x87,0x15,
+  0x2c,0x99,0x6a,0xc3,0x56,0xea,0xb7,0x60,0x32,0x15,0x9c,0x38,0xbd,0x9d,0x55,0x09,
+  0x17,0xc0,0x0c,0x42,0xf5,0x47,0xcc,0x52,0x89,0x51,0x02,0x06,0xf9,0x40,0x19,0x9b,
+  0x09,0x93,0x19,0x30,0x2f,0x6e,0xde,0x78,0x46,0x33,0xe7,0x0c,0x1a,0x9e,0x0c,0x4c,
+  0x17,0x34,0x7f,0x63,0x8e,0xe3,0x96,0x67,0x40,0x01,0xff,0xe6,0x0c,0x18,0xa3,0xa7,
+  0xa0,0x3a,0xdb,0xe7,0x80,0xdd,0xeb,0x0f,0xa7,0x6f,0x07,0xcd,0x66,0x0f,0x34,0x6e,
+  0x34,0xc0,0xe0,0x6a,0x0b,0xc6,0x64,0xbb,0x4d,0x7e,0x14,0x69,0x1c,0x43,0x79,0x01,
+  0xe6,0x42,0xce,0x99,0x3f,0x65,0x7c,0x1c,0x05,0x13,0x06,0x71,0x1c,0x86,0x45,0x65,
+  0xe5,0x8a,0xd2,0x59,0xa7,0x70,0x1c,0x83,0x9d,0x84,0xaf,0x73,0x00,0x68,0x1d,0x8e,
+  0x85,0xd5,0x58,0x08,0xcf,0x29,0x9f,0x81,0xe5,0xcb,0x71,0xd8,0xdd,0x6d,0x91,0x70,
+  0xd1,0xed,0xb4,0x48,0xb0,0xe8,0xee,0xb5,0x48,0xb2,0xe8,0xee,0xaf,0xd4,0x9e,0x67,
+  0x4e,0x6a,0x8f,0x7d,0x28,0xd0,0x02,0xf6,0x88,0x0c,0x86,0xe0,0x15,0xd9,0x59,0x63,
+  0x30,0x18,0x90,0xa6,0x86,0x30,0x4b,0x75,0xf8,0x63,0x03,0xdf,0x97,0x86,0x41,0x5b,
+  0xc4,0x31,0x71,0xb8,0x91,0x2b,0xbb,0xa0,0x36,0x3e,0x7e,0x22,0x56,0xa1,0xff,0xc2,
+  0xd1,0x4d,0x26,0xf9,0xf2,0x85,0x18,0x54,0xb9,0x9d,0x05,0xae,0xa6,0xfc,0xa0,0x2c,
+  0x73,0x1c,0x89,0x13,0x48,0xc2,0x99,0x05,0x0a,0x47,0x8a,0x70,0x78,0x2f,0xa7,0x7e,
+  0xe0,0x19,0xeb,0xd8,0x30,0xd1,0x7f,0x34,0x62,0x39,0xc9,0x53,0x90,0x95,0x98,0x19,
+  0x60,0x35,0x06,0x0f,0xf6,0x27,0x30,0x5d,0xa7,0xf6,0x8f,0x40,0x40,0x18,0x0f,0x80,
+  0xb1,0x01,0xa0,0x06,0x75,0xf2,0x5e,0x46,0x72,0xba,0x6e,0xb6,0xc8,0xcb,0x17,0xe4,
+  0x36,0x85,0x38,0xbd,0x95,0x6b,0x77,0xb9,0xf9,0x08,0x05,0x47,0x57,0x33,0x80,0xb2,
+  0xb4,0x66,0x58,0x8b,0xa0,0x20,0x46,0x68,0x90,0x30,0x83,0x37,0x4d,0x58,0x9a,0xe1,
+  0xd4,0xb4,0xeb,0xd5,0x3b,0x36,0x54,0x46,0x18,0x42,0xf1,0xd3,0x7c,0x28,0xfc,0xe8,
+  0x8d,0x1a,0xf1,0xb2,0x31,0xe6,0x06,0x60,0xe0,0x65,0x5b,0xe0,0x7a,0x98,0x26,0xe5,
+  0xc5,0xdf,0x56,0x85,0xfe,0xbb,0x7d,0x6b,0xa6,0xfe,0x64,0x1a,0xc0,0x7f,0x79,0xac,
+  0x8e,0x80,0x18,0xe1,0xe5,0x78,0xbe,0xd3,0x8d,0x21,0x5d,0xc4,0x17,0xec,0x86,0xb8,
+  0x19,0x81,0x6e,0x57,0x46,0xe2,0x38,0x08,0xf2,0x24,0x77,0x81,0x99,0xcb,0x02,0xbf,
+  0xf9,0xd4,0x5c,0x5b,0x04,0x54,0x2a,0x4f,0x49,0xf0,0x68,0xab,0x72,0xaa,0x96,0x29,
+  0xa3,0xc9,0x24,0x60,0x46,0x53,0x1f,0x42,0x21,0x83,0xbd,0x53,0x9c,0x10,0x27,0x94,
+  0x53,0xa0,0x09,0x0b,0xcf,0x7a,0xaa,0xc9,0xd9,0x2c,0xb2,0xd2,0xdd,0x4c,0xf4,0x42,
+  0xd9,0x93,0x18,0x58,0x7e,0x5a,0x8a,0x5c,0x7e,0x9e,0x4d,0x6f,0x4b,0x89,0xc9,0x63,
+  0xe3,0x04,0xd3,0xfe,0x32,0x4c,0x03,0xd9,0xb5,0x9e,0xad,0x5a,0xd9,0x53,0x27,0x7f,
+  0x7a,0xba,0x7e,0x7a,0xb6,0xfa,0x54,0x4a,0x4f,0x92,0xab,0x99,0x4e,0xa7,0xe5,0xec,
+  0xb5,0x9c,0xfd,0x96,0x73,0xa0,0x7a,0x51,0x62,0xb1,0x68,0x23,0x6a,0xf9,0xca,0x09,
+  0xf5,0xc2,0xf5,0x4c,0xb0,0x00,0x26,0x46,0x36,0x0a,0x25,0x7f,0x2c,0xac,0xea,0x95,
+  0x86,0x04,0xd4,0x61,0x01,0x7a,0xf1,0x29,0x95,0x53,0x1b,0x82,0xc0,0x40,0xb3,0xc9,
+  0x70,0x00,0x14,0x77,0x77,0x37,0x8f,0xc6,0x23,0xf0,0x6d,0x68,0x6f,0xab,0x36,0xc0,
+  0xf1,0x95,0x7f,0xcd,0x3c,0x63,0xdf,0xb4,0x05,0x53,0xc4,0xc9,0x68,0xff,0xcd,0x3e,
+  0xda,0x7d,0xfa,0x87,0x76,0xab,0x09,0x0e,0xff,0x94,0x34,0xc9,0xe9,0xeb,0xdb,0x22,
+  0x3f,0x74,0x09,0x4e,0x56,0xcd,0x33,0x6c,0xee,0xe5,0x7b,0x93,0x5c,0xf8,0x9f,0x36,
+  0x0a,0x14,0x8e,0xec,0xef,0x1e,0x35,0xad,0x66,0xb7,0xf9,0x54,0xc9,0x52,0x16,0xae,
+  0x15,0xfd,0xfd,0xc2,0x7a,0xfa,0x49,0xe9,0x29,0x2f,0x43,0xb1,0x86,0xcf,0xea,0xb6,
+  0x81,0x53,0xb5,0x1e,0xdc,0x08,0xed,0xc2,0xaf,0x4e,0x41,0xce,0x11,0x51,0x0b,0x54,
+  0x77,0x0e,0xd9,0x52,0x4c,0x30,0xac,0x40,0x23,0xb7,0x26,0xf7,0x03,0x25,0x10,0x53,
+  0x7c,0x45,0xf0,0xba,0x2a,0xdd,0x9b,0xfa,0xf1,0x2c,0x04,0xce,0x58,0x59,0x95,0xd2,
+  0xb0,0x61,0xd1,0x4e,0x86,0x2b,0x7c,0x21,0x23,0xd8,0x98,0x2e,0xa0,0xf3,0xb4,0xd8,
+  0xa2,0x1c,0x2c,0x62,0x64,0x8e,0xd5,0x25,0xbf,0xfd,0xd2,0xf9,0xfa,0x4f,0x7d,0xfa,
+  0xf8,0xed,0x97,0x67,0xf0,0x88,0xb3,0xcc,0x4c,0x10,0x40,0xdc,0xcc,0x8f,0x28,0xbf,
+  0x4f,0x9c,0x72,0x6e,0x5d,0xda,0x0b,0x17,0x0f,0x22,0xea,0x61,0x0c,0x64,0x95,0x56,
+  0x8a,0x1b,0xed,0x65,0x90,0x6e,0xb1,0x19,0xc9,0x29,0x23,0x48,0x6b,0x66,0xb8,0x19,
+  0x94,0xcb,0x1e,0x14,0x2b,0xe0,0x68,0xbe,0x07,0x3c,0x33,0xe5,0x13,0x12,0x43,0xea,
+  0x3b,0xf9,0x40,0x27,0xc4,0xd8,0xdf,0x3d,0x30,0x4b,0xfb,0x86,0xec,0xbe,0x9e,0x37,
+  0x24,0x10,0x9f,0x4b,0x17,0x5c,0x9b,0x75,0x9b,0x3c,0xb2,0xd4,0x53,0x73,0x55,0xd9,
+  0xf4,0xcb,0x62,0xb2,0xb0,0x2f,0x93,0x88,0x1b,0xb9,0x67,0xad,0x59,0x96,0x71,0x69,
+  0x23,0xc5,0x48,0xbe,0x7c,0xb9,0xf8,0x64,0x42,0x8a,0x8d,0x8d,0xeb,0xc1,0xd0,0x58,
+  0x42,0x94,0x77,0xaf,0x31,0xd6,0x5b,0xea,0xfe,0xb2,0x3b,0x02,0x36,0xc4,0x27,0xc6,
+  0xb5,0xa2,0x46,0x5f,0xbe,0x80,0x73,0xad,0xd6,0x8c,0xa4,0x4c,0x34,0x94,0x03,0xb8,
+  0x14,0x4d,0x65,0xe6,0x72,0x85,0x58,0x01,0x08,0x23,0xc5,0x94,0x2d,0xf8,0xe0,0x5e,
+  0x8f,0x28,0xba,0x94,0x90,0xc0,0x67,0x63,0x70,0x1a,0xc2,0x53,0x41,0x26,0x4c,0xdf,
+  0x0b,0x00,0x4c,0xaf,0x18,0x9e,0x31,0x54,0x75,0xca,0x8e,0xc7,0x53,0x00,0x09,0x8a,
+  0x4c,0x42,0xb1,0xa4,0x4f,0xd8,0xf8,0xeb,0xaf,0x53,0x21,0x77,0xf4,0x12,0xd5,0x22,
+  0x96,0xab,0x32,0x23,0x84,0x34,0x1b,0xdc,0x68,0x8d,0xc6,0xa5,0xda,0x8f,0xf7,0xce,
+  0x25,0x24,0x46,0x1b,0xd2,0x9c,0x3f,0xe1,0x46,0x22,0x5b,0xe4,0x72,0xbb,0x8f,0x22,
+  0x87,0xde,0xf4,0x51,0x82,0x75,0x00,0xda,0x3f,0x27,0x52,0x6c,0x9d,0x8c,0x6e,0x5c,
+  0x37,0x19,0xdb,0xb7,0x4e,0xcc,0xef,0x99,0xea,0x26,0x63,0xdf,0xd6,0xc9,0x78,0xcf,
+  0x54,0x37,0x11,0xdb,0x3f,0x7b,0x4e,0x3a,0xdf,0x3a,0x3b,0xe1,0xa2,0x6e,0x32,0x34,
+  0xc3,0xdc,0x9c,0x39,0x9c,0x8d,0x08,0x67,0x0e,0x6c,0x08,0xee,0x4f,0x4e,0x01,0x08,
+  0xe5,0xb7,0x8a,0x16,0x10,0x03,0x37,0x72,0xc1,0x38,0xd2,0x2b,0x31,0x05,0x7b,0x19,
+  0x37,0x8b,0x1c,0x1d,0x27,0x27,0xc1,0x36,0x42,0x18,0x27,0x65,0xfa,0x18,0x63,0x3e,
+  0x87,0x8d,0xb2,0xe1,0x01,0x48,0x40,0x13,0x6d,0x2b,0xe8,0x38,0x8a,0xaa,0x31,0x15,
+  0x4f,0xef,0x47,0xa4,0x69,0xe8,0xb3,0xe9,0x7f,0xff,0xf1,0x2f,0xb3,0x89,0x51,0x0f,
+  0x12,0xb0,0x15,0x83,0x1d,0x1e,0x21,0xcc,0x55,0xb3,0xca,0x8e,0x5b,0x37,0x91,0x85,
+  0x77,0x00,0x41,0x83,0xa0,0xfd,0x73,0x12,0x44,0x12,0x0b,0xc0,0xae,0xa9,0xf2,0xd3,
+  0x05,0xca,0xce,0xfb,0x30,0x3e,0x14,0x6f,0x69,0x3e,0xd6,0xf9,0xa5,0x98,0x61,0xaa,
+  0xbc,0x0f,0x75,0x58,0xa9,0x57,0xda,0xfd,0x31,0xc9,0xdc,0x85,0x00,0x29,0xbf,0x54,
+  0x4b,0xcd,0x33,0x92,0x6e,0x32,0x37,0xaa,0x67,0xe6,0x46,0x2d,0xb5,0xe2,0xbc,0x86,
+  0xf6,0x32,0x51,0xc8,0x19,0xa3,0x71,0xee,0x2d,0x9f,0xd5,0x61,0x05,0xb3,0xa9,0xbe,
+  0xd9,0x01,0xc5,0xcb,0xbb,0x87,0xa9,0xd2,0xe0,0x5e,0x0d,0x05,0x21,0xab,0x9a,0x6c,
+  0x07,0x58,0x65,0xe1,0x55,0xcd,0x76,0xdb,0x32,0x96,0x3e,0x2b,0x57,0x53,0x56,0x02,
+  0x5c,0x65,0x9d,0xb2,0xca,0x61,0x5b,0x4d,0x5a,0xf7,0x24,0x95,0xb3,0x34,0x99,0x5a,
+  0x7f,0xa5,0x58,0xce,0x8c,0xd1,0xe8,0x04,0x8c,0x3d,0x8b,0x82,0x00,0xd2,0x14,0x66,
+  0x94,0x16,0x5e,0xcc,0x53,0x24,0xae,0x33,0x06,0x40,0xaa,0x94,0x03,0xf9,0x07,0x0e,
+  0x82,0x21,0x81,0xd3,0x29,0xb8,0x2b,0xe4,0x3f,0x75,0xbe,0x64,0xe8,0x6b,0x3c,0x0d,
+  0x02,0x7d,0xdc,0x8c,0x41,0xc6,0x07,0x3f,0x54,0xd7,0x2a,0xba,0xb5,0x58,0x37,0xac,
+  0x41,0xc8,0x4c,0x07,0x2c,0x5d,0x61,0xfe,0xa8,0x18,0x8f,0xf0,0x96,0x90,0xe9,0x55,
+  0x24,0x41,0xc5,0x7c,0x83,0x25,0x12,0x72,0xbe,0x51,0x0c,0x6a,0x69,0x0a,0x01,0x20,
+  0x03,0xcc,0x25,0x2d,0x51,0xbc,0xa1,0xa4,0xa2,0xc3,0x0d,0x18,0x15,0x85,0xb0,0x75,
+  0x57,0xef,0xae,0xe9,0x55,0xc1,0xc5,0xd1,0x31,0xb3,0x9c,0xa9,0xd8,0x62,0x09,0x50,
+  0x07,0xea,0x29,0xe4,0x19,0x79,0x04,0xfe,0xd2,0x31,0xab,0xeb,0x28,0x73,0x39,0x05,
+  0x81,0xce,0xdf,0x7a,0xf3,0x95,0xa4,0x85,0xcf,0xbd,0x68,0x61,0xab,0xf6,0x51,0x94,
+  0x0a,0x97,0xa1,0xa1,0x55,0xb8,0x7a,0xd9,0x39,0x55,0xbf,0x5d,0xd2,0xa0,0xb3,0x05,
+  0x29,0xcd,0xc9,0x3c,0x45,0xdf,0x9d,0xe8,0x6c,0x00,0xc6,0xdd,0x3d,0x5e,0x17,0xae,
+  0xc4,0xe6,0x8a,0xcf,0xa1,0x03,0xc2,0xef,0xb2,0xff,0xfc,0x65,0xf4,0xfe,0x9d,0x1d,
+  0xe3,0xdb,0x38,0x83,0xcd,0x15,0x65,0x31,0x15,0xcc,0x6b,0x1f,0xca,0x58,0x0a,0x28,
+  0x88,0x78,0x84,0x07,0x48,0x8c,0x6f,0xc5,0x0f,0x2b,0xf8,0x17,0x63,0x98,0x10,0x91,
+  0x28,0x8d,0xa9,0x2c,0xad,0x26,0x46,0xf0,0xaa,0xe6,0x95,0x88,0x42,0xe4,0xf8,0x6c,
+  0x5e,0xa6,0xb9,0x20,0x04,0x6c,0x02,0x01,0x13,0x64,0x51,0x65,0x36,0xa5,0xe3,0xd8,
+  0x78,0xe4,0x99,0x39,0x56,0x3b,0x75,0x97,0x06,0xa5,0x5b,0xa0,0xda,0x2b,0x03,0xcf,
+  0xcc,0xae,0x05,0x8a,0x9b,0x82,0x55,0x56,0x2c,0x9d,0xce,0xb6,0x14,0xec,0x74,0x10,
+  0xf4,0x6c,0xe4,0xde,0xd6,0x91,0x7b,0xa5,0x91,0xfb,0x5b,0x47,0xee,0x97,0x46,0x1e,
+  0x6c,0x1d,0x79,0x80,0x23,0x2b,0x1c,0x7e,0x7d,0x60,0x19,0x0c,0xb7,0xdd,0xb3,0x94,
+  0xb0,0x56,0x67,0xa9,0xfb,0xab,0x9c,0xba,0x6c,0x86,0xbc,0xfe,0xd0,0x3b,0x1b,0x6d,
+  0xf8,0x7c,0x9b,0xdd,0x78,0xcc,0xb7,0x21,0x12,0x53,0x96,0x6f,0xdf,0x7c,0xfb,0xf6,
+  0x95,0xaf,0xe8,0x6a,0xf7,0x6f,0x7e,0x77,0xff,0xe0,0xff,0x96,0x45,0xe1,0x65,0xf7,
+  0x77,0x2c,0xaa,0xce,0xa4,0xec,0xce,0xcf,0x42,0x17,0xf8,0x2e,0xcd,0x69,0xfc,0xff,
+  0xd1,0xfc,0x5d,0x8a,0xb3,0xf7,0x01,0xbf,0x4b,0x73,0xe9,0x1a,0xb4,0x46,0xb5,0x22,
+  0xad,0xd5,0x6b,0x7d,0xc8,0xe1,0xf8,0x22,0x03,0xdf,0xe0,0x30,0x62,0x28,0x85,0x64,
+  0xe1,0x0b,0x0f,0xd8,0x4e,0x48,0x46,0x90,0x8d,0x19,0xd2,0xd8,0x44,0x95,0x18,0x69,
+  0x66,0x3e,0x7f,0x7a,0x72,0xfa,0xf9,0xec,0xf8,0xc7,0x13,0xf0,0xa0,0x83,0x5d,0x5d,
+  0x60,0x80,0x0f,0xbc,0x57,0xd7,0xa3,0xd0,0xb6,0x6e,0x7a,0x07,0x96,0xdc,0xb9,0xdb,
+  0x1c,0x87,0xf2,0x94,0x85,0xc8,0xb4,0x0c,0x7d,0xb7,0x99,0x5d,0xf5,0x19,0xa1,0x7d,
+  0xe7,0xf4,0x66,0x40,0x23,0xfa,0x15,0x1e,0x41,0xd7,0x27,0xd0,0xbd,0xd2,0x61,0x13,
+  0xd9,0x90,0x1e,0x53,0x3e,0x69,0xd6,0x1f,0x66,0x4e,0xb3,0x9b,0xdc,0xf2,0xcd,0xe1,
+  0xd5,0xb6,0x30,0xc0,0x17,0x07,0x79,0x20,0x94,0xb8,0x9a,0x9e,0x99,0x0a,0xe4,0x7e,
+  0xcd,0xea,0x1d,0xb1,0xbe,0x16,0x46,0x92,0x54,0x80,0x04,0x66,0x3d,0xc9,0xae,0x8e,
+  0xb1,0x7d,0x8d,0x14,0xf0,0xab,0x2b,0xa4,0x71,0x4f,0xae,0x54,0x47,0x4d,0xd0,0x5c,
+  0x99,0x39,0xab,0xbb,0x43,0x48,0xd6,0xa7,0x20,0xa3,0xec,0x06,0x60,0x54,0x2d,0x1b,
+  0x31,0x2b,0x47,0xa5,0xf5,0xd6,0x5c,0xda,0xe8,0x2d,0x95,0xab,0x01,0x7d,0x84,0xda,
+  0x86,0x09,0x0e,0xc9,0x0f,0xe2,0xf8,0xbc,0xbe,0xc3,0x44,0x40,0x9a,0xba,0xa3,0x7a,
+  0x06,0xcb,0x93,0x5e,0x98,0xdf,0xd1,0x7c,0xef,0x95,0xb6,0x3a,0xe1,0x6d,0x52,0x57,
+  0x7d,0xa9,0x0d,0x18,0x66,0x0f,0xe8,0x01,0x19,0x11,0x86,0xe7,0x8a,0xa3,0x65,0x7d,
+  0x80,0x7f,0x71,0x64,0xc9,0x44,0xe2,0xdf,0x9b,0xa0,0xdd,0xc7,0x8e,0x48,0x91,0x42,
+  0x19,0xe7,0xcc,0x9d,0xca,0x64,0x86,0x21,0xd7,0x25,0xc1,0xd7,0x7f,0x27,0x00,0x26,
+  0x37,0x9b,0xeb,0x29,0x0f,0x8a,0xcf,0xba,0xe8,0xcc,0xbc,0xa4,0x2d,0x98,0x4b,0x83,
+  0xe0,0x08,0x09,0xb4,0xf6,0x09,0x5b,0x71,0xe9,0x72,0xc0,0x92,0x95,0xb9,0x55,0x21,
+  0x82,0x70,0x2d,0x01,0xa7,0xb4,0x50,0xcb,0xe6,0x6b,0x70,0x09,0x96,0x63,0x7c,0x53,
+  0x05,0xb3,0x7e,0x60,0x63,0x9a,0x06,0xd2,0x28,0x04,0x66,0x04,0xc7,0xc5,0xb7,0x42,
+  0x22,0x34,0x9a,0x9a,0x6e,0x36,0xd0,0x92,0x2a,0xc4,0x80,0x59,0xa3,0x40,0xe0,0x08,
+  0x2f,0x2f,0xd7,0x35,0x40,0xff,0x6c,0x59,0x24,0x14,0x73,0x26,0xf1,0xbe,0x6d,0x19,
+  0x32,0x39,0x8d,0xbc,0x6e,0xf3,0xec,0xfd,0xe8,0x03,0x7c,0xc7,0x3f,0xa4,0xe8,0x22,
+  0x4d,0xfa,0xe9,0xfc,0xed,0x08,0x68,0x9f,0x3b,0x3d,0xa3,0x82,0x86,0x89,0xb1,0x44,
+  0x14,0xba,0x1a,0x8c,0x95,0xb9,0x2a,0xd9,0x5b,0x8d,0xde,0xbc,0x7d,0x3d,0x42,0x79,
+  0x61,0xf9,0x26,0xd2,0xc9,0xba,0x56,0x75,0x34,0x7b,0x9b,0x6f,0xe3,0x5b,0xc5,0xef,
+  0xae,0xa5,0xca,0xf9,0xb6,0xc7,0x0c,0x0e,0xb9,0x37,0x95,0x20,0x22,0x19,0x75,0xdc,
+  0xc4,0xa4,0x38,0x07,0xa1,0x00,0x53,0x8d,0x84,0x53,0x21,0x04,0x87,0x12,0xa8,0x2f,
+  0x32,0xcc,0xfa,0x9a,0x5c,0xec,0x84,0x5a,0x53,0xfd,0x3e,0x7c,0xe3,0x5a,0x6b,0xc3,
+  0xf0,0x22,0xbc,0x37,0xf6,0xe3,0xe1,0x35,0x4e,0x27,0xd4,0xbb,0xe8,0xaa,0x97,0xb5,
+  0x60,0x93,0x0e,0x9d,0x6a,0x35,0xb9,0xa3,0xed,0x5b,0x2a,0xd0,0xef,0xb7,0xee,0xe1,
+  0x5d,0x2d,0xea,0x9a,0x30,0xa4,0xd7,0x06,0xbe,0x1e,0x29,0xda,0xad,0x22,0x8b,0x9b,
+  0xdf,0x6f,0x05,0xd7,0x97,0x1e,0xdf,0xb2,0x02,0xf7,0x36,0xcf,0xc7,0xfa,0xf8,0x5d,
+  0xb5,0x2c,0xeb,0xab,0xd1,0xaf,0x2c,0xd8,0x29,0xdd,0xd2,0xf5,0x76,0x36,0xe3,0xa4,
+  0x72,0xe4,0xa9,0x1c,0x73,0x7a,0xf8,0x17,0x4e,0xd9,0x3b,0xca,0x7e,0x5b,0xff,0x6d,
+  0x53,0xbf,0xad,0xff,0x1c,0xf0,0x7f,0xb7,0x3b,0x10,0x3f,0x1f,0x28,0x00,0x00,
+};
+static const size_t INDEX_HTML_GZ_LEN = 3663;
+static const char INDEX_HTML_ETAG[] = "\"ca921998f4042e12\"";
+
+// web/wifi.html: 1751 Bytes, gzip 952 Bytes
+static const uint8_t WIFI_HTML_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x9d,0x55,0xcd,0x6e,0xdb,0x46,
+  0x10,0xbe,0xf3,0x29,0x26,0x3c,0x98,0x12,0x22,0x51,0x36,0x0a,0x04,0x81,0x44,0x12,
+  0x70,0xaa,0xb4,0x35,0x60,0xb4,0x42,0x95,0xb8,0xe7,0x15,0x39,0x24,0xc7,0x5e,0x2e,
+  0xd9,0xdd,0xa5,0x64,0x55,0xd0,0xdb,0xf4,0x31,0x7a,0xcb,0x8b,0x75,0x96,0x4b,0x3b,
+  0x41,0x9c,0x02,0x41,0x2f,0xe4,0x72,0x76,0xe6,0x9b,0xbf,0x6f,0x86,0xc9,0xab,0xa2,
+  0xcd,0xed,0xb1,0x43,0xa8,0x6d,0x23,0xb3,0x20,0x71,0x2f,0x90,0x42,0x55,0x69,0x58,
+  0x60,0xe8,0x04,0x28,0x8a,0x2c,0x69,0xd0,0x0a,0xc8,0x6b,0xa1,0x0d,0xda,0x34,0xec,
+  0x6d,0x39,0x7f,0x1b,0x8e,0x52,0x25,0x1a,0x4c,0xc3,0x3d,0xe1,0xa1,0x6b,0xb5,0x0d,
+  0x21,0x6f,0x95,0x45,0xc5,0x5a,0x07,0x2a,0x6c,0x9d,0x16,0xb8,0xa7,0x1c,0xe7,0xc3,
+  0xc7,0x8c,0x14,0x59,0x12,0x72,0x6e,0x72,0x21,0x31,0xbd,0x62,0x08,0x4b,0x56,0x62,
+  0xf6,0xc7,0xed,0xf5,0xaf,0xf0,0xd0,0xaa,0x92,0xaa,0x5e,0x13,0x6a,0x54,0xc9,0xc2,
+  0xdf,0x04,0x89,0xb1,0x47,0x7e,0xef,0xda,0xe2,0x78,0x2a,0x19,0x7a,0x5e,0x8a,0x86,
+  0xe4,0x71,0x69,0x8e,0xc6,0x62,0x33,0xef,0x69,0x76,0xad,0x19,0x72,0x66,0x84,0x32,
+  0x73,0x83,0x9a,0xca,0x55,0x23,0x74,0x45,0x6a,0x79,0xf5,0xa6,0x7b,0x3c,0x93,0xea,
+  0x7a,0x3b,0xdb,0xf5,0xd6,0xb6,0xca,0xdb,0x1b,0xfa,0x0b,0x87,0xbb,0x55,0x27,0x8a,
+  0x82,0x54,0xb5,0x7c,0xcb,0x7a,0x65,0xab,0x9b,0x53,0x41,0xa6,0x93,0xe2,0xb8,0x2c,
+  0x25,0x3e,0xae,0xdc,0x63,0x5e,0x90,0xc6,0xdc,0x52,0xab,0x96,0x79,0x2b,0xfb,0x46,
+  0xad,0x2a,0xd1,0x39,0x7d,0xf6,0xf1,0xe8,0x73,0x5a,0xfe,0xf0,0xe6,0x92,0xed,0x93,
+  0x85,0x8f,0x33,0x48,0x16,0x43,0xc5,0x82,0xc4,0x45,0x9c,0x05,0x00,0x49,0x7d,0xf5,
+  0xcd,0xfc,0x58,0xec,0x6e,0x9d,0x63,0xa0,0x22,0x0d,0xcb,0x10,0xb8,0x9e,0x75,0xcb,
+  0xc7,0xae,0x35,0x5c,0x48,0x31,0x38,0x4e,0xc3,0xc5,0x81,0x4a,0x0a,0x9d,0x32,0xab,
+  0x4b,0xb1,0x43,0x99,0x6d,0xb7,0x37,0xeb,0x64,0xa7,0xb3,0x64,0x48,0x0f,0x5c,0x03,
+  0xd3,0xd0,0xe2,0x23,0x5b,0xf9,0x76,0x18,0x43,0x45,0x08,0x1a,0xff,0xec,0x39,0x01,
+  0xee,0xdf,0xc2,0xdb,0x7d,0x89,0xb1,0x11,0xc6,0x1c,0xb8,0x63,0x2f,0x70,0x3a,0x7f,
+  0x51,0x3c,0x61,0xb9,0xef,0xf0,0x2b,0x08,0x5f,0xd0,0xd1,0xc0,0xf4,0xbb,0x86,0x6c,
+  0x98,0xdd,0xa1,0xde,0x91,0x2a,0x50,0xc1,0x05,0x6c,0x3b,0xa4,0xbc,0x46,0xcd,0x89,
+  0x7a,0xdd,0x21,0xd9,0x85,0xcb,0x76,0x38,0x75,0x43,0xce,0x9c,0x26,0x03,0x77,0x5e,
+  0x92,0xad,0x09,0x61,0xc4,0xe8,0x55,0x05,0x07,0xd2,0x05,0x50,0x03,0xbf,0x10,0x13,
+  0x4a,0x57,0xba,0x57,0x05,0x88,0xbe,0xac,0x70,0x27,0x7a,0x1b,0xc3,0x1a,0x35,0x5c,
+  0xe7,0x39,0x1a,0x03,0x9b,0x96,0x55,0x60,0x27,0x91,0x76,0x16,0xc4,0x83,0xa5,0xfd,
+  0x0c,0x4c,0xeb,0x58,0x8c,0xa0,0xda,0xbc,0x06,0x24,0x05,0x3f,0xa3,0xfe,0xf4,0xb7,
+  0x05,0x8e,0x14,0xa8,0x6e,0x60,0xcf,0x8e,0xfa,0x21,0x58,0x32,0x36,0x1e,0x82,0x48,
+  0x4c,0xae,0xa9,0xb3,0x59,0xc0,0x14,0x36,0x16,0x8c,0x7d,0x2f,0x21,0x05,0x1e,0x90,
+  0xbe,0x61,0x42,0xc7,0x15,0xb2,0x00,0xdd,0xf1,0xdd,0xf1,0xa6,0x98,0x44,0xc6,0x46,
+  0xd3,0x55,0x20,0x91,0xeb,0x46,0x0d,0x07,0x93,0x82,0xea,0xa5,0x5c,0x05,0x81,0x30,
+  0x47,0x95,0x43,0xd9,0xab,0xa1,0x81,0xd0,0xb5,0x52,0x4e,0xa6,0x27,0xce,0xd1,0xea,
+  0xe3,0x69,0xa8,0x9f,0x77,0xe0,0x4c,0xc4,0x41,0x70,0x40,0x25,0xda,0xbc,0x9e,0x44,
+  0x0b,0xd1,0xd1,0xd0,0x6d,0x26,0x93,0xb0,0xbd,0x89,0x66,0x70,0xca,0x05,0x97,0x71,
+  0x19,0xa9,0x76,0x6e,0x6c,0xab,0x31,0x3a,0xb3,0xcf,0xcf,0x10,0xf7,0xcf,0x10,0x3a,
+  0xbe,0x37,0xad,0x9a,0x8c,0xb7,0x54,0xc2,0xe4,0x3e,0x76,0x28,0x08,0x69,0x9a,0x42,
+  0xc4,0xea,0x8a,0x99,0x8c,0x45,0x34,0x05,0x1f,0x03,0x0c,0x09,0xc6,0x8e,0x35,0x3f,
+  0xfa,0x91,0x65,0xac,0xe8,0xee,0xb9,0x2c,0xae,0x50,0x11,0xbc,0x06,0x86,0x61,0x32,
+  0xf1,0x21,0x82,0x39,0xdc,0x6c,0x96,0xa3,0x90,0xba,0xd5,0x08,0x93,0x4b,0x14,0xfa,
+  0xc6,0xf5,0x68,0x2f,0xe4,0x64,0xa8,0xc5,0x74,0xf5,0x55,0x4d,0x9c,0xde,0x19,0x50,
+  0x1a,0x7c,0x19,0x5a,0x29,0x48,0x7e,0x57,0x5c,0x23,0x2f,0x4a,0xac,0x65,0x85,0x26,
+  0xaf,0xa5,0xa8,0x50,0xc5,0xf0,0x8e,0x2c,0x43,0xb9,0x91,0x58,0x3c,0x71,0x1a,0x3a,
+  0xfd,0xe9,0x9f,0x92,0x93,0x70,0x9c,0x61,0x12,0x22,0x93,0x9b,0x1b,0x6e,0x7a,0xae,
+  0xa5,0x8a,0xa3,0xff,0x19,0xf9,0x77,0xc4,0x87,0x10,0xc7,0x31,0x4c,0xee,0xbc,0xaf,
+  0xb1,0x54,0x82,0xe3,0x6b,0x3a,0x6b,0x5c,0x0d,0xa7,0xa3,0xf3,0x33,0x3f,0xcf,0xb9,
+  0x70,0x6d,0xc7,0xe9,0xe9,0x1c,0x9c,0x83,0xe0,0x3f,0x89,0x56,0x46,0xd3,0x98,0x57,
+  0xd5,0xfb,0x3d,0x4b,0x6e,0x99,0xad,0xa8,0x50,0x33,0xfd,0x86,0xa9,0x63,0x8a,0x78,
+  0xba,0xe1,0x3e,0xcd,0x5c,0x80,0xb8,0x8f,0x3b,0x8d,0x4e,0x75,0x8d,0xa5,0xe8,0xa5,
+  0xf5,0x94,0xf0,0x74,0x71,0x3b,0xc9,0x65,0x86,0x07,0xf8,0xf8,0xfb,0xed,0x96,0xb3,
+  0xcf,0xeb,0x8d,0xd0,0xa2,0x31,0x13,0x27,0xfb,0x89,0xa7,0x73,0x2d,0xac,0x98,0x30,
+  0x88,0xe5,0x25,0x8a,0x76,0xfa,0x85,0xf1,0x4b,0xba,0x3a,0xaa,0x3a,0x8e,0xfa,0xbd,
+  0xb5,0x8c,0x36,0xbf,0x6d,0x3f,0xf0,0xb7,0xf3,0xe2,0x69,0xfa,0x8d,0x4a,0x3d,0xb1,
+  0xd5,0x49,0x7d,0x68,0x8e,0x10,0x3a,0x6e,0x1f,0xe0,0xe2,0x02,0x5e,0xf9,0x26,0x3c,
+  0xf7,0x80,0x7f,0x37,0xcf,0xfd,0x71,0x73,0x34,0x83,0xab,0xcb,0xcb,0x4b,0x36,0x73,
+  0xf8,0xbc,0x73,0xc7,0x81,0xe5,0x25,0x33,0x6c,0x5b,0xde,0xaa,0xc3,0x6f,0xec,0x5f,
+  0x48,0x6b,0x54,0x26,0xd7,0x06,0x00,0x00,
+};
+static const size_t WIFI_HTML_GZ_LEN = 952;
+static const char WIFI_HTML_ETAG[] = "\"0f9daa8c5c1032b5\"";
@@ -1,470 +1,1359 @@
-#include "WebUI.h"
-#include <WiFi.h>
-#include <ESPAsyncWebServer.h>
-#include <AsyncTCP.h>
-#include <ArduinoJson.h>
-#include <SI4735.h>
-
-// ===== Externe Symbole aus der .ino =====
-extern SI4735   rx;
-extern uint16_t currentFrequency;
-extern uint8_t  currentMode;
-extern void     oledShowFrequencyScreen();
-extern void     setBand(int8_t up_down);
-extern void     doMode(int8_t v);
-extern int      bandCount();
-extern void     setBandIndex(uint8_t newIdx);
-
-typedef struct {
-  const char *bandName; uint8_t bandType;
-  uint16_t minimumFreq, maximumFreq, currentFreq;
-  int8_t currentStepIdx, bandwidthIdx;
-} Band;
-extern Band band[];
-extern int  bandIdx;
-
-extern int tabAmStep[];
-extern int tabFmStep[];
-extern uint16_t currentStepIdx;
-
-// RDS-PS aus .ino (8 Zeichen + 0)
-extern char rdsPSShown[9];
-
-// ===== Server =====
-static AsyncWebServer server(80);
-
-// ===== UI-Helfer =====
-static inline const char* modeToStr(uint8_t m) {
-  switch (m) {
-    case 0: return "FM";
-    case 1: return "LSB";
-    case 2: return "USB";
-    case 3: return "AM";
-    default: return "UNK";
-  }
-}
-
-static String makeFreqString() {
-  char tmp[8], out[16];
-  sprintf(tmp, "%5.5u", currentFrequency);
-  if (rx.isCurrentTuneFM()) {
-    out[0] = tmp[0]; out[1] = tmp[1]; out[2] = tmp[2]; out[3] = '.'; out[4] = tmp[3]; out[5] = '\0';
-    String s(out); s += " MHz"; return s;
-  } else {
-    out[0] = (tmp[0] == '0') ? ' ' : tmp[0];
-    out[1] = tmp[1];
-    if (currentFrequency < 1000) { out[1] = ' '; out[2] = tmp[2]; out[3] = tmp[3]; out[4] = tmp[4]; out[5]='\0'; }
-    else                         { out[2] = tmp[2]; out[3] = tmp[3]; out[4] = tmp[4]; out[5]='\0'; }
-    String s(out); s.trim(); s += " kHz"; return s;
-  }
-}
-
-static int getStepKHz() {
-  return rx.isCurrentTuneFM() ? (tabFmStep[currentStepIdx] * 10) : tabAmStep[currentStepIdx];
-}
-
-static void setFrequencySafe(uint16_t v) {
-  currentFrequency = v;
-  rx.setFrequency(currentFrequency);
-  oledShowFrequencyScreen();
-}
-
-static void tuneDelta(int delta) {
-  int32_t f = (int32_t)currentFrequency + delta;
-  if (f < 1) f = 1;
-  if (f > 300000) f = 300000;
-  setFrequencySafe((uint16_t)f);
-}
-
-// ===== HTML (PROGMEM) =====
-static const char INDEX_HTML[] PROGMEM = R"HTML(<!doctype html>
-<html lang="de"><head><meta charset="utf-8"><meta name="viewport" content="width=device-width,initial-scale=1">
-<title>ESP32 SI4732 Web UI</title>
-<style>
-  :root { --gap: 8px; --btn-bg:#f6f6f8; --btn-act:#06c; --btn-act-t:#fff; }
-  body{font-family:system-ui,Arial,sans-serif;margin:16px}
-  .row{display:flex;gap:var(--gap);flex-wrap:wrap;margin:8px 0}
-  .grid{display:flex;flex-wrap:wrap;gap:var(--gap)}
-  .group{margin:10px 0}
-  .group h3{margin:8px 0 6px 0;font-size:16px}
-  button{font-size:15px;padding:8px 12px;border:1px solid #ddd;background:var(--btn-bg);border-radius:6px;cursor:pointer}
-  button.active{background:var(--btn-act);color:var(--btn-act-t);border-color:var(--btn-act)}
-  .stat{font-size:18px;margin:4px 0}
-  small{color:#666}
-  a{color:#06c;text-decoration:none}
-</style>
-</head>
-<body>
-  <h1>ESP32 SI4732</h1>
-  <div class="stat">Frequenz: <span id="freq">-</span> <span id="ps"></span></div>
-  <div class="stat">Mode: <span id="mode">-</span> | Band: <span id="bandtext">-</span></div>
-  <div class="stat">RSSI: <span id="rssi">-</span> dBμ, SNR: <span id="snr">-</span> dB</div>
-
-  <div class="group"><h3>Hauptbänder</h3><div class="grid" id="grp-main"></div></div>
-  <div class="group"><h3>Rundfunkbänder</h3><div class="grid" id="grp-bc"></div></div>
-  <div class="group"><h3>Amateurfunkbänder</h3><div class="grid" id="grp-ham"></div></div>
-
-  <div class="row" style="margin-top:6px">
-    <button id="b1">-</button>
-    <button id="b2">-</button>
-    <button id="b3">-</button>
-    <button id="b4">-</button>
-  </div>
-  <small id="hint">Hinweis: Schritte werden aus der aktuell eingestellten Schrittweite abgeleitet.</small>
-
-  <div class="row" style="margin-top:10px">
-    <input id="in" type="number" min="1" step="1" style="width:220px" placeholder="kHz (AM/SW/LW) bzw. 10-kHz-Einheiten (FM)">
-    <button id="setbtn">Set</button>
-    <button id="modebtn">Mode wechseln</button>
-  </div>
-
-  <p style="margin-top:8px"><a href="/wifi">WLAN konfigurieren</a></p>
-
-  <p>API: <code>/api/status</code>, <code>/api/bands</code>, <code>/api/band/set?idx=...</code>, <code>/api/tune?delta=...</code>, <code>/api/setfreq?val=...</code>, <code>/api/mode?next=1</code>, <code>/api/band?dir=1</code></p>
-
-<script>
-let bandList = [];
-let currentBandIdx = -1;
-
-function isMain(name){
-  const n = String(name||'').trim();
-  return (n === 'FM' || n === 'FM ' || n === 'MW-EU' || n === 'MW-NA' || n === 'LW' || n === 'LW ' || n === 'ALL');
-}
-function isHam(name){
-  const n = String(name||'').trim();
-  if (n.startsWith('CB')) return true;
-  return /^[0-9]{1,3}M$/.test(n);
-}
-function isBroadcast(name){
-  const n = String(name||'').trim();
-  return /^[0-9]{2,3}m$/.test(n);
-}
-
-function makeBtn(item){
-  const b = document.createElement('button');
-  b.textContent = item.name.trim();
-  b.dataset.idx = item.idx;
-  b.addEventListener('click', async ()=>{
-    await fetch('/api/band/set?idx='+encodeURIComponent(item.idx));
-    getStatus();
-  });
-  return b;
-}
-
-function renderGroups(){
-  const main = document.getElementById('grp-main');
-  const bc   = document.getElementById('grp-bc');
-  const ham  = document.getElementById('grp-ham');
-  main.innerHTML=''; bc.innerHTML=''; ham.innerHTML='';
-
-  const prefer = ['FM ','FM','MW-EU','MW-NA','LW ','LW','ALL'];
-  const mainPref = [];
-  const mainRest = [];
-  bandList.forEach(it=>{
-    if (isMain(it.name)){
-      const pos = prefer.indexOf(it.name);
-      if (pos>=0) mainPref[pos]=it; else mainRest.push(it);
-    }
-  });
-  [...mainPref.filter(Boolean), ...mainRest].forEach(it=> main.appendChild(makeBtn(it)));
-
-  const bcItems = bandList.filter(it => isBroadcast(it.name));
-  bcItems.sort((a, b) => {
-    const an = String(a.name).trim();
-    const bn = String(b.name).trim();
-    if (an === '120m' && bn !== '120m') return 1;
-    if (bn === '120m' && an !== '120m') return -1;
-    return an.localeCompare(bn, 'de');
-  });
-  bcItems.forEach(it => bc.appendChild(makeBtn(it)));
-
-  const toNum = (n)=>{ if (String(n).startsWith('CB')) return 100000; const m=String(n).match(/^(\d+)/); return m?parseInt(m[1],10):99999; };
-  bandList.filter(it=>isHam(it.name))
-          .sort((a,b)=>toNum(a.name)-toNum(b.name))
-          .forEach(it=> ham.appendChild(makeBtn(it)));
-
-  highlightActive();
-}
-
-function highlightActive(){
-  document.querySelectorAll('button[data-idx]').forEach(btn=>{
-    btn.classList.toggle('active', Number(btn.dataset.idx)===Number(currentBandIdx));
-  });
-}
-
-function renderButtons(mode, step_khz){
-  const defs = [{mult:-5},{mult:-1},{mult:+1},{mult:+5}];
-  const btns = [b1,b2,b3,b4];
-  defs.forEach((o,i) => {
-    const khz = o.mult * step_khz;
-    const label = (Math.abs(khz) >= 1000)
-      ? ((khz/1000).toFixed(3).replace(/\.?0+$/,'') + ' MHz')
-      : (khz + ' kHz');
-    btns[i].textContent = (khz<0?'-':'+') + label.replace(/^[-+]/,'');
-    const delta_internal = (mode === 'FM') ? Math.round(khz/10) : khz;
-    btns[i].dataset.delta = delta_internal;
-  });
-  document.getElementById('hint').textContent =
-    (mode === 'FM')
-    ? ('FM Step: ' + step_khz + ' kHz (Buttons: ±1× bzw. ±5× Step)')
-    : ('AM/SW/LW Step: ' + step_khz + ' kHz (Buttons: ±1× bzw. ±5× Step)');
-}
-
-async function loadBands(){
-  try{
-    const r = await fetch('/api/bands', {cache:'no-store'});
-    const j = await r.json();
-    bandList = (j.items||[]).map(x=>({idx:x.idx, name:String(x.name||'')}));
-    renderGroups();
-    if (typeof j.current_idx === 'number') currentBandIdx = j.current_idx, highlightActive();
-  }catch(e){}
-}
-
-async function getStatus(){
-  try{
-    const r = await fetch('/api/status', {cache:'no-store'});
-    const j = await r.json();
-    document.getElementById('freq').textContent = j.freq_str;
-    document.getElementById('mode').textContent = j.mode;
-    document.getElementById('bandtext').textContent = j.band;
-    document.getElementById('rssi').textContent = j.rssi_dbuv;
-    document.getElementById('snr').textContent = j.snr_db;
-
-    // PS neben der Frequenz anzeigen (nur wenn vorhanden)
-    const psEl = document.getElementById('ps');
-    const ps = (j.ps || '').trim();
-    psEl.textContent = ps ? '(' + ps + ')' : '';
-
-    renderButtons(j.mode, j.step_khz);
-    if (typeof j.band_idx === 'number') { currentBandIdx = j.band_idx; highlightActive(); }
-  }catch(e){}
-}
-
-async function tuneFromBtn(ev){
-  const d = ev.target.dataset.delta;
-  if(!d) return;
-  await fetch('/api/tune?delta='+encodeURIComponent(d));
-  getStatus();
-}
-const b1 = document.getElementById('b1');
-const b2 = document.getElementById('b2');
-const b3 = document.getElementById('b3');
-const b4 = document.getElementById('b4');
-[b1,b2,b3,b4].forEach(b=>b.addEventListener('click', tuneFromBtn));
-
-document.getElementById('setbtn').addEventListener('click', async ()=>{
-  const v = document.getElementById('in').value;
-  if(!v) return;
-  await fetch('/api/setfreq?val='+encodeURIComponent(v));
-  getStatus();
-});
-document.getElementById('modebtn').addEventListener('click', async ()=>{
-  await fetch('/api/mode?next=1'); getStatus();
-});
-
-loadBands();
-getStatus(); setInterval(getStatus, 1000);
-</script>
-</body>
-</html>)HTML";
-
-static const char WIFI_HTML[] PROGMEM = R"HTML(<!doctype html>
-<html lang="de">
-<head><meta charset="utf-8"><meta name="viewport" content="width=device-width,initial-scale=1"><title>WLAN konfigurieren</title>
-<style>body{font-family:system-ui,Arial,sans-serif;margin:16px}input,button{font-size:16px;padding:8px}form{display:flex;flex-direction:column;gap:8px;max-width:360px}</style>
-</head>
-<body>
-  <h1>WLAN konfigurieren</h1>
-  <form method="post" action="/wifi">
-    <label>SSID<br><input type="text" name="ssid" required></label>
-    <label>Passwort<br><input type="password" name="pass"></label>
-    <button type="submit">Verbinden & Speichern</button>
-  </form>
-  <p>Tipp: Nach erfolgreicher Verbindung bitte das Gerät einmal manuell neu starten.</p>
-</body>
-</html>)HTML";
-
-// ===== Routen =====
-static void setupRoutes() {
-  // HTML-Seiten
-  server.on("/", HTTP_GET, [](AsyncWebServerRequest* req) {
-    req->send_P(200, "text/html; charset=utf-8", INDEX_HTML);
-  });
-  server.on("/wifi", HTTP_GET, [](AsyncWebServerRequest* req) {
-    req->send_P(200, "text/html; charset=utf-8", WIFI_HTML);
-  });
-
-  // WLAN-POST
-  server.on("/wifi", HTTP_POST, [](AsyncWebServerRequest* req) {
-    String ssid = req->hasParam("ssid", true) ? req->getParam("ssid", true)->value() : "";
-    String pass = req->hasParam("pass", true) ? req->getParam("pass", true)->value() : "";
-    if (ssid.length() == 0) { req->send(400, "text/plain", "Missing SSID"); return; }
-
-    WiFi.softAPdisconnect(true);
-    WiFi.mode(WIFI_STA);
-    WiFi.persistent(true);
-    WiFi.begin(ssid.c_str(), pass.c_str());
-
-    uint32_t start = millis();
-    while (WiFi.status() != WL_CONNECTED && (millis() - start) < 15000) {
-      delay(250);
-    }
-
-    if (WiFi.status() == WL_CONNECTED) {
-      req->send(200, "text/html; charset=utf-8",
-                "Verbunden mit " + WiFi.SSID() + " - IP: " + WiFi.localIP().toString() + "<br>Bitte Gerät manuell neu starten.");
-    } else {
-      req->send(200, "text/html; charset=utf-8",
-                "Verbindung fehlgeschlagen. Bitte SSID/Passwort prüfen und erneut versuchen.");
-    }
-  });
-
-  // API: Bands (no-cache)
-  server.on("/api/bands", HTTP_GET, [](AsyncWebServerRequest* req) {
-    const int total = bandCount();
-    StaticJsonDocument<2048> doc;
-    doc["total"] = total;
-    doc["current_idx"] = bandIdx;
-    JsonArray arr = doc.createNestedArray("items");
-    for (int i = 0; i < total; i++) {
-      JsonObject o = arr.createNestedObject();
-      o["idx"] = i;
-      o["name"] = band[i].bandName;
-    }
-    String out; serializeJson(doc, out);
-    AsyncWebServerResponse* res = req->beginResponse(200, "application/json", out);
-    res->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-    res->addHeader("Pragma", "no-cache");
-    res->addHeader("Expires", "0");
-    req->send(res);
-  });
-
-  // API: Band setzen
-  server.on("/api/band/set", HTTP_GET, [](AsyncWebServerRequest* req) {
-    int total = bandCount();
-    int target = -1;
-    if (req->hasParam("idx")) {
-      target = req->getParam("idx")->value().toInt();
-    } else if (req->hasParam("name")) {
-      String name = req->getParam("name")->value();
-      for (int i = 0; i < total; i++) {
-        if (name.equalsIgnoreCase(band[i].bandName)) { target = i; break; }
-      }
-    } else {
-      req->send(400, "text/plain", "missing idx/name"); return;
-    }
-    if (target < 0 || target >= total) { req->send(400, "text/plain", "invalid idx"); return; }
-
-    if (target != bandIdx) setBandIndex((uint8_t) target);
-    req->send(200, "text/plain", "OK");
-  });
-
-  // API: Status (+ PS) – no-cache
-  server.on("/api/status", HTTP_GET, [](AsyncWebServerRequest* req) {
-    rx.getCurrentReceivedSignalQuality();
-    int8_t rssi = rx.getCurrentRSSI();
-    int8_t snr  = rx.getCurrentSNR();
-
-    uint16_t freqNow = rx.getFrequency();
-    if (freqNow != currentFrequency) currentFrequency = freqNow;
-
-    const int step_khz = getStepKHz();
-
-    StaticJsonDocument<512> doc;
-    doc["mode"]      = modeToStr(currentMode);
-    doc["band"]      = band[bandIdx].bandName;
-    doc["band_idx"]  = bandIdx;
-    doc["freq_raw"]  = currentFrequency;
-    doc["freq_str"]  = makeFreqString();
-    doc["step_khz"]  = step_khz;
-    doc["rssi_dbuv"] = rssi;
-    doc["snr_db"]    = snr;
-    doc["net_mode"]  = (WiFi.getMode() & WIFI_AP) ? "AP" : "STA";
-    doc["ip"]        = ((WiFi.getMode() & WIFI_AP) ? WiFi.softAPIP() : WiFi.localIP()).toString();
-    doc["ps"]        = rx.isCurrentTuneFM() ? rdsPSShown : "";
-
-    String out;
-    serializeJson(doc, out);
-    AsyncWebServerResponse* res = req->beginResponse(200, "application/json", out);
-    res->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-    res->addHeader("Pragma", "no-cache");
-    res->addHeader("Expires", "0");
-    req->send(res);
-  });
-
-  // API: Tuning
-  server.on("/api/tune", HTTP_GET, [](AsyncWebServerRequest* req) {
-    if (!req->hasParam("delta")) { req->send(400, "text/plain", "missing delta"); return; }
-    int delta = req->getParam("delta")->value().toInt();
-    tuneDelta(delta);
-    req->send(200, "text/plain", "OK");
-  });
-
-  // API: Frequenz setzen
-  server.on("/api/setfreq", HTTP_GET, [](AsyncWebServerRequest* req) {
-    if (!req->hasParam("val")) { req->send(400, "text/plain", "missing val"); return; }
-    uint16_t v = (uint16_t) req->getParam("val")->value().toInt();
-    setFrequencySafe(v);
-    req->send(200, "text/plain", "OK");
-  });
-
-  // API: Mode
-  server.on("/api/mode", HTTP_GET, [](AsyncWebServerRequest* req) {
-    doMode(1);
-    req->send(200, "text/plain", "OK");
-  });
-
-  // API: Band vor/zurück
-  server.on("/api/band", HTTP_GET, [](AsyncWebServerRequest* req) {
-    if (!req->hasParam("dir")) { req->send(400, "text/plain", "missing dir"); return; }
-    int dir = req->getParam("dir")->value().toInt();
-    setBand((dir >= 0) ? +1 : -1);
-    oledShowFrequencyScreen();
-    req->send(200, "text/plain", "OK");
-  });
-}
-
-// ===== Serverstart =====
-namespace {
-  bool serverStarted = false;
-}
-
-namespace WebUI {
-
-void begin() {
-  if (WiFi.getMode() == WIFI_MODE_NULL) {
-    WiFi.mode(WIFI_AP_STA);
-  }
-
-  if (WiFi.getMode() & WIFI_STA) {
-    WiFi.begin();
-    uint32_t t0 = millis();
-    while (WiFi.status() != WL_CONNECTED && (millis() - t0) < 3000) {
-      delay(10);
-    }
-  }
-
-  if (WiFi.status() != WL_CONNECTED) {
-    if (!(WiFi.getMode() & WIFI_AP)) {
-      WiFi.mode(WIFI_AP_STA);
-    }
-    String ssid = "SI4732-" + String((uint32_t)ESP.getEfuseMac(), HEX).substring(2);
-    if (!WiFi.softAP(ssid.c_str())) {
-      WiFi.mode(WIFI_AP);
-      WiFi.softAP("SI4732");
-    }
-  }
-
-  setupRoutes();
-
-  if (!serverStarted) {
-    server.begin();
-    serverStarted = true;
-  }
-}
-
-void loop() {
-  // AsyncWebServer benötigt hier nichts
-}
-
-} // namespace WebUI
+#include "WebUI.h"
+#include <WiFi.h>
+#include <ESPAsyncWebServer.h>
+#include <AsyncTCP.h>
+#include "RadioTask.h"
+#include "BandScan.h"
+#include "WebAssets.h"
+#include "WifiConn.h"
+#include "Memories.h"
+#include "Rds.h"
+#include "I2cMetrics.h"
+#include "Perf.h"
+#include "RadioLogic.h"
+#include "Bands.h"
+#include "History.h"
+#include "MemScan.h"
+#include "ModeSwitch.h"
+#include "Boot.h"
+#include "AntCap.h"
+#include "Rigctl.h"
+#include "JsonWriter.h"
+#include "ApiJson.h"
+#include <esp_wifi.h>
+#include <esp_heap_caps.h>
+
+// ===== Server =====
+static AsyncWebServer server(80);
+static AsyncEventSource events("/api/events");
+
+// ===== Web-Lock =====
+// Requests und ihre Callbacks laufen im AsyncTCP-Task, der Status-Push wird
+// aber aus WebUI::loop() gesendet. Wo beide Seiten dieselben Objekte der
+// Library anfassen, halten sie diesen Lock (rekursiv: ein Fehler beim Senden
+// kann den Disconnect-Callback im selben Task auslösen).
+static SemaphoreHandle_t webMutex = NULL;
+
+class WebLock {
+public:
+  WebLock()  { xSemaphoreTakeRecursive(webMutex, portMAX_DELAY); }
+  ~WebLock() { xSemaphoreGiveRecursive(webMutex); }
+};
+
+// ===== Status-Push (SSE) =====
+#define STATUS_PUSH_INTERVAL 200
+
+// Letzter an alle Clients verschickter Stand; Änderungen werden als Delta gesendet
+static RadioSnapshot pushed;
+static bool pushedValid = false;
+static uint32_t lastPushCheck = 0;
+
+// ===== UI-Helfer =====
+static void formatIp(char *out, size_t outsz, const IPAddress &ip) {
+  snprintf(out, outsz, "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+}
+
+static int strToMode(const String &s) {
+  if (s.equalsIgnoreCase("FM"))  return 0;
+  if (s.equalsIgnoreCase("LSB")) return 1;
+  if (s.equalsIgnoreCase("USB")) return 2;
+  if (s.equalsIgnoreCase("AM"))  return 3;
+  return -1;
+}
+
+// ===== Antwortpuffer =====
+// JSON-Antworten werden in einen von RESP_POOL_SLOTS statischen Puffern
+// geschrieben und von dort gesendet; es entsteht weder ein String noch ein
+// JsonDocument. Ein Puffer bleibt belegt, bis die Verbindung geschlossen ist
+// (onDisconnect), und wird nur vom AsyncTCP-Task vergeben und freigegeben.
+#define RESP_POOL_SLOTS 4
+#define RESP_BUF_SIZE   1536
+#define HEAP_SAMPLE_MS  1000
+
+static char     respBuf[RESP_POOL_SLOTS][RESP_BUF_SIZE];
+static bool     respBusy[RESP_POOL_SLOTS];
+static uint8_t  respInUse = 0, respPeak = 0;
+static uint32_t respServed = 0, respExhausted = 0, respOverflow = 0;
+
+static int respAcquire() {
+  for (uint8_t i = 0; i < RESP_POOL_SLOTS; i++) {
+    if (respBusy[i]) continue;
+    respBusy[i] = true;
+    if (++respInUse > respPeak) respPeak = respInUse;
+    return i;
+  }
+  respExhausted++;
+  return -1;
+}
+
+static void respRelease(int slot) {
+  if (slot < 0 || !respBusy[slot]) return;
+  respBusy[slot] = false;
+  respInUse--;
+}
+
+// Sendet len Bytes aus dem Pool-Puffer slot; freigegeben wird beim Verbindungsende
+static void respSend(AsyncWebServerRequest* req, int code, const char* type, int slot, size_t len, const char* cacheControl) {
+  AsyncWebServerResponse* res = req->beginResponse(type, len,
+    [slot, len](uint8_t* buf, size_t maxLen, size_t index) -> size_t {
+      size_t n = (index < len) ? len - index : 0;
+      if (n > maxLen) n = maxLen;
+      memcpy(buf, respBuf[slot] + index, n);
+      return n;
+    });
+  res->setCode(code);
+  if (cacheControl) res->addHeader("Cache-Control", cacheControl);
+  req->onDisconnect([slot]() { respRelease(slot); });
+  respServed++;
+  req->send(res);
+}
+
+#define NO_CACHE "no-cache, no-store, must-revalidate"
+
+// JSON über fill(JsonWriter&) erzeugen und senden; 503 wenn alle Puffer belegt
+template <typename F>
+static void sendJson(AsyncWebServerRequest* req, int code, F fill, const char* cacheControl = NO_CACHE) {
+  const int slot = respAcquire();
+  if (slot < 0) { req->send_P(503, "text/plain", "busy"); return; }
+  JsonWriter w(respBuf[slot], RESP_BUF_SIZE);
+  fill(w);
+  if (w.overflow()) {
+    respRelease(slot);
+    respOverflow++;
+    req->send_P(500, "text/plain", "response too large");
+    return;
+  }
+  respSend(req, code, "application/json", slot, w.length(), cacheControl);
+}
+
+// Konstanter Text direkt aus dem Flash
+static void sendText(AsyncWebServerRequest* req, int code, PGM_P text) {
+  req->send_P(code, "text/plain", text);
+}
+
+// Kommando an den Radio-Task; volle Queue wird als 503 gemeldet
+static void postOrBusy(AsyncWebServerRequest* req, uint8_t type, int32_t arg) {
+  if (radioPost(type, arg)) sendText(req, 200, "OK");
+  else                      sendText(req, 503, "busy");
+}
+
+// ===== Heap-Beobachtung =====
+// Freier Heap wird einmal pro Sekunde abgetastet; min/max seit dem letzten
+// Zurücksetzen zeigen, ob der Verbrauch unter Dauerabfragen stabil bleibt.
+static uint32_t heapWinMin = 0, heapWinMax = 0, heapSamples = 0, heapWinStartMs = 0;
+static uint32_t lastHeapSample = 0;
+
+static void heapSample() {
+  const uint32_t f = ESP.getFreeHeap();
+  if (heapSamples == 0 || f < heapWinMin) heapWinMin = f;
+  if (f > heapWinMax) heapWinMax = f;
+  heapSamples++;
+}
+
+static void heapReset() {
+  heapSamples = 0;
+  heapWinMin = heapWinMax = 0;
+  heapWinStartMs = millis();
+  heapSample();
+}
+
+// Registriert eine Route; mit PERF_PROFILE läuft der Handler in einer Zeitmessung.
+// Gemessen wird nur der Handler selbst, nicht das spätere Senden (Chunks, Dateien).
+static void routeOn(const char* path, WebRequestMethodComposite method, ArRequestHandlerFunction fn,
+                    ArBodyHandlerFunction body = nullptr) {
+#if PERF_PROFILE
+  const int id = perfRouteRegister(path, (method == HTTP_POST) ? "POST" : "GET");
+  if (id >= 0) {
+    server.on(path, method, [id, fn](AsyncWebServerRequest* req) {
+      PerfRouteScope t((uint8_t) id);
+      fn(req);
+    }, nullptr, body);
+    return;
+  }
+#endif
+  server.on(path, method, fn, nullptr, body);
+}
+
+// Status-JSON für /api/status und den Event-Stream (ApiJson.cpp). Bei prev == NULL
+// werden alle Felder inkl. Netzwerk geschrieben, sonst nur die geänderten.
+static size_t buildStatusEvent(char *out, size_t outsz, const RadioSnapshot &st, const RadioSnapshot *prev) {
+  if (prev) return apiStatusJson(out, outsz, st, prev, NULL, NULL);
+  const bool ap = (WiFi.getMode() & WIFI_AP);
+  char ip[16];
+  formatIp(ip, sizeof(ip), ap ? WiFi.softAPIP() : WiFi.localIP());
+  return apiStatusJson(out, outsz, st, NULL, ap ? "AP" : "STA", ip);
+}
+
+// Die Library trägt Event-Clients ohne Sperre aus und leert ihre Warteschlangen
+// in den TCP-Callbacks. Hier dieselben Callbacks wie im Konstruktor von
+// AsyncEventSourceClient, nur unter dem Web-Lock, damit events.send() im Loop
+// nie auf einen gerade gelöschten Client trifft. Nur das Anhängen eines neuen
+// Clients ans Listenende (direkt vor onConnect) bleibt ungesperrt.
+static void eventsLockClient(AsyncEventSourceClient *ec) {
+  AsyncClient *c = ec->client();
+  c->onAck([](void *r, AsyncClient *, size_t len, uint32_t time) {
+    WebLock l;
+    ((AsyncEventSourceClient *) r)->_onAck(len, time);
+  }, ec);
+  c->onPoll([](void *r, AsyncClient *) {
+    WebLock l;
+    ((AsyncEventSourceClient *) r)->_onPoll();
+  }, ec);
+  c->onTimeout([](void *r, AsyncClient *, uint32_t time) {
+    WebLock l;
+    ((AsyncEventSourceClient *) r)->_onTimeout(time);
+  }, ec);
+  c->onDisconnect([](void *r, AsyncClient *c) {
+    {
+      WebLock l;
+      ((AsyncEventSourceClient *) r)->_onDisconnect();
+    }
+    delete c;
+  }, ec);
+}
+
+// Prüft auf Änderungen und verteilt genau ein Delta an alle verbundenen Clients
+static void pushStatusIfChanged() {
+  WebLock l;
+  if (events.count() == 0) { pushedValid = false; return; }
+  if (!bootStageDone(BOOT_ST_TUNE)) return;   // noch kein Snapshot veröffentlicht
+
+  RadioSnapshot now;
+  radioGetSnapshot(now);
+  char buf[384];
+  size_t n = buildStatusEvent(buf, sizeof(buf), now, pushedValid ? &pushed : NULL);
+  pushed = now;
+  pushedValid = true;
+  if (n > 0) events.send(buf, "status", millis());
+}
+
+// ===== Statische Inhalte =====
+// Seiten liegen gzip-komprimiert in WebAssets.h (erzeugt von tools/embed_web.py)
+#define ASSET_CACHE_CONTROL "public, max-age=86400"
+
+static bool etagMatches(AsyncWebServerRequest* req, const char* etag) {
+  AsyncWebHeader* h = req->getHeader("If-None-Match");
+  return h && h->value().indexOf(etag) >= 0;
+}
+
+static void sendNotModified(AsyncWebServerRequest* req, const char* etag, const char* cacheControl) {
+  AsyncWebServerResponse* res = req->beginResponse(304);
+  res->addHeader("ETag", etag);
+  res->addHeader("Cache-Control", cacheControl);
+  req->send(res);
+}
+
+static void sendGzipAsset(AsyncWebServerRequest* req, const uint8_t* data, size_t len, const char* etag) {
+  if (etagMatches(req, etag)) { sendNotModified(req, etag, ASSET_CACHE_CONTROL); return; }
+  AsyncWebServerResponse* res = req->beginResponse_P(200, "text/html; charset=utf-8", data, len);
+  res->addHeader("Content-Encoding", "gzip");
+  res->addHeader("ETag", etag);
+  res->addHeader("Cache-Control", ASSET_CACHE_CONTROL);
+  req->send(res);
+}
+
+// Bandliste ist konstant: einmal beim Start serialisieren, danach nur noch senden.
+// Die Web-Oberfläche gruppiert und sortiert nach diesen Metadaten, nicht nach Namen.
+static char   bandsJson[4096];
+static size_t bandsJsonLen = 0;
+static char   bandsEtag[12];
+
+static void buildBandsJson() {
+  bandsJsonLen = apiBandsJson(bandsJson, sizeof(bandsJson));
+
+  // FNV-1a über den Inhalt als ETag
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < bandsJsonLen; i++) { h ^= (uint8_t)bandsJson[i]; h *= 16777619u; }
+  snprintf(bandsEtag, sizeof(bandsEtag), "\"%08x\"", (unsigned) h);
+}
+
+// ===== Speicherkanäle =====
+#define MEM_PAGE_DEFAULT 50
+#define MEM_PAGE_MAX     500
+#define MEM_ITEM_MAX     256   // ein Eintrag als JSON, Name maximal escaped
+
+// Kopiert s als JSON-String-Inhalt (ohne Anführungszeichen)
+static size_t jsonEscape(char *out, size_t outsz, const char *s) {
+  size_t n = 0;
+  for (; *s && n + 7 < outsz; s++) {
+    uint8_t c = (uint8_t) *s;
+    if (c == '"' || c == '\\') { out[n++] = '\\'; out[n++] = c; }
+    else if (c < 0x20)         n += snprintf(out + n, outsz - n, "\\u%04x", c);
+    else                       out[n++] = c;
+  }
+  out[n] = '\0';
+  return n;
+}
+
+static size_t formatMemItem(char *out, size_t outsz, int slot, const MemRecord &r, bool first) {
+  char name[MEM_NAME_LEN * 6 + 1];
+  jsonEscape(name, sizeof(name), r.name);
+  return snprintf(out, outsz,
+    "%s{\"slot\":%d,\"freq\":%u,\"mode\":\"%s\",\"bw\":%u,\"step\":%u,\"bfo\":%d,\"tags\":%lu,\"name\":\"%s\"}",
+    first ? "" : ",", slot, r.freq, modeToStr(r.mode), r.bwIdx, r.stepIdx, r.bfo, (unsigned long) r.tags, name);
+}
+
+// Zustand eines gestreamten Listen-Requests (wird in die Lambda kopiert)
+typedef struct {
+  MemOrder order;
+  uint16_t base, pos, end, left, total, offset;   // pos/end absolut im Index, ab base gezählt
+  uint8_t  phase;   // 0 Kopf, 1 Einträge, 2 Schluss, 3 fertig
+  bool     first;
+  char     prefix[MEM_NAME_LEN + 1];
+} MemStream;
+
+// Liefert so viele ganze Einträge, wie in buf passen; Datensätze werden
+// einzeln aus der Datei gelesen, ein Gesamt-Dokument entsteht nie.
+static size_t memStreamFill(MemStream &ms, uint8_t *buf, size_t maxLen) {
+  char item[MEM_ITEM_MAX];
+  size_t n = 0;
+  for (;;) {
+    size_t len;
+    if (ms.phase == 0) {
+      len = snprintf(item, sizeof(item), "{\"total\":%u,\"offset\":%u,\"items\":[", ms.total, ms.offset);
+    } else if (ms.phase == 1) {
+      if (ms.left == 0 || ms.pos >= ms.end) { ms.phase = 2; continue; }
+      MemRecord r;
+      int slot = memSlotAt(ms.order, ms.pos);
+      if (slot < 0) { ms.phase = 2; continue; }
+      if (!memRead(slot, r) || (ms.prefix[0] && !memNameHasPrefix(r.name, ms.prefix))) { ms.pos++; continue; }
+      len = formatMemItem(item, sizeof(item), slot, r, ms.first);
+    } else if (ms.phase == 2) {
+      len = snprintf(item, sizeof(item), "],\"next\":%d}", (ms.pos < ms.end) ? (int)(ms.pos - ms.base) : -1);
+    } else {
+      return n;
+    }
+    if (n + len > maxLen) return n;
+    memcpy(buf + n, item, len);
+    n += len;
+    if (ms.phase == 1) { ms.pos++; ms.left--; ms.first = false; }
+    else ms.phase++;
+  }
+}
+
+static void sendMemJson(AsyncWebServerRequest* req, int code, int slot) {
+  sendJson(req, code, [slot](JsonWriter &w) { w.beginObject().kv("slot", slot).endObject(); });
+}
+
+static void setupMemoryRoutes() {
+  // Einzelner Kanal
+  routeOn("/api/memories/get", HTTP_GET, [](AsyncWebServerRequest* req) {
+    if (!req->hasParam("slot")) { sendText(req, 400, "missing slot"); return; }
+    int slot = req->getParam("slot")->value().toInt();
+    MemRecord r;
+    if (slot < 0 || !memRead(slot, r)) { sendText(req, 404, "no such slot"); return; }
+    const int buf = respAcquire();
+    if (buf < 0) { sendText(req, 503, "busy"); return; }
+    const size_t len = formatMemItem(respBuf[buf], RESP_BUF_SIZE, slot, r, true);
+    respSend(req, 200, "application/json", buf, len, NULL);
+  });
+
+  // Kanal anlegen (ohne slot) oder überschreiben; fehlende Werte kommen vom aktuellen Empfang
+  routeOn("/api/memories/save", HTTP_POST, [](AsyncWebServerRequest* req) {
+    RadioSnapshot st;
+    radioGetSnapshot(st);
+    MemRecord r;
+    memset(&r, 0, sizeof(r));
+    r.freq    = req->hasParam("freq", true) ? (uint16_t) req->getParam("freq", true)->value().toInt() : st.freq;
+    int mode  = req->hasParam("mode", true) ? strToMode(req->getParam("mode", true)->value()) : st.mode;
+    if (mode < 0 || r.freq == 0) { sendText(req, 400, "invalid freq/mode"); return; }
+    r.mode    = (uint8_t) mode;
+    r.bwIdx   = req->hasParam("bw", true)   ? (uint8_t) req->getParam("bw", true)->value().toInt()   : st.bwIdx;
+    r.stepIdx = req->hasParam("step", true) ? (uint8_t) req->getParam("step", true)->value().toInt() : st.stepIdx;
+    r.bfo     = req->hasParam("bfo", true)  ? (int16_t) req->getParam("bfo", true)->value().toInt()  : st.bfo;
+    r.tags    = req->hasParam("tags", true) ? (uint32_t) strtoul(req->getParam("tags", true)->value().c_str(), NULL, 0) : 0;
+    if (req->hasParam("name", true)) strlcpy(r.name, req->getParam("name", true)->value().c_str(), sizeof(r.name));
+    else if (st.ps[0]) strlcpy(r.name, st.ps, sizeof(r.name));
+    int slot = req->hasParam("slot", true) ? req->getParam("slot", true)->value().toInt() : -1;
+    if (slot >= MEM_MAX_CHANNELS) { sendText(req, 400, "invalid slot"); return; }
+
+    slot = memStore(slot, r);
+    if (slot < 0) { sendText(req, 507, "memory full"); return; }
+    sendMemJson(req, 200, slot);
+  });
+
+  routeOn("/api/memories/delete", HTTP_POST, [](AsyncWebServerRequest* req) {
+    if (!req->hasParam("slot", true)) { sendText(req, 400, "missing slot"); return; }
+    int slot = req->getParam("slot", true)->value().toInt();
+    if (slot < 0 || !memDelete(slot)) { sendText(req, 404, "no such slot"); return; }
+    sendText(req, 200, "OK");
+  });
+
+  // Kanal abrufen (führt der Radio-Task aus)
+  routeOn("/api/memories/recall", HTTP_GET, [](AsyncWebServerRequest* req) {
+    if (!req->hasParam("slot")) { sendText(req, 400, "missing slot"); return; }
+    int slot = req->getParam("slot")->value().toInt();
+    if (slot < 0 || slot >= MEM_MAX_CHANNELS) { sendText(req, 400, "invalid slot"); return; }
+    postOrBusy(req, RCMD_MEM_RECALL, slot);
+  });
+
+  // Liste seitenweise: sort=freq|name, q=Namensanfang, from=Frequenz (+ fm=1),
+  // offset/limit für die Seite; "next" im Ergebnis ist der offset der Folgeseite
+  routeOn("/api/memories", HTTP_GET, [](AsyncWebServerRequest* req) {
+    MemStream ms;
+    memset(&ms, 0, sizeof(ms));
+    String q = req->hasParam("q") ? req->getParam("q")->value() : "";
+    bool byName = q.length() || (req->hasParam("sort") && req->getParam("sort")->value() == "name");
+    long offset = req->hasParam("offset") ? req->getParam("offset")->value().toInt() : 0;
+    long limit  = req->hasParam("limit")  ? req->getParam("limit")->value().toInt()  : MEM_PAGE_DEFAULT;
+    if (offset < 0) offset = 0;
+    if (limit < 1) limit = 1;
+    if (limit > MEM_PAGE_MAX) limit = MEM_PAGE_MAX;
+
+    uint16_t first = 0;
+    if (byName) {
+      ms.order = MEM_BY_NAME;
+      strlcpy(ms.prefix, q.c_str(), sizeof(ms.prefix));
+      memPrefixRange(ms.prefix, first, ms.end);
+    } else {
+      ms.order = MEM_BY_FREQ;
+      ms.end = memCount();
+      if (req->hasParam("from")) {
+        bool fm = req->hasParam("fm") && req->getParam("fm")->value().toInt() != 0;
+        first = memLowerBoundFreq(fm, (uint16_t) req->getParam("from")->value().toInt());
+      }
+    }
+    ms.base   = first;
+    ms.total  = ms.end - first;
+    ms.offset = (uint16_t) offset;
+    ms.pos    = first + ((offset < ms.total) ? offset : ms.total);
+    ms.left   = (uint16_t) limit;
+    ms.first  = true;
+
+    AsyncWebServerResponse* res = req->beginChunkedResponse("application/json",
+      [ms](uint8_t* buf, size_t maxLen, size_t) mutable -> size_t {
+        return memStreamFill(ms, buf, maxLen);
+      });
+    res->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+    req->send(res);
+  });
+}
+
+// ===== Batch =====
+// POST /api/batch: geordnete Liste von Einstellungen, die der Radio-Task als
+// eine Transaktion ausführt (RadioBatch in RadioTask.h). Textform sind
+// Formularfelder name=wert in Reihenfolge, Binärform (application/octet-stream)
+// je Operation ein Kennbuchstabe und der Wert little endian. Die Antwort wird
+// erst gesendet, wenn der Radio-Task den Batch ausgeführt hat: der Handler
+// merkt sich den Request, batchPoll() sendet, sobald die Batch-ID im Snapshot
+// angekommen ist.
+//
+// Gesendet werden darf nur im AsyncTCP-Task, dessen Callbacks den Request
+// ungesperrt bearbeiten; von selbst käme er aber erst beim nächsten TCP-Poll
+// (~500 ms) wieder vorbei. WebUI::loop() weckt ihn deshalb: ein Byte über eine
+// Socket-Verbindung an den eigenen Loopback-Port BATCH_WAKE_PORT, dessen
+// onData im AsyncTCP-Task batchPoll() ausführt.
+#define BATCH_BIN_MAX    64     // Bytes im Binärformat
+#define BATCH_TIMEOUT_MS 2000
+#define BATCH_ERR_TIMEOUT 0xFF
+#define BATCH_WAKE_PORT  4533
+#define BATCH_WAKE_MS    100    // Weckruf ohne neue Batch-ID (Timeouts)
+#define BATCH_RECONNECT_MS 1000
+
+// Wartende Requests, Index = Antwortpuffer; req == NULL: frei oder schon beantwortet.
+// Nur der AsyncTCP-Task greift zu; der Loop sieht nur die Anzahl.
+typedef struct {
+  AsyncWebServerRequest *req;
+  bool     bin;
+  uint32_t id, startMs;
+} BatchWait;
+
+static BatchWait batchWait[RESP_POOL_SLOTS];
+static std::atomic<uint8_t> batchOpen{0};
+
+static AsyncServer batchWakeServer(IPAddress(127, 0, 0, 1), BATCH_WAKE_PORT);
+static WiFiClient  batchBell;     // nur WebUI::loop()
+
+// Binärantwort, little endian
+typedef struct __attribute__((packed)) {
+  uint8_t  err;      // RadioBatchErr bzw. BATCH_ERR_TIMEOUT
+  uint32_t id;
+  uint8_t  mode, bandIdx, stepIdx, bwIdx, agcIdx, volume;
+  uint16_t freq;
+  int16_t  bfo;
+  uint8_t  rssi, snr;
+} BatchReply;
+
+static bool batchNumber(const char *v, long lo, long hi, long &out) {
+  char *end;
+  out = strtol(v, &end, 10);
+  return *v && *end == '\0' && out >= lo && out <= hi;
+}
+
+// Ein Feld aus der Textform übernehmen; false = unbekannter Name oder ungültiger Wert
+static bool batchSetText(RadioBatch &b, const String &name, const String &value) {
+  const char *v = value.c_str();
+  long n;
+  if (name == "band") {
+    if (!batchNumber(v, 0, BAND_COUNT - 1, n)) {
+      // Bandname wie in /api/bands ohne Füllzeichen; Groß-/Kleinschreibung zählt (60M/60m)
+      n = -1;
+      for (int i = 0; i < BAND_COUNT && n < 0; i++) {
+        String bn(bandDesc[i].name);
+        bn.trim();
+        if (bn == value) n = i;
+      }
+      if (n < 0) return false;
+    }
+    b.band = (uint8_t) n;  b.has |= RB_BAND;
+  } else if (name == "mode") {
+    n = strToMode(value);
+    if (n < 0) return false;
+    b.mode = (uint8_t) n;  b.has |= RB_MODE;
+  } else if (name == "freq") {
+    if (!batchNumber(v, 1, 65535, n)) return false;
+    b.freq = (uint16_t) n;  b.has |= RB_FREQ;
+  } else if (name == "step") {
+    if (!batchNumber(v, 0, 255, n)) return false;
+    b.stepIdx = (uint8_t) n;  b.has |= RB_STEP;
+  } else if (name == "bw") {
+    if (!batchNumber(v, 0, 255, n)) return false;
+    b.bwIdx = (uint8_t) n;  b.has |= RB_BW;
+  } else if (name == "agc") {
+    if (!batchNumber(v, 0, RADIO_AGC_MAX, n)) return false;
+    b.agcIdx = (uint8_t) n;  b.has |= RB_AGC;
+  } else if (name == "volume") {
+    if (!batchNumber(v, 0, RADIO_VOLUME_MAX, n)) return false;
+    b.volume = (uint8_t) n;  b.has |= RB_VOLUME;
+  } else if (name == "bfo") {
+    if (!batchNumber(v, -RADIO_BFO_LIMIT, RADIO_BFO_LIMIT, n)) return false;
+    b.bfo = (int16_t) n;  b.has |= RB_BFO;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// Binärform: 'b' Band, 'm' Modus, 's' Schritt, 'w' Bandbreite, 'a' AGC, 'v' Lautstärke
+// (je u8), 'f' Frequenz (u16), 'o' BFO (i16). false = unbekannte oder abgeschnittene Operation
+static bool batchParseBin(RadioBatch &b, const uint8_t *p, size_t len) {
+  size_t i = 0;
+  while (i < len) {
+    const uint8_t op = p[i++];
+    const size_t w = (op == 'f' || op == 'o') ? 2 : 1;
+    if (i + w > len) return false;
+    const uint16_t v = (w == 2) ? (uint16_t)(p[i] | (p[i + 1] << 8)) : p[i];
+    i += w;
+    switch (op) {
+      case 'b': b.band    = v; b.has |= RB_BAND;   break;
+      case 'm': b.mode    = v; b.has |= RB_MODE;   break;
+      case 'f': b.freq    = v; b.has |= RB_FREQ;   break;
+      case 's': b.stepIdx = v; b.has |= RB_STEP;   break;
+      case 'w': b.bwIdx   = v; b.has |= RB_BW;     break;
+      case 'a': b.agcIdx  = v; b.has |= RB_AGC;    break;
+      case 'v': b.volume  = v; b.has |= RB_VOLUME; break;
+      case 'o': b.bfo     = (int16_t) v; b.has |= RB_BFO; break;
+      default: return false;
+    }
+  }
+  return true;
+}
+
+static size_t batchRender(char *out, size_t outsz, bool bin, uint32_t id, uint8_t err, const RadioSnapshot &st) {
+  if (bin) {
+    BatchReply r;
+    r.err = err;       r.id = id;
+    r.mode = st.mode;  r.bandIdx = st.bandIdx;  r.stepIdx = st.stepIdx;  r.bwIdx = st.bwIdx;
+    r.agcIdx = st.agcIdx;  r.volume = st.volume;
+    r.freq = st.freq;  r.bfo = st.bfo;  r.rssi = st.rssi;  r.snr = st.snr;
+    memcpy(out, &r, sizeof(r));
+    return sizeof(r);
+  }
+  JsonWriter w(out, outsz);
+  char f[16];
+  formatSnapshotFreq(f, sizeof(f), st);
+  w.beginObject().kv("id", (unsigned long) id).kv("ok", err == RBE_OK);
+  if (err != RBE_OK) w.kv("error", (err == BATCH_ERR_TIMEOUT) ? "timeout" : radioBatchErrStr(err));
+  w.kv("mode", modeToStr(st.mode)).kv("band", bandDesc[st.bandIdx].name).kv("band_idx", st.bandIdx)
+   .kv("freq_raw", st.freq).kv("freq_hz", (unsigned long) st.freqHz).kv("freq_str", f).kv("step_idx", st.stepIdx).kv("step_khz", st.stepKHz)
+   .kv("bw_idx", st.bwIdx).kv("agc", st.agcIdx).kv("volume", st.volume).kv("bfo", st.bfo)
+   .kv("rssi_dbuv", st.rssi).kv("snr_db", st.snr)
+   .endObject();
+  return w.overflow() ? 0 : w.length();
+}
+
+// AsyncTCP-Task: ausgeführte oder abgelaufene Batches beantworten
+static void batchPoll() {
+  RadioSnapshot now;
+  bool haveSnap = false;
+  for (uint8_t slot = 0; slot < RESP_POOL_SLOTS; slot++) {
+    BatchWait &w = batchWait[slot];
+    if (!w.req) continue;
+    if (!haveSnap) { radioGetSnapshot(now); haveSnap = true; }
+    const bool done = (int32_t)(now.batchId - w.id) >= 0;
+    if (!done && (millis() - w.startMs) < BATCH_TIMEOUT_MS) continue;
+
+    // Ergebnis aus dem Ring im Snapshot; fehlt es, wird das gemeldet statt OK
+    const uint8_t e = !done ? BATCH_ERR_TIMEOUT : radioBatchResult(now, w.id);
+    const size_t len = batchRender(respBuf[slot], RESP_BUF_SIZE, w.bin, w.id, e, now);
+    AsyncWebServerRequest *req = w.req;
+    w.req = NULL;
+    batchOpen.fetch_sub(1, std::memory_order_relaxed);
+    respSend(req, 200, w.bin ? "application/octet-stream" : "application/json", slot, len, NO_CACHE);
+  }
+}
+
+// Weckruf-Empfänger: nur Verbindungen über Loopback, Inhalt egal
+static void batchWakeBegin() {
+  batchWakeServer.onClient([](void *, AsyncClient *c) {
+    c->onData([](void *, AsyncClient *, void *, size_t) { batchPoll(); }, nullptr);
+    c->onDisconnect([](void *, AsyncClient *c) { delete c; }, nullptr);
+  }, nullptr);
+  batchWakeServer.begin();
+}
+
+// WebUI::loop(): weckt den AsyncTCP-Task bei neuer Batch-ID, sonst alle BATCH_WAKE_MS
+static void batchWake() {
+  static uint32_t wokeId = 0, wokeMs = 0, connectMs = 0;
+  if (!batchOpen.load(std::memory_order_relaxed)) return;
+  RadioSnapshot now;
+  radioGetSnapshot(now);
+  if (now.batchId == wokeId && (millis() - wokeMs) < BATCH_WAKE_MS) return;
+
+  if (!batchBell.connected()) {
+    if ((millis() - connectMs) < BATCH_RECONNECT_MS) return;
+    connectMs = millis();
+    if (!batchBell.connect(IPAddress(127, 0, 0, 1), BATCH_WAKE_PORT)) return;
+    batchBell.setNoDelay(true);
+  }
+  if (batchBell.write((uint8_t) '!') != 1) { batchBell.stop(); return; }
+  wokeId = now.batchId;
+  wokeMs = millis();
+}
+
+static void setupBatchRoutes() {
+  routeOn("/api/batch", HTTP_POST, [](AsyncWebServerRequest* req) {
+    RadioBatch b;
+    memset(&b, 0, sizeof(b));
+    const bool bin = (req->contentType() == "application/octet-stream");
+    if (bin) {
+      if (req->contentLength() > BATCH_BIN_MAX) { sendText(req, 413, "batch too large"); return; }
+      if (!req->_tempObject || !batchParseBin(b, (const uint8_t*) req->_tempObject, req->contentLength())) {
+        sendText(req, 400, "invalid batch");
+        return;
+      }
+    } else {
+      // Felder in der Reihenfolge des Requests; spätere überschreiben frühere
+      for (size_t i = 0; i < req->params(); i++) {
+        const AsyncWebParameter* p = req->getParam(i);
+        if (!batchSetText(b, p->name(), p->value())) { sendText(req, 400, "invalid batch field"); return; }
+      }
+    }
+
+    // Vorab gegen den veröffentlichten Stand prüfen, damit nichts halb ausgeführt wird
+    RadioSnapshot st;
+    radioGetSnapshot(st);
+    uint8_t mode;
+    const uint8_t err = radioBatchCheck(b, st.bandIdx, st.mode, mode);
+    if (err != RBE_OK) { sendText(req, 400, radioBatchErrStr(err)); return; }
+
+    const int slot = respAcquire();
+    if (slot < 0) { sendText(req, 503, "busy"); return; }
+    if (!radioPostBatch(b)) { respRelease(slot); sendText(req, 503, "busy"); return; }
+
+    // Gesendet wird aus batchPoll(); respSend() gibt den Puffer beim Verbindungsende frei
+    batchWait[slot] = { req, bin, b.id, millis() };
+    batchOpen.fetch_add(1, std::memory_order_relaxed);
+    req->onDisconnect([slot]() {
+      if (batchWait[slot].req) {
+        batchWait[slot].req = NULL;
+        batchOpen.fetch_sub(1, std::memory_order_relaxed);
+      }
+      respRelease(slot);
+    });
+  }, [](AsyncWebServerRequest* req, uint8_t* data, size_t len, size_t index, size_t total) {
+    // Nur die Binärform kommt hier an; Formularfelder zerlegt der Server selbst
+    if (total > BATCH_BIN_MAX) return;
+    if (index == 0) req->_tempObject = malloc(total);
+    if (req->_tempObject && index + len <= total) memcpy((uint8_t*) req->_tempObject + index, data, len);
+  });
+}
+
+// ===== Kanal-Scan =====
+// Kanalliste für den Kanal-Scan (MemScan.h) aus Bandfrequenzen, Speicherkanälen
+// oder einer Liste "MODE:freq,..." aufbauen; Status mit Statistik je Kanal.
+
+static bool mscanAdd(MemScanRequest &r, uint16_t freq, uint8_t mode, int band, uint8_t bw, int16_t bfo, int16_t slot) {
+  if (r.count >= MSCAN_MAX_CH || band < 0) return false;
+  MemScanChannel &c = r.ch[r.count++];
+  c.freq = freq;
+  c.mode = mode;
+  c.bandIdx = (uint8_t) band;
+  c.bwIdx = bw;
+  c.bfo = bfo;
+  c.memSlot = slot;
+  return true;
+}
+
+// bands=i,j,... (ohne: alle Bänder); jeweils die zuletzt eingestellte Frequenz
+static void mscanFromBands(MemScanRequest &r, const String &list) {
+  for (int i = 0; i < BAND_COUNT; i++) {
+    if (list.length()) {
+      bool sel = false;
+      for (int p = 0; p < (int) list.length() && !sel; ) {
+        int e = list.indexOf(',', p);
+        if (e < 0) e = list.length();
+        sel = (list.substring(p, e).toInt() == i) && e > p;
+        p = e + 1;
+      }
+      if (!sel) continue;
+    }
+    const bool fm = (bandDesc[i].type == FM_BAND_TYPE);
+    // bandState gehört dem Radio-Task; die Frequenz trägt er beim Start ein
+    mscanAdd(r, MSCAN_FREQ_BAND, fm ? BAND_MODE_FM : BAND_MODE_AM, i, MSCAN_BW_KEEP, 0, -1);
+  }
+}
+
+// Speicherkanäle in Frequenzreihenfolge; tags != 0: nur Kanäle mit einem dieser Tags
+static void mscanFromMemories(MemScanRequest &r, uint32_t tags) {
+  for (uint16_t pos = 0; r.count < MSCAN_MAX_CH; pos++) {
+    const int slot = memSlotAt(MEM_BY_FREQ, pos);
+    if (slot < 0) break;
+    MemRecord m;
+    if (!memRead(slot, m) || (tags && !(m.tags & tags))) continue;
+    const bool fm = (m.mode == MEM_MODE_FM);
+    mscanAdd(r, m.freq, m.mode, bandFind(fm, m.freq), m.bwIdx, m.bfo, slot);
+  }
+}
+
+// list=FM:10130,AM:999,LSB:7074,9700 (ohne Modus: AM); false = Eintrag ungültig
+static bool mscanFromList(MemScanRequest &r, const String &list) {
+  for (int p = 0; p < (int) list.length(); ) {
+    int e = list.indexOf(',', p);
+    if (e < 0) e = list.length();
+    const String item = list.substring(p, e);
+    p = e + 1;
+    const int colon = item.indexOf(':');
+    const int mode = (colon < 0) ? BAND_MODE_AM : strToMode(item.substring(0, colon));
+    const long f = item.substring(colon + 1).toInt();
+    if (mode < 0 || f <= 0 || f > 65535) return false;
+    const bool fm = (mode == BAND_MODE_FM);
+    if (!mscanAdd(r, (uint16_t) f, (uint8_t) mode, bandFind(fm, (uint16_t) f), MSCAN_BW_KEEP, 0, -1)) return false;
+  }
+  return true;
+}
+
+static const char *mscanStateStr(uint8_t st) {
+  switch (st) {
+    case MSCAN_TUNE: return "scan";
+    case MSCAN_HOLD: return "hold";
+    default:         return "idle";
+  }
+}
+
+// Status stückweise: Kopf, je Kanal ein Eintrag, Schluss
+typedef struct {
+  uint16_t pos;
+  uint8_t  phase;   // 0 Kopf, 1 Kanäle, 2 Schluss, 3 fertig
+} MemScanStream;
+
+static size_t mscanStreamFill(MemScanStream &ms, uint8_t *buf, size_t maxLen) {
+  char item[192];
+  size_t n = 0;
+  for (;;) {
+    size_t len;
+    if (ms.phase == 0) {
+      const uint32_t measured = mscan.measured.load(std::memory_order_relaxed);
+      const uint32_t busy = mscan.busyMs.load(std::memory_order_relaxed);
+      const bool running = mscan.running.load(std::memory_order_acquire);
+      len = snprintf(item, sizeof(item),
+        "{\"running\":%s,\"state\":\"%s\",\"current\":%u,\"measured\":%lu,\"hits\":%lu,\"passes\":%lu,"
+        "\"elapsed_ms\":%lu,\"rate_ch_s\":%lu,\"channels\":[",
+        running ? "true" : "false", mscanStateStr(mscan.state.load(std::memory_order_relaxed)),
+        mscan.current.load(std::memory_order_relaxed), (unsigned long) measured,
+        (unsigned long) mscan.hits.load(std::memory_order_relaxed),
+        (unsigned long) mscan.passes.load(std::memory_order_relaxed),
+        (unsigned long)(running ? millis() - mscan.startedMs.load(std::memory_order_relaxed) : 0),
+        (unsigned long)(busy ? (uint64_t) measured * 1000 / busy : 0));
+    } else if (ms.phase == 1) {
+      if (ms.pos >= mscan.req.count) { ms.phase = 2; continue; }
+      const MemScanChannel &c = mscan.req.ch[ms.pos];
+      const MemScanStat &st = mscan.stat[ms.pos];
+      len = snprintf(item, sizeof(item),
+        "%s{\"freq\":%u,\"mode\":\"%s\",\"band_idx\":%u,\"mem_slot\":%d,\"hits\":%u,\"rssi_dbuv\":%u,\"snr_db\":%u,\"peak_rssi\":%u}",
+        ms.pos ? "," : "", c.freq, modeToStr(c.mode), c.bandIdx, c.memSlot, st.hits, st.rssi, st.snr, st.peakRssi);
+    } else if (ms.phase == 2) {
+      len = snprintf(item, sizeof(item), "]}");
+    } else {
+      return n;
+    }
+    if (n + len > maxLen) return n;
+    memcpy(buf + n, item, len);
+    n += len;
+    if (ms.phase == 1) ms.pos++;
+    else ms.phase++;
+  }
+}
+
+static long paramInt(AsyncWebServerRequest* req, const char* name, long def, long lo, long hi) {
+  long v = req->hasParam(name) ? req->getParam(name)->value().toInt() : def;
+  return constrain(v, lo, hi);
+}
+
+static void setupMemScanRoutes() {
+  // Vor /api/memscan registrieren (matcht auch Unterpfade)
+  routeOn("/api/memscan/stop", HTTP_GET, [](AsyncWebServerRequest* req) {
+    postOrBusy(req, RCMD_MSCAN_STOP, 0);
+  });
+
+  routeOn("/api/memscan/status", HTTP_GET, [](AsyncWebServerRequest* req) {
+    MemScanStream ms;
+    memset(&ms, 0, sizeof(ms));
+    AsyncWebServerResponse* res = req->beginChunkedResponse("application/json",
+      [ms](uint8_t* buf, size_t maxLen, size_t) mutable -> size_t {
+        return mscanStreamFill(ms, buf, maxLen);
+      });
+    res->addHeader("Cache-Control", NO_CACHE);
+    req->send(res);
+  });
+
+  // src=bands|mem|list; squelch (dBµV), snr (dB), settle/dwell/hang (ms)
+  routeOn("/api/memscan", HTTP_GET, [](AsyncWebServerRequest* req) {
+    const String src = req->hasParam("src") ? req->getParam("src")->value() : "mem";
+    if (src != "bands" && src != "mem" && src != "list") { sendText(req, 400, "invalid src"); return; }
+
+    // Nur ein Kanal-Scan gleichzeitig; running setzt der Radio-Task am Ende zurück
+    bool idle = false;
+    if (!mscan.running.compare_exchange_strong(idle, true)) { sendText(req, 409, "memscan running"); return; }
+    MemScanRequest &r = mscan.req;
+    r.count = 0;
+    if (src == "bands") {
+      mscanFromBands(r, req->hasParam("bands") ? req->getParam("bands")->value() : "");
+    } else if (src == "mem") {
+      const uint32_t tags = req->hasParam("tags") ? (uint32_t) strtoul(req->getParam("tags")->value().c_str(), NULL, 0) : 0;
+      mscanFromMemories(r, tags);
+    } else if (!req->hasParam("list") || !mscanFromList(r, req->getParam("list")->value())) {
+      mscan.running.store(false);
+      sendText(req, 400, "invalid list");
+      return;
+    }
+    if (r.count == 0) { mscan.running.store(false); sendText(req, 400, "no channels"); return; }
+    mscanSort(r.ch, r.count);
+    r.squelchRssi = (uint8_t) paramInt(req, "squelch", MSCAN_SQUELCH_DEFAULT, 0, 127);
+    r.minSnr      = (uint8_t) paramInt(req, "snr", 0, 0, 127);
+    r.settleMs    = (uint16_t) paramInt(req, "settle", MSCAN_SETTLE_DEFAULT, SCAN_SETTLE_MIN, SCAN_SETTLE_MAX);
+    r.dwellMs     = (uint16_t) paramInt(req, "dwell", MSCAN_DWELL_DEFAULT, 0, 60000);
+    r.hangMs      = (uint16_t) paramInt(req, "hang", MSCAN_HANG_DEFAULT, 0, 60000);
+
+    if (!radioPost(RCMD_MSCAN_START)) {
+      mscan.running.store(false);
+      sendText(req, 503, "busy");
+      return;
+    }
+    const uint16_t count = r.count;
+    sendJson(req, 200, [count](JsonWriter &w) { w.beginObject().kv("channels", count).endObject(); });
+  });
+}
+
+// ===== Moduswechsel =====
+static const char *siPowerStr(uint8_t p) {
+  switch (p) {
+    case SI_POWER_FM:  return "fm";
+    case SI_POWER_AM:  return "am";
+    case SI_POWER_SSB: return "ssb";
+    default:           return "off";
+  }
+}
+
+// band = Index, ohne: aktuelles Band
+static void setupAntCapRoutes() {
+  routeOn("/api/antcap", HTTP_GET, [](AsyncWebServerRequest* req) {
+    RadioSnapshot st;
+    radioGetSnapshot(st);
+    const uint8_t band = (uint8_t) paramInt(req, "band", st.bandIdx, 0, BAND_COUNT - 1);
+    sendJson(req, 200, [band](JsonWriter &w) {
+      unsigned learned = 0;
+      for (uint8_t i = 0; i < BAND_COUNT; i++)
+        for (uint8_t b = 0; b < ANTCAP_BUCKETS; b++)
+          if (antcapTab[i][b].cap) learned++;
+      w.beginObject();
+      w.kv("hits", (unsigned long) antcapStats.hits.load(std::memory_order_relaxed))
+       .kv("misses", (unsigned long) antcapStats.misses.load(std::memory_order_relaxed))
+       .kv("learns", (unsigned long) antcapStats.learns.load(std::memory_order_relaxed))
+       .kv("drops", (unsigned long) antcapStats.drops.load(std::memory_order_relaxed))
+       .kv("learned", learned)
+       .kv("band", bandDesc[band].name).kv("band_idx", (unsigned) band);
+      w.beginArray("buckets");
+      const uint32_t now = millis();
+      for (uint8_t b = 0; b < ANTCAP_BUCKETS; b++) {
+        const AntCapBucket e = antcapTab[band][b];
+        w.beginObject();
+        w.kv("cap", (unsigned) e.cap);
+        if (e.cap) {
+          w.kv("freq", (unsigned) e.freq).kv("rssi_dbuv", (unsigned) e.rssi)
+           .kv("age_s", (unsigned long)((now - e.learnedMs) / 1000)).kv("stale", e.stale);
+        }
+        w.endObject();
+      }
+      w.endArray();
+      w.endObject();
+    });
+  });
+}
+
+static void setupModeSwitchRoutes() {
+  // Vor /api/modeswitch registrieren (matcht auch Unterpfade)
+  routeOn("/api/modeswitch/bench", HTTP_GET, [](AsyncWebServerRequest* req) {
+    const uint8_t rounds = (uint8_t) paramInt(req, "rounds", MBENCH_ROUNDS_DEFAULT, 1, MBENCH_ROUNDS_MAX);
+    // running setzt der Radio-Task am Ende zurück
+    bool idle = false;
+    if (!mbench.running.compare_exchange_strong(idle, true)) { sendText(req, 409, "bench running"); return; }
+    if (!radioPost(RCMD_MBENCH_START, rounds)) {
+      mbench.running.store(false);
+      sendText(req, 503, "busy");
+      return;
+    }
+    sendJson(req, 200, [rounds](JsonWriter &w) {
+      w.beginObject().kv("switches", (unsigned) rounds * (MBENCH_PATH_LEN - 1)).endObject();
+    });
+  });
+
+  routeOn("/api/modeswitch", HTTP_GET, [](AsyncWebServerRequest* req) {
+    sendJson(req, 200, [](JsonWriter &w) {
+      w.beginObject();
+      w.kv("chip", siPowerStr(modesw.power.load(std::memory_order_relaxed)))
+       .kv("power_ups", (unsigned long) modesw.powerUps.load(std::memory_order_relaxed));
+      w.beginObject("patch");
+      w.kv("loads", (unsigned long) modesw.patchLoads.load(std::memory_order_relaxed))
+       .kv("skips", (unsigned long) modesw.patchSkips.load(std::memory_order_relaxed))
+       .kv("fails", (unsigned long) modesw.patchFails.load(std::memory_order_relaxed))
+       .kv("i2c_hz", (unsigned long) modesw.patchHz.load(std::memory_order_relaxed))
+       .kv("last_us", (unsigned long) modesw.patchUs.load(std::memory_order_relaxed));
+      w.endObject();
+      w.beginObject("bench");
+      w.kv("running", mbench.running.load(std::memory_order_acquire))
+       .kv("done", (unsigned) mbench.done.load(std::memory_order_relaxed))
+       .kv("total", (unsigned) mbench.total.load(std::memory_order_relaxed));
+      w.beginArray("pairs");
+      for (uint8_t i = 0; i + 1 < MBENCH_PATH_LEN; i++) {
+        const uint8_t from = modeBenchPath[i], to = modeBenchPath[i + 1];
+        const ModeBenchCell c = mbench.cell[from][to];
+        w.beginObject();
+        w.kv("from", modeToStr(from)).kv("to", modeToStr(to)).kv("n", (unsigned) c.n)
+         .kv("reloads", (unsigned) c.reloads)
+         .kv("min_us", (unsigned long) c.minUs)
+         .kv("avg_us", (unsigned long)(c.n ? c.sumUs / c.n : 0))
+         .kv("max_us", (unsigned long) c.maxUs);
+        w.endObject();
+      }
+      w.endArray();
+      w.endObject();
+      w.endObject();
+    });
+  });
+}
+
+// ===== Routen =====
+static void setupRoutes() {
+  // HTML-Seiten
+  routeOn("/", HTTP_GET, [](AsyncWebServerRequest* req) {
+    sendGzipAsset(req, INDEX_HTML_GZ, INDEX_HTML_GZ_LEN, INDEX_HTML_ETAG);
+  });
+  routeOn("/wifi", HTTP_GET, [](AsyncWebServerRequest* req) {
+    sendGzipAsset(req, WIFI_HTML_GZ, WIFI_HTML_GZ_LEN, WIFI_HTML_ETAG);
+  });
+
+  // WLAN-POST
+  routeOn("/wifi", HTTP_POST, [](AsyncWebServerRequest* req) {
+    String ssid = req->hasParam("ssid", true) ? req->getParam("ssid", true)->value() : "";
+    String pass = req->hasParam("pass", true) ? req->getParam("pass", true)->value() : "";
+    if (ssid.length() == 0) { sendText(req, 400, "Missing SSID"); return; }
+    if (ssid.length() > 32 || pass.length() > 64) { sendText(req, 400, "SSID/Passwort zu lang"); return; }
+
+    // Verbindung läuft im Hintergrund; die Seite fragt /api/wifi/status ab
+    wifiProvision(ssid.c_str(), pass.c_str());
+    req->send(202, "text/plain; charset=utf-8", "Verbindung wird aufgebaut ...");
+  });
+
+  // API: WLAN-Status für die Provisionierungsseite
+  routeOn("/api/wifi/status", HTTP_GET, [](AsyncWebServerRequest* req) {
+    sendJson(req, 200, [](JsonWriter &w) {
+      char ip[16];
+      w.beginObject();
+      w.kv("state", wifiStateStr()).kv("attempts", wifiAttempts()).kv("ap", wifiApActive());
+      if (wifiApActive()) { formatIp(ip, sizeof(ip), WiFi.softAPIP()); w.kv("ap_ip", ip); }
+      wifi_ap_record_t info;
+      if (wifiState() == WIFI_ST_CONNECTED && esp_wifi_sta_get_ap_info(&info) == ESP_OK) {
+        char ssid[sizeof(info.ssid) + 1];
+        memcpy(ssid, info.ssid, sizeof(info.ssid));
+        ssid[sizeof(info.ssid)] = '\0';
+        formatIp(ip, sizeof(ip), WiFi.localIP());
+        w.kv("ssid", ssid).kv("ip", ip).kv("rssi", (int) info.rssi);
+      }
+      w.endObject();
+    });
+  });
+
+  // API: Bands (vorserialisiert, 304 bei passendem ETag)
+  routeOn("/api/bands", HTTP_GET, [](AsyncWebServerRequest* req) {
+    if (etagMatches(req, bandsEtag)) { sendNotModified(req, bandsEtag, "no-cache"); return; }
+    AsyncWebServerResponse* res = req->beginResponse_P(200, "application/json", (const uint8_t*) bandsJson, bandsJsonLen);
+    res->addHeader("ETag", bandsEtag);
+    res->addHeader("Cache-Control", "no-cache");
+    req->send(res);
+  });
+
+  // API: Band setzen
+  routeOn("/api/band/set", HTTP_GET, [](AsyncWebServerRequest* req) {
+    int total = BAND_COUNT;
+    int target = -1;
+    if (req->hasParam("idx")) {
+      target = req->getParam("idx")->value().toInt();
+    } else if (req->hasParam("name")) {
+      String name = req->getParam("name")->value();
+      for (int i = 0; i < total; i++) {
+        if (name.equalsIgnoreCase(bandDesc[i].name)) { target = i; break; }
+      }
+    } else {
+      sendText(req, 400, "missing idx/name"); return;
+    }
+    if (target < 0 || target >= total) { sendText(req, 400, "invalid idx"); return; }
+
+    postOrBusy(req, RCMD_SET_BAND, target);
+  });
+
+  // API: Status (+ PS) – no-cache
+  routeOn("/api/status", HTTP_GET, [](AsyncWebServerRequest* req) {
+    if (!bootStageDone(BOOT_ST_TUNE)) { sendText(req, 503, "booting"); return; }
+    RadioSnapshot st;
+    radioGetSnapshot(st);
+
+    // Gleiches Format wie das erste SSE-Event
+    const int buf = respAcquire();
+    if (buf < 0) { sendText(req, 503, "busy"); return; }
+    const size_t len = buildStatusEvent(respBuf[buf], RESP_BUF_SIZE, st, NULL);
+    respSend(req, 200, "application/json", buf, len, NO_CACHE);
+  });
+
+  // API: Status-Push (Server-Sent Events); neuer Client bekommt den vollen Stand
+  events.onConnect([](AsyncEventSourceClient* client) {
+    WebLock l;
+    eventsLockClient(client);
+    if (!bootStageDone(BOOT_ST_TUNE)) return;   // vollen Stand schickt dann der erste Push
+    RadioSnapshot now;
+    radioGetSnapshot(now);
+    char buf[384];
+    size_t n = buildStatusEvent(buf, sizeof(buf), now, NULL);
+    if (n > 0) client->send(buf, "status", millis(), 2000);
+  });
+  server.addHandler(&events);
+
+  // API: Tuning
+  routeOn("/api/tune", HTTP_GET, [](AsyncWebServerRequest* req) {
+    if (!req->hasParam("delta")) { sendText(req, 400, "missing delta"); return; }
+    int delta = req->getParam("delta")->value().toInt();
+    postOrBusy(req, RCMD_TUNE_DELTA, delta);
+  });
+
+  // API: Frequenz setzen
+  routeOn("/api/setfreq", HTTP_GET, [](AsyncWebServerRequest* req) {
+    if (!req->hasParam("val")) { sendText(req, 400, "missing val"); return; }
+    uint16_t v = (uint16_t) req->getParam("val")->value().toInt();
+    postOrBusy(req, RCMD_SET_FREQ, v);
+  });
+
+  // API: Frequenz in Hz setzen (LSB/USB über den BFO, sonst gerundet)
+  routeOn("/api/setfreq_hz", HTTP_GET, [](AsyncWebServerRequest* req) {
+    if (!req->hasParam("hz")) { sendText(req, 400, "missing hz"); return; }
+    const long hz = req->getParam("hz")->value().toInt();
+    if (hz <= 0) { sendText(req, 400, "invalid hz"); return; }
+    postOrBusy(req, RCMD_SET_FREQ_HZ, hz);
+  });
+
+  // API: Mode
+  routeOn("/api/mode", HTTP_GET, [](AsyncWebServerRequest* req) {
+    postOrBusy(req, RCMD_MODE_STEP, 1);
+  });
+
+  // API: Seek starten (dir=1 aufwärts, dir=-1 abwärts), abbrechen (cancel=1)
+  // oder ohne Parameter den Fortschritt abfragen
+  routeOn("/api/seek", HTTP_GET, [](AsyncWebServerRequest* req) {
+    if (req->hasParam("cancel")) { postOrBusy(req, RCMD_SEEK_CANCEL, 0); return; }
+    if (req->hasParam("dir")) {
+      int dir = req->getParam("dir")->value().toInt();
+      postOrBusy(req, RCMD_SEEK_START, (dir > 0) ? 1 : 0);
+      return;
+    }
+    RadioSnapshot st;
+    radioGetSnapshot(st);
+    sendJson(req, 200, [&st](JsonWriter &w) {
+      char f[16];
+      formatFreq(f, sizeof(f), st.freq, st.isFM);
+      w.beginObject().kv("active", st.seeking).kv("freq_raw", st.freq).kv("freq_str", f).endObject();
+    });
+  });
+
+  // API: Band-Scan stoppen (vor /api/scan registrieren, /api/scan matcht auch Unterpfade)
+  routeOn("/api/scan/stop", HTTP_GET, [](AsyncWebServerRequest* req) {
+    postOrBusy(req, RCMD_SCAN_STOP, 0);
+  });
+
+  // API: Band-Scan; Ergebnis wird während des Scans als Binärstrom gesendet
+  // (je Kanal 4 Bytes: freq u16 LE, rssi u8, snr u8 – siehe BandScan.h)
+  routeOn("/api/scan", HTTP_GET, [](AsyncWebServerRequest* req) {
+    RadioSnapshot st;
+    radioGetSnapshot(st);
+    ScanRequest r;
+    int idx = req->hasParam("band") ? req->getParam("band")->value().toInt() : st.bandIdx;
+    if (idx < 0 || idx >= BAND_COUNT) { sendText(req, 400, "invalid band"); return; }
+    r.bandIdx = (uint8_t) idx;
+    r.minF = req->hasParam("min")  ? (uint16_t) req->getParam("min")->value().toInt()  : 0;
+    r.maxF = req->hasParam("max")  ? (uint16_t) req->getParam("max")->value().toInt()  : 0;
+    r.step = req->hasParam("step") ? (uint16_t) req->getParam("step")->value().toInt() : 0;
+    if (r.minF && r.maxF && r.minF > r.maxF) { sendText(req, 400, "min > max"); return; }
+    long settle = req->hasParam("settle") ? req->getParam("settle")->value().toInt() : SCAN_SETTLE_DEFAULT;
+    if (settle < SCAN_SETTLE_MIN) settle = SCAN_SETTLE_MIN;
+    if (settle > SCAN_SETTLE_MAX) settle = SCAN_SETTLE_MAX;
+    r.settleMs = (uint16_t) settle;
+
+    // Nur ein Scan gleichzeitig; running wird vom Radio-Task am Ende zurückgesetzt
+    bool idle = false;
+    if (!scan.running.compare_exchange_strong(idle, true)) { sendText(req, 409, "scan running"); return; }
+    scan.req = r;
+    const uint32_t gen = scan.generation.load() + 1;
+    if (!radioPost(RCMD_SCAN_START)) {
+      scan.running.store(false);
+      sendText(req, 503, "busy");
+      return;
+    }
+
+    AsyncWebServerResponse* res = req->beginChunkedResponse("application/octet-stream",
+      [gen](uint8_t* buf, size_t maxLen, size_t index) -> size_t {
+        uint32_t g = scan.generation.load(std::memory_order_acquire);
+        if (g != gen) return ((int32_t)(g - gen) < 0) ? RESPONSE_TRY_AGAIN : 0;
+        // running vor count lesen: ist der Scan fertig, ist count endgültig
+        bool running = scan.running.load(std::memory_order_acquire);
+        uint16_t count = scan.count.load(std::memory_order_acquire);
+        size_t first = index / sizeof(ScanRecord);
+        size_t n = (count > first) ? (count - first) : 0;
+        if (n == 0) return running ? RESPONSE_TRY_AGAIN : 0;
+        if (n > maxLen / sizeof(ScanRecord)) n = maxLen / sizeof(ScanRecord);
+        if (n == 0) return RESPONSE_TRY_AGAIN;
+        memcpy(buf, &scan.rec[first], n * sizeof(ScanRecord));
+        // Inzwischen ein neuer Scan gestartet? Dann Stream beenden
+        if (scan.generation.load(std::memory_order_acquire) != gen) return 0;
+        return n * sizeof(ScanRecord);
+      });
+    res->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+    req->send(res);
+  });
+
+  // API: Speicherkanäle
+  setupMemoryRoutes();
+
+  // API: mehrere Einstellungen in einem Request
+  setupBatchRoutes();
+
+  // API: Kanal-Scan über Bänder, Speicherkanäle oder eine Liste
+  setupMemScanRoutes();
+
+  // API: Zustand des SSB-Patches und Benchmark der Moduswechsel
+  setupModeSwitchRoutes();
+
+  // API: gelernte Antennenkapazitäten
+  setupAntCapRoutes();
+
+  // API: RDS-Rohgruppen (vor /api/rds registrieren), eine Zeile je Gruppe:
+  // "A B C D E" hexadezimal, E = Fehlerstufen BLEA..BLED (je 2 Bit)
+  routeOn("/api/rds/raw", HTTP_GET, [](AsyncWebServerRequest* req) {
+    long n = req->hasParam("n") ? req->getParam("n")->value().toInt() : RDS_RING_LEN;
+    if (n < 1) n = 1;
+    if (n > RDS_RING_LEN) n = RDS_RING_LEN;
+    RdsGroup g[RDS_RING_LEN];
+    uint16_t cnt = rdsGetRaw(g, (uint16_t) n);
+    const int buf = respAcquire();
+    if (buf < 0) { sendText(req, 503, "busy"); return; }
+    // 23 Zeichen je Zeile, 64 Zeilen passen in RESP_BUF_SIZE
+    size_t len = 0;
+    for (uint16_t i = 0; i < cnt && len + 24 <= RESP_BUF_SIZE; i++) {
+      len += snprintf(respBuf[buf] + len, RESP_BUF_SIZE - len, "%04X %04X %04X %04X %02X\n",
+                      g[i].blk[0], g[i].blk[1], g[i].blk[2], g[i].blk[3], g[i].err);
+    }
+    respSend(req, 200, "text/plain", buf, len, NO_CACHE);
+  });
+
+  // API: dekodierter RDS-Stand
+  routeOn("/api/rds", HTTP_GET, [](AsyncWebServerRequest* req) {
+    RdsState r;
+    rdsGetState(r);
+    sendJson(req, 200, [&r](JsonWriter &w) {
+      char pi[5];
+      snprintf(pi, sizeof(pi), "%04X", r.pi);
+      w.beginObject();
+      w.kv("valid", r.valid).kv("pi", pi).kv("pty", r.pty).kv("tp", r.tp).kv("ta", r.ta).kv("ms", r.ms);
+      w.kv("ps", r.ps).kv("ptyn", r.ptyn).kv("rt", r.rt).kv("rt_ab", r.rtAB);
+      w.beginArray("af");
+      for (uint8_t i = 0; i < r.afCount; i++) w.val(r.af[i]);
+      w.endArray();
+      if (r.ctValid) {
+        w.beginObject("ct");
+        w.kv("mjd", r.ctMjd).kv("hour", r.ctHour).kv("minute", r.ctMinute);   // UTC
+        w.kv("offset_min", r.ctOffset * 30).kv("age_s", (millis() - r.ctAtMs) / 1000);
+        w.endObject();
+      }
+      w.kv("groups", r.groups).kv("errors", r.errors).kv("poll_ms", r.pollMs);
+      w.endObject();
+    });
+  });
+
+  // API: Zeitlinie des Bootablaufs (Boot.h), Zeiten in µs seit dem Start;
+  // audio_us und http_us sind die Enden der Stufen tune und http (0 = noch nicht)
+  routeOn("/api/boot", HTTP_GET, [](AsyncWebServerRequest* req) {
+    sendJson(req, 200, [](JsonWriter &w) {
+      BootRecord r;
+      w.beginObject();
+      bootRecord(BOOT_ST_TUNE, r);
+      w.kv("audio_us", (unsigned long) r.endUs);
+      bootRecord(BOOT_ST_HTTP, r);
+      w.kv("http_us", (unsigned long) r.endUs);
+      w.beginArray("stages");
+      for (uint8_t i = 0; i < BOOT_ST_COUNT; i++) {
+        bootRecord(i, r);
+        w.beginObject();
+        w.kv("name", bootStageName(i));
+        w.beginArray("deps");
+        for (uint8_t d = 0; d < BOOT_ST_COUNT; d++)
+          if (bootStageDeps(i) & (1u << d)) w.val(bootStageName(d));
+        w.endArray();
+        w.kv("start_us", (unsigned long) r.startUs).kv("end_us", (unsigned long) r.endUs)
+         .kv("wait_us", (unsigned long) r.waitUs).kv("core", (unsigned) r.core);
+        w.endObject();
+      }
+      w.endArray();
+      w.endObject();
+    });
+  });
+
+  // API: Heap und Antwortpuffer; reset=1 startet das Beobachtungsfenster neu
+  routeOn("/api/heap", HTTP_GET, [](AsyncWebServerRequest* req) {
+    if (req->hasParam("reset") && req->getParam("reset")->value().toInt() != 0) heapReset();
+    sendJson(req, 200, [](JsonWriter &w) {
+      w.beginObject();
+      w.kv("free", ESP.getFreeHeap()).kv("min_free", ESP.getMinFreeHeap())
+       .kv("largest_block", (unsigned long) heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+      w.beginObject("window");
+      w.kv("ms", millis() - heapWinStartMs).kv("samples", heapSamples)
+       .kv("min", heapWinMin).kv("max", heapWinMax).kv("spread", heapWinMax - heapWinMin);
+      w.endObject();
+      w.beginObject("pool");
+      w.kv("slots", RESP_POOL_SLOTS).kv("size", RESP_BUF_SIZE).kv("in_use", respInUse).kv("peak", respPeak)
+       .kv("served", respServed).kv("exhausted", respExhausted).kv("overflow", respOverflow);
+      w.endObject();
+      w.endObject();
+    });
+  });
+
+  // API: Signalverlauf als Binärstrom (Format in History.h); res=raw|1s|10s|1m,
+  // n = höchstens so viele neueste Datensätze. rate=MS stellt den Abtastabstand ein.
+  routeOn("/api/history", HTTP_GET, [](AsyncWebServerRequest* req) {
+    if (req->hasParam("rate")) {
+      historySetInterval((uint16_t) constrain(req->getParam("rate")->value().toInt(), 0, 65535));
+      sendJson(req, 200, [](JsonWriter &w) { w.beginObject().kv("interval_ms", historyInterval()).endObject(); });
+      return;
+    }
+    uint8_t tier = HIST_TIER_1S;
+    if (req->hasParam("res")) {
+      const String r = req->getParam("res")->value();
+      if (r == "raw")      tier = HIST_TIER_RAW;
+      else if (r == "1s")  tier = HIST_TIER_1S;
+      else if (r == "10s") tier = HIST_TIER_10S;
+      else if (r == "1m")  tier = HIST_TIER_1MIN;
+      else { sendText(req, 400, "invalid res"); return; }
+    }
+    const long n = req->hasParam("n") ? req->getParam("n")->value().toInt() : 0;
+    HistCursor c;
+    historyOpen(c, tier, (uint16_t) constrain(n, 0, 65535));
+    AsyncWebServerResponse* res = req->beginChunkedResponse("application/octet-stream",
+      [c](uint8_t* buf, size_t maxLen, size_t) mutable -> size_t {
+        return historyRender(c, buf, maxLen);
+      });
+    res->addHeader("Cache-Control", NO_CACHE);
+    req->send(res);
+  });
+
+#if I2C_METRICS
+  // API: I2C-Metriken im Prometheus-Textformat, zeilenweise in den Chunk-Puffer
+  routeOn("/api/metrics", HTTP_GET, [](AsyncWebServerRequest* req) {
+    uint32_t cursor = 0;
+    AsyncWebServerResponse* res = req->beginChunkedResponse("text/plain; version=0.0.4",
+      [cursor](uint8_t* buf, size_t maxLen, size_t) mutable -> size_t {
+        return i2cMetricsRender(cursor, (char*) buf, maxLen);
+      });
+    res->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+    req->send(res);
+  });
+#endif
+
+#if PERF_PROFILE
+  // API: Laufzeitprofil der Radio-Schleife und der Handler; reset=1 setzt nach der Ausgabe zurück
+  routeOn("/api/perf", HTTP_GET, [](AsyncWebServerRequest* req) {
+    uint32_t cursor = 0;
+    const bool reset = req->hasParam("reset") && req->getParam("reset")->value().toInt() != 0;
+    AsyncWebServerResponse* res = req->beginChunkedResponse("application/json",
+      [cursor, reset](uint8_t* buf, size_t maxLen, size_t) mutable -> size_t {
+        size_t n = perfRenderJson(cursor, (char*) buf, maxLen);
+        if (n == 0 && reset) { perfReset(); reset = false; }
+        return n;
+      });
+    res->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+    req->send(res);
+  });
+#endif
+
+  // API: Band vor/zurück
+  routeOn("/api/band", HTTP_GET, [](AsyncWebServerRequest* req) {
+    if (!req->hasParam("dir")) { sendText(req, 400, "missing dir"); return; }
+    int dir = req->getParam("dir")->value().toInt();
+    postOrBusy(req, RCMD_BAND_STEP, (dir >= 0) ? +1 : -1);
+  });
+}
+
+// ===== Serverstart =====
+namespace {
+  bool serverStarted = false;
+}
+
+namespace WebUI {
+
+void beginNetwork() {
+  // WLAN verbindet im Hintergrund (AP-Fallback in wifiLoop()), der Server startet sofort
+  bootStageBegin(BOOT_ST_WIFI);
+  wifiBegin();
+  bootStageEnd(BOOT_ST_WIFI);
+  bootStageBegin(BOOT_ST_NET);     // endet in loop()
+}
+
+void begin() {
+  bootStageBegin(BOOT_ST_HTTP);
+  if (!webMutex) webMutex = xSemaphoreCreateRecursiveMutex();
+  buildBandsJson();
+  heapReset();
+  setupRoutes();
+
+  if (!serverStarted) {
+    server.begin();
+    batchWakeBegin();
+    rigctlBegin();
+    serverStarted = true;
+  }
+  bootStageEnd(BOOT_ST_HTTP);
+}
+
+void loop() {
+  wifiLoop();
+  if (!bootStageDone(BOOT_ST_NET) && wifiState() != WIFI_ST_CONNECTING) bootStageEnd(BOOT_ST_NET);
+
+  // Status-Deltas an alle SSE-Clients verteilen
+  if ((millis() - lastPushCheck) >= STATUS_PUSH_INTERVAL) {
+    lastPushCheck = millis();
+    pushStatusIfChanged();
+  }
+  batchWake();
+
+  if ((millis() - lastHeapSample) >= HEAP_SAMPLE_MS) {
+    lastHeapSample = millis();
+    heapSample();
+  }
+}
+
+} // namespace WebUI
@@ -1,10 +1,13 @@
-#pragma once
-#include <Arduino.h>
-
-namespace WebUI {
-  // Startet WiFi (WiFiManager) und den Async-Webserver
-  void begin();
-
-  // Optional (derzeit leer)
-  void loop();
+#pragma once
+#include <Arduino.h>
+
+namespace WebUI {
+  // Startet WiFi (nicht blockierend, siehe WifiConn.h); Bootstufen wifi und net
+  void beginNetwork();
+
+  // Routen und Async-Webserver; Bootstufe http wartet auf die Speicherkanäle
+  void begin();
+
+  // WLAN-Zustandsmaschine; verteilt Status-Änderungen an die SSE-Clients (/api/events)
+  void loop();
 }
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include "WifiConn.h"
+#include <WiFi.h>
+#include <atomic>
+
+static WifiState state = WIFI_ST_IDLE;
+static bool     apActive = false;
+static uint8_t  attempts = 0;
+static uint32_t attemptStart = 0;
+static uint32_t attemptTimeout = WIFI_STA_TIMEOUT;
+static uint32_t lastRetry = 0;
+
+// Von WiFi-Events (eigener Task) gesetzt, in wifiLoop() ausgewertet
+static std::atomic<bool> evGotIp{false};
+static std::atomic<bool> evDisconnected{false};
+
+// Neue Zugangsdaten aus dem Web-Handler
+static char provSsid[33];
+static char provPass[65];
+static std::atomic<bool> provPending{false};
+
+static void onWifiEvent(WiFiEvent_t event) {
+  switch (event) {
+    case ARDUINO_EVENT_WIFI_STA_GOT_IP:       evGotIp = true; break;
+    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED: evDisconnected = true; break;
+    default: break;
+  }
+}
+
+static void startAp() {
+  if (apActive) return;
+  WiFi.mode(WIFI_AP_STA);
+  String ssid = "SI4732-" + String((uint32_t)ESP.getEfuseMac(), HEX).substring(2);
+  if (!WiFi.softAP(ssid.c_str())) WiFi.softAP("SI4732");
+  apActive = true;
+}
+
+static void stopAp() {
+  if (!apActive) return;
+  WiFi.softAPdisconnect(true);
+  WiFi.mode(WIFI_STA);
+  apActive = false;
+}
+
+static void startAttempt(const char *ssid, const char *pass, uint32_t timeout) {
+  evGotIp = false;
+  evDisconnected = false;
+  wl_status_t r = ssid ? WiFi.begin(ssid, pass) : WiFi.begin();
+  state = WIFI_ST_CONNECTING;
+  attempts++;
+  attemptStart = lastRetry = millis();
+  // Ohne gespeicherte Zugangsdaten scheitert begin() sofort: gleich AP-Fallback
+  attemptTimeout = (r == WL_CONNECT_FAILED) ? 0 : timeout;
+}
+
+void wifiBegin() {
+  WiFi.onEvent(onWifiEvent);
+  WiFi.persistent(true);
+  WiFi.setAutoReconnect(false);   // Reconnect übernimmt wifiLoop()
+  WiFi.mode(WIFI_STA);
+  startAttempt(NULL, NULL, WIFI_STA_TIMEOUT);
+}
+
+void wifiProvision(const char *ssid, const char *pass) {
+  strncpy(provSsid, ssid, sizeof(provSsid) - 1); provSsid[sizeof(provSsid) - 1] = '\0';
+  strncpy(provPass, pass, sizeof(provPass) - 1); provPass[sizeof(provPass) - 1] = '\0';
+  provPending = true;
+}
+
+void wifiLoop() {
+  if (state == WIFI_ST_IDLE) return;
+  const uint32_t now = millis();
+
+  // Neue Zugangsdaten: AP bleibt an, damit die Provisionierungsseite den Status sieht
+  if (provPending.exchange(false)) {
+    WiFi.disconnect();
+    startAttempt(provSsid, provPass, WIFI_PROVISION_TIMEOUT);
+    return;
+  }
+
+  if (evGotIp.exchange(false)) {
+    state = WIFI_ST_CONNECTED;
+    evDisconnected = false;
+  }
+
+  switch (state) {
+    case WIFI_ST_CONNECTING:
+      if ((now - attemptStart) > attemptTimeout) {
+        state = WIFI_ST_FAILED;
+        startAp();
+      }
+      break;
+
+    case WIFI_ST_CONNECTED:
+      if (evDisconnected.exchange(false)) {
+        startAttempt(NULL, NULL, WIFI_STA_TIMEOUT);
+        break;
+      }
+      // AP-Fallback erst abschalten, wenn niemand mehr darüber verbunden ist
+      if (apActive && WiFi.softAPgetStationNum() == 0) stopAp();
+      break;
+
+    case WIFI_ST_FAILED:
+      // STA-Versuche im AP_STA-Betrieb wechseln ggf. den Kanal; nur ohne AP-Clients
+      if ((now - lastRetry) > WIFI_RETRY_INTERVAL) {
+        lastRetry = now;
+        if (WiFi.softAPgetStationNum() == 0) startAttempt(NULL, NULL, WIFI_STA_TIMEOUT);
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+WifiState wifiState() { return state; }
+
+const char *wifiStateStr() {
+  switch (state) {
+    case WIFI_ST_CONNECTING: return "connecting";
+    case WIFI_ST_CONNECTED:  return "connected";
+    case WIFI_ST_FAILED:     return "failed";
+    default:                 return "idle";
+  }
+}
+
+bool    wifiApActive() { return apActive; }
+uint8_t wifiAttempts() { return attempts; }
@@ -0,0 +1,30 @@
+#pragma once
+#include <Arduino.h>
+
+// ===== WLAN-Verbindung =====
+// Ereignisgesteuerte Zustandsmaschine für STA, AP-Fallback und Reconnect.
+// Nichts davon blockiert: WiFi-Events setzen nur Flags, wifiLoop() wertet sie
+// im Arduino-Loop aus und überwacht Zeitlimits.
+
+#define WIFI_STA_TIMEOUT     8000    // Boot/Reconnect: so lange auf STA warten, dann AP
+#define WIFI_PROVISION_TIMEOUT 15000 // nach neuen Zugangsdaten aus /wifi
+#define WIFI_RETRY_INTERVAL  30000   // STA-Neuversuch im AP-Fallback (nur ohne AP-Clients)
+
+enum WifiState : uint8_t {
+  WIFI_ST_IDLE = 0,      // noch nicht gestartet
+  WIFI_ST_CONNECTING,    // STA verbindet (ggf. mit AP parallel)
+  WIFI_ST_CONNECTED,     // STA hat eine IP
+  WIFI_ST_FAILED,        // STA-Versuch abgelaufen, AP-Fallback aktiv
+};
+
+// Startet STA mit gespeicherten Zugangsdaten, kehrt sofort zurück
+void wifiBegin();
+// Zustandsmaschine; regelmäßig aus dem Arduino-Loop aufrufen
+void wifiLoop();
+// Neue Zugangsdaten übernehmen (aus dem Web-Handler). Verbindung erfolgt in wifiLoop().
+void wifiProvision(const char *ssid, const char *pass);
+
+WifiState   wifiState();
+const char *wifiStateStr();
+bool        wifiApActive();
+uint8_t     wifiAttempts();
@@ -0,0 +1,64 @@
+#pragma once
+#include "Arduino.h"
+#include "Wire.h"
+
+// ===== Host-HAL: SSD1306 =====
+// Nur der Bildpuffer der Adafruit-Klasse; übertragen wird wie auf dem Gerät
+// über OledFlush. SimSsd1306 ist das Gegenstück am Bus und führt das GDDRAM.
+
+#define SSD1306_SWITCHCAPVCC 0x02
+#define SSD1306_COLUMNADDR   0x21
+#define SSD1306_PAGEADDR     0x22
+#define SSD1306_BLACK        0
+#define SSD1306_WHITE        1
+
+class Adafruit_SSD1306 {
+public:
+  Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire *twi = &Wire, int8_t rst = -1)
+    : w_(w), h_(h) { (void) twi; (void) rst; memset(buf_, 0, sizeof(buf_)); }
+  bool     begin(uint8_t vcs = SSD1306_SWITCHCAPVCC, uint8_t addr = 0x3C) { (void) vcs; (void) addr; return true; }
+  int16_t  width() const  { return w_; }
+  int16_t  height() const { return h_; }
+  uint8_t *getBuffer()    { return buf_; }
+  void     clearDisplay() { memset(buf_, 0, sizeof(buf_)); }
+  void     drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= w_ || y >= h_) return;
+    uint8_t &b = buf_[x + (y / 8) * w_];
+    if (color) b |= 1 << (y & 7); else b &= ~(1 << (y & 7));
+  }
+  void     fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t i = x; i < x + w; i++) for (int16_t j = y; j < y + h; j++) drawPixel(i, j, color);
+  }
+
+private:
+  uint8_t w_, h_;
+  uint8_t buf_[128 * 64 / 8];
+};
+
+// Empfängt Fenster-Kommandos (PAGEADDR/COLUMNADDR) und Daten im horizontalen Adressmodus
+class SimSsd1306 : public HostI2cDevice {
+public:
+  uint8_t gddram[128 * 64 / 8] = {};
+  uint32_t dataBytes = 0;
+
+  bool i2cWrite(const uint8_t *d, size_t len) override {
+    if (len == 0) return true;
+    if (d[0] == 0x40) {                      // Daten
+      for (size_t i = 1; i < len; i++) {
+        gddram[page_ * 128 + col_] = d[i];
+        dataBytes++;
+        if (++col_ > c1_) { col_ = c0_; if (++page_ > p1_) page_ = p0_; }
+      }
+      return true;
+    }
+    for (size_t i = 1; i < len; i++) {       // Kommandos
+      if (d[i] == SSD1306_PAGEADDR && i + 2 < len)   { page_ = p0_ = d[i + 1] & 7; p1_ = d[i + 2] & 7; i += 2; }
+      else if (d[i] == SSD1306_COLUMNADDR && i + 2 < len) { col_ = c0_ = d[i + 1] & 127; c1_ = d[i + 2] & 127; i += 2; }
+    }
+    return true;
+  }
+  size_t i2cRead(uint8_t *, size_t) override { return 0; }
+
+private:
+  uint8_t page_ = 0, p0_ = 0, p1_ = 7, col_ = 0, c0_ = 0, c1_ = 127;
+};
@@ -0,0 +1,48 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// ===== Host-HAL: Arduino-Kern =====
+// Ersatz für die Teile des Arduino-Kerns, die die hardwarefreien Module auf dem
+// Host brauchen. Die Zeit ist virtuell: millis()/micros() laufen nur weiter,
+// wenn der Code wartet (delay, I2C-Übertragung im Simulator) oder der Test sie
+// mit hostAdvanceUs() vorstellt. GPIO ist eine Pegeltabelle, die der Test setzt.
+
+#define HOST_BUILD 1
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define LOW          0
+#define HIGH         1
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+
+#define PROGMEM
+#define PGM_P   const char *
+#define IRAM_ATTR
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define HOST_PIN_COUNT 64
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+int  digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+
+// ===== Nur Host =====
+uint64_t hostNowUs();
+void     hostAdvanceUs(uint64_t us);
+void     hostResetClock();
+// Pegel eines Eingangs setzen (z. B. Encoder-Kontakte)
+void     hostSetPin(uint8_t pin, uint8_t level);
@@ -0,0 +1,36 @@
+#include "Arduino.h"
+
+// ===== Zeit =====
+static uint64_t nowUs = 0;
+
+uint64_t hostNowUs()               { return nowUs; }
+void     hostAdvanceUs(uint64_t us) { nowUs += us; }
+void     hostResetClock()          { nowUs = 0; }
+
+uint32_t millis()                  { return (uint32_t)(nowUs / 1000); }
+uint32_t micros()                  { return (uint32_t) nowUs; }
+void delay(uint32_t ms)            { nowUs += (uint64_t) ms * 1000; }
+void delayMicroseconds(uint32_t us) { nowUs += us; }
+
+// ===== GPIO =====
+static uint8_t pinLevel[HOST_PIN_COUNT];
+static uint8_t pinModes[HOST_PIN_COUNT];
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (pin >= HOST_PIN_COUNT) return;
+  pinModes[pin] = mode;
+  if (mode == INPUT_PULLUP) pinLevel[pin] = HIGH;
+}
+
+int digitalRead(uint8_t pin) {
+  return (pin < HOST_PIN_COUNT) ? pinLevel[pin] : LOW;
+}
+
+// Auf einem Eingang schaltet HIGH wie beim AVR den Pull-up ein
+void digitalWrite(uint8_t pin, uint8_t val) {
+  if (pin < HOST_PIN_COUNT) pinLevel[pin] = val ? HIGH : LOW;
+}
+
+void hostSetPin(uint8_t pin, uint8_t level) {
+  if (pin < HOST_PIN_COUNT) pinLevel[pin] = level ? HIGH : LOW;
+}
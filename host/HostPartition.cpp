@@ -0,0 +1,58 @@
+#include "esp_partition.h"
+
+#define HOST_PARTITIONS 4
+
+HostFlashStats hostFlashStats;
+
+static esp_partition_t parts[HOST_PARTITIONS];
+static uint8_t partCount = 0;
+
+const esp_partition_t *hostPartitionCreate(const char *label, uint32_t size) {
+  if (partCount >= HOST_PARTITIONS || size == 0 || size % HOST_FLASH_SECTOR) return nullptr;
+  esp_partition_t &p = parts[partCount++];
+  p.type = ESP_PARTITION_TYPE_DATA;
+  p.subtype = 0x99;
+  p.size = size;
+  p.address = partCount * 0x100000;
+  snprintf(p.label, sizeof(p.label), "%s", label);
+  p.data = (uint8_t *) malloc(size);
+  memset(p.data, 0xFF, size);
+  return &p;
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char *label) {
+  for (uint8_t i = 0; i < partCount; i++) {
+    const esp_partition_t &p = parts[i];
+    if (p.type != type) continue;
+    if (subtype != ESP_PARTITION_SUBTYPE_ANY && p.subtype != subtype) continue;
+    if (label && strcmp(label, p.label) != 0) continue;
+    return &p;
+  }
+  return nullptr;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *p, size_t offset, void *dst, size_t size) {
+  if (!p || !dst) return ESP_ERR_INVALID_ARG;
+  if (offset + size > p->size) return ESP_ERR_INVALID_SIZE;
+  memcpy(dst, p->data + offset, size);
+  hostFlashStats.reads++;
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *p, size_t offset, const void *src, size_t size) {
+  if (!p || !src) return ESP_ERR_INVALID_ARG;
+  if (offset + size > p->size) return ESP_ERR_INVALID_SIZE;
+  const uint8_t *s = (const uint8_t *) src;
+  for (size_t i = 0; i < size; i++) p->data[offset + i] &= s[i];
+  hostFlashStats.writes++;
+  hostFlashStats.bytesWritten += size;
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *p, size_t offset, size_t size) {
+  if (!p) return ESP_ERR_INVALID_ARG;
+  if (offset % HOST_FLASH_SECTOR || size % HOST_FLASH_SECTOR || offset + size > p->size) return ESP_ERR_INVALID_SIZE;
+  memset(p->data + offset, 0xFF, size);
+  hostFlashStats.erases += size / HOST_FLASH_SECTOR;
+  return ESP_OK;
+}
@@ -0,0 +1,346 @@
+#include "SimSi4735.h"
+
+// Kommandos und Eigenschaften aus dem Programmierhandbuch (AN332)
+#define CMD_POWER_UP        0x01
+#define CMD_POWER_DOWN      0x11
+#define CMD_SET_PROPERTY    0x12
+#define CMD_GET_INT_STATUS  0x14
+#define CMD_FM_TUNE_FREQ    0x20
+#define CMD_FM_SEEK_START   0x21
+#define CMD_FM_TUNE_STATUS  0x22
+#define CMD_FM_RSQ_STATUS   0x23
+#define CMD_FM_RDS_STATUS   0x24
+#define CMD_AM_TUNE_FREQ    0x40
+#define CMD_AM_SEEK_START   0x41
+#define CMD_AM_TUNE_STATUS  0x42
+#define CMD_AM_RSQ_STATUS   0x43
+
+#define ST_CTS     0x80
+#define ST_ERR     0x40
+#define ST_RDSINT  0x04
+#define ST_STCINT  0x01
+
+#define RDS_MIN_SNR 10
+
+// ===== Hilfen =====
+uint32_t SimSi4735::rand16() {
+  rng_ = rng_ * 1664525u + 1013904223u;
+  return rng_ >> 16;
+}
+
+static inline int absDiff(int a, int b) { return a > b ? a - b : b - a; }
+
+// ===== Signalmodell =====
+uint16_t SimSi4735::autoAntcap(uint16_t f) const {
+  if (fm_) return (uint16_t)(60 + (f < 10800 ? (10800 - f) / 20 : 0));
+  const int c = 6000 - f / 8;
+  return (uint16_t)(c < 1 ? 1 : c);
+}
+
+uint8_t SimSi4735::rssiAt(uint16_t f) const {
+  // Rauschboden mit etwas frequenzabhängiger Streuung
+  int best = (fm_ ? 4 : 8) + (int)((f * 2654435761u) >> 30);
+  for (uint8_t i = 0; i < count_; i++) {
+    const SimStation &s = stations_[i];
+    if (s.fm != fm_) continue;
+    const int d = absDiff(f, s.freq);
+    const int v = (int) s.rssi - (fm_ ? d * 2 : d * 6);   // FM 20 dB je 100 kHz, AM 6 dB je kHz
+    if (v > best) best = v;
+  }
+  // Falsch vorgegebene Antennenkapazität kostet 1 dB je 100 Schritte
+  if (f == freq_ && antcapSet_) best -= absDiff(antcap_, autoAntcap(f)) / 100;
+  return (uint8_t) constrain(best, 0, 127);
+}
+
+uint8_t SimSi4735::snrAt(uint16_t f) const {
+  int best = 0;
+  for (uint8_t i = 0; i < count_; i++) {
+    const SimStation &s = stations_[i];
+    if (s.fm != fm_) continue;
+    const int v = (int) s.snr - absDiff(f, s.freq) * (fm_ ? 3 : 8);
+    if (v > best) best = v;
+  }
+  if (f == freq_ && antcapSet_) best -= absDiff(antcap_, autoAntcap(f)) / 100;
+  return (uint8_t) constrain(best, 0, 127);
+}
+
+const SimStation *SimSi4735::tunedStation() const {
+  for (uint8_t i = 0; i < count_; i++)
+    if (stations_[i].fm == fm_ && stations_[i].freq == freq_) return &stations_[i];
+  return nullptr;
+}
+
+// ===== Abstimmen und Seek =====
+void SimSi4735::update() {
+  if (!pending_ || hostNowUs() < stcAtUs_) return;
+  pending_ = false;
+  stc_ = true;
+  if (seeking_) { freq_ = seekDest_; antcap_ = autoAntcap(freq_); seeking_ = false; }
+}
+
+bool SimSi4735::stcPending() {
+  update();
+  return pending_;
+}
+
+uint16_t SimSi4735::frequency() {
+  update();
+  if (!seeking_) return freq_;
+  // Während des Seeks: zuletzt geprüfter Kanal
+  const uint32_t done = (uint32_t)((hostNowUs() - (stcAtUs_ - (uint64_t) seekChannels_ * perChannelUs_)) / perChannelUs_);
+  uint16_t f = seekFrom_;
+  bool limit;
+  for (uint32_t i = 0; i < done && i < seekChannels_; i++) f = seekStep(f, limit);
+  return f;
+}
+
+void SimSi4735::tune(uint16_t f, uint16_t cap) {
+  update();
+  freq_ = f;
+  antcapSet_ = cap;
+  antcap_ = cap ? cap : autoAntcap(f);
+  seeking_ = false;
+  bandLimit_ = false;
+  stc_ = false;
+  pending_ = true;
+  stcAtUs_ = hostNowUs() + (fm_ ? SIM_TUNE_FM_US : SIM_TUNE_AM_US) + (cap ? 0 : SIM_ANTCAP_SEARCH_US);
+  fifoLen_ = 0;
+  nextGroupUs_ = stcAtUs_ + 4 * (uint64_t) SIM_GROUP_US;   // Sync nach einigen Gruppen
+  stats.tunes++;
+}
+
+uint16_t SimSi4735::seekStep(uint16_t f, bool &limit) const {
+  limit = false;
+  const int n = seekUp_ ? f + spacing() : f - spacing();
+  if (n > top())    { limit = true; return seekWrap_ ? bottom() : top(); }
+  if (n < bottom()) { limit = true; return seekWrap_ ? top() : bottom(); }
+  return (uint16_t) n;
+}
+
+bool SimSi4735::seekHit(uint16_t f) const {
+  return rssiAt(f) >= (fm_ ? fmSeekRssi_ : amSeekRssi_) && snrAt(f) >= (fm_ ? fmSeekSnr_ : amSeekSnr_);
+}
+
+void SimSi4735::seekStart(bool up, bool wrap) {
+  update();
+  seekUp_ = up;
+  seekWrap_ = wrap;
+  seekFrom_ = freq_;
+  bandLimit_ = false;
+  const uint16_t maxCh = (top() - bottom()) / spacing() + 1;
+  uint16_t f = freq_, n = 0;
+  bool hit = false;
+  while (n < maxCh) {
+    bool limit;
+    f = seekStep(f, limit);
+    n++;
+    if (limit && !wrap) { bandLimit_ = true; break; }
+    if (seekHit(f)) { hit = true; break; }
+  }
+  if (!hit && wrap) { f = freq_; bandLimit_ = true; }
+  seekDest_ = f;
+  seekChannels_ = n;
+  perChannelUs_ = fm_ ? SIM_TUNE_FM_US : SIM_TUNE_AM_US;
+  seeking_ = true;
+  stc_ = false;
+  pending_ = true;
+  antcapSet_ = 0;
+  stcAtUs_ = hostNowUs() + (uint64_t) n * perChannelUs_;
+  fifoLen_ = 0;
+  nextGroupUs_ = stcAtUs_ + 4 * (uint64_t) SIM_GROUP_US;
+  stats.seeks++;
+  stats.seekChannels += n;
+}
+
+void SimSi4735::setProperty(uint16_t prop, uint16_t value) {
+  switch (prop) {
+    case 0x1400: fmBottom_ = value; break;
+    case 0x1401: fmTop_ = value; break;
+    case 0x1402: fmSpacing_ = value ? value : 10; break;
+    case 0x1403: fmSeekSnr_ = value; break;
+    case 0x1404: fmSeekRssi_ = value; break;
+    case 0x3400: amBottom_ = value; break;
+    case 0x3401: amTop_ = value; break;
+    case 0x3402: amSpacing_ = value ? value : 10; break;
+    case 0x3403: amSeekSnr_ = value; break;
+    case 0x3404: amSeekRssi_ = value; break;
+    default: break;
+  }
+}
+
+// ===== RDS =====
+void SimSi4735::makeGroup(const SimStation &s, Group &g) {
+  const uint32_t seq = groupSeq_++;
+  const uint16_t pty = (uint16_t)(s.pty & 0x1F) << 5;
+  g.blk[0] = s.pi;
+
+  if (seq % 100 == 99) {
+    // 4A: MJD 60000, 12:mm UTC, +1 h
+    const uint32_t mjd = 60000;
+    const uint8_t hour = 12, minute = (uint8_t)((hostNowUs() / 60000000ULL) % 60);
+    g.blk[1] = 0x4000 | pty | ((mjd >> 15) & 3);
+    g.blk[2] = (uint16_t)(((mjd & 0x7FFF) << 1) | (hour >> 4));
+    g.blk[3] = (uint16_t)(((hour & 0x0F) << 12) | (minute << 6) | 2);
+  } else if (seq % 8 < 4) {
+    // 0A: PS-Segment, eine AF (die eigene Frequenz)
+    const uint8_t seg = seq % 8;
+    const size_t n = s.ps ? strlen(s.ps) : 0;
+    const char c0 = (2 * seg < n) ? s.ps[2 * seg] : ' ';
+    const char c1 = (2 * seg + 1u < n) ? s.ps[2 * seg + 1] : ' ';
+    g.blk[1] = 0x0000 | 0x0400 | pty | 0x08 | seg;
+    g.blk[2] = (uint16_t)((0xE1 << 8) | ((s.freq - 8750) / 10));
+    g.blk[3] = (uint16_t)(((uint8_t) c0 << 8) | (uint8_t) c1);
+  } else {
+    // 2A: RadioText, mit CR abgeschlossen
+    const size_t n = s.rt ? strlen(s.rt) : 0;
+    const uint8_t segs = (n >= 64) ? 16 : (uint8_t)((n + 1 + 3) / 4);
+    const uint8_t seg = (uint8_t)(((seq / 8) * 4 + (seq % 8 - 4)) % segs);
+    char c[4];
+    for (uint8_t i = 0; i < 4; i++) {
+      const size_t k = seg * 4 + i;
+      c[i] = (k < n) ? s.rt[k] : (k == n ? 0x0D : ' ');
+    }
+    g.blk[1] = 0x2000 | pty | seg;
+    g.blk[2] = (uint16_t)(((uint8_t) c[0] << 8) | (uint8_t) c[1]);
+    g.blk[3] = (uint16_t)(((uint8_t) c[2] << 8) | (uint8_t) c[3]);
+  }
+
+  // Blockfehler: unter 30 dB SNR 3 % je dB und Block
+  const uint8_t snr = snrAt(freq_);
+  const uint32_t pct = (snr >= 30) ? 0 : (30 - snr) * 3;
+  g.err = 0;
+  for (uint8_t b = 0; b < 4; b++) {
+    if (rand16() % 100 >= pct) continue;
+    const uint8_t level = 1 + rand16() % 3;
+    if (level == 3) g.blk[b] ^= (uint16_t) rand16() | 1;
+    g.err |= level << (6 - 2 * b);
+  }
+}
+
+void SimSi4735::pumpRds() {
+  update();
+  const SimStation *s = tunedStation();
+  const uint64_t now = hostNowUs();
+  if (!powered_ || !fm_ || pending_ || !s || !s->pi || snrAt(freq_) < RDS_MIN_SNR) {
+    if (nextGroupUs_ < now) nextGroupUs_ = now + SIM_GROUP_US;
+    return;
+  }
+  for (uint8_t k = 0; nextGroupUs_ <= now; k++) {
+    if (k > SIM_FIFO_LEN) {           // lange nicht abgefragt: Rest verworfen
+      stats.rdsOverflows += (uint32_t)((now - nextGroupUs_) / SIM_GROUP_US);
+      nextGroupUs_ = now + SIM_GROUP_US;
+      break;
+    }
+    if (fifoLen_ == SIM_FIFO_LEN) {
+      fifoHead_ = (fifoHead_ + 1) % SIM_FIFO_LEN;
+      fifoLen_--;
+      stats.rdsOverflows++;
+    }
+    makeGroup(*s, fifo_[(fifoHead_ + fifoLen_) % SIM_FIFO_LEN]);
+    fifoLen_++;
+    stats.rdsGroups++;
+    nextGroupUs_ += SIM_GROUP_US;
+  }
+}
+
+// ===== I2C =====
+uint8_t SimSi4735::status() {
+  update();
+  pumpRds();
+  return ST_CTS | (stc_ ? ST_STCINT : 0) | (fifoLen_ ? ST_RDSINT : 0);
+}
+
+bool SimSi4735::i2cWrite(const uint8_t *d, size_t len) {
+  if (len == 0) return true;
+  uint8_t a[8] = {};
+  memcpy(a, d, len < sizeof(a) ? len : sizeof(a));
+  memset(resp_, 0, sizeof(resp_));
+  respLen_ = 1;
+  stats.commands++;
+
+  if (!powered_ && a[0] != CMD_POWER_UP) { resp_[0] = ST_CTS | ST_ERR; return true; }
+
+  switch (a[0]) {
+    case CMD_POWER_UP:
+      powered_ = true;
+      fm_ = (a[1] & 0x0F) == 0;
+      pending_ = seeking_ = stc_ = false;
+      fifoLen_ = 0;
+      break;
+    case CMD_POWER_DOWN:
+      powered_ = false;
+      break;
+    case CMD_SET_PROPERTY:
+      setProperty((uint16_t)(a[2] << 8 | a[3]), (uint16_t)(a[4] << 8 | a[5]));
+      break;
+    case CMD_FM_TUNE_FREQ:
+      tune((uint16_t)(a[2] << 8 | a[3]), a[4]);
+      break;
+    case CMD_AM_TUNE_FREQ:
+      tune((uint16_t)(a[2] << 8 | a[3]), (uint16_t)(a[4] << 8 | a[5]));
+      break;
+    case CMD_FM_SEEK_START:
+    case CMD_AM_SEEK_START:
+      seekStart(a[1] & 0x08, a[1] & 0x04);
+      break;
+    case CMD_FM_TUNE_STATUS:
+    case CMD_AM_TUNE_STATUS: {
+      update();
+      if ((a[1] & 0x02) && pending_) {              // CANCEL
+        freq_ = frequency();
+        pending_ = seeking_ = false;
+        stc_ = true;
+      }
+      const uint16_t f = frequency();
+      resp_[1] = (bandLimit_ ? 0x80 : 0) | (pending_ ? 0 : 0x01);   // BLTF, VALID
+      resp_[2] = f >> 8;
+      resp_[3] = f & 0xFF;
+      resp_[4] = rssiAt(f);
+      resp_[5] = snrAt(f);
+      if (fm_) resp_[7] = (uint8_t) antcap_;
+      else { resp_[6] = antcap_ >> 8; resp_[7] = antcap_ & 0xFF; }
+      respLen_ = 8;
+      if (a[1] & 0x01) stc_ = false;                // INTACK
+      break;
+    }
+    case CMD_FM_RSQ_STATUS:
+    case CMD_AM_RSQ_STATUS: {
+      const uint16_t f = frequency();
+      const uint8_t rssi = rssiAt(f), snr = snrAt(f);
+      resp_[2] = (rssi >= (fm_ ? fmSeekRssi_ : amSeekRssi_)) ? 0x01 : 0;
+      resp_[3] = (fm_ && !pending_ && snr >= 15 && tunedStation()) ? 0x80 | 63 : 0;   // PILOT, Stereo-Anteil
+      resp_[4] = rssi;
+      resp_[5] = snr;
+      respLen_ = 8;
+      break;
+    }
+    case CMD_FM_RDS_STATUS: {
+      pumpRds();
+      const SimStation *s = tunedStation();
+      resp_[1] = fifoLen_ ? 0x01 : 0;               // RDSRECV
+      resp_[2] = (fm_ && !pending_ && s && s->pi && snrAt(freq_) >= RDS_MIN_SNR) ? 0x01 : 0;   // RDSSYNC
+      resp_[3] = fifoLen_;
+      if (fifoLen_) {
+        const Group &g = fifo_[fifoHead_];
+        for (uint8_t b = 0; b < 4; b++) { resp_[4 + 2 * b] = g.blk[b] >> 8; resp_[5 + 2 * b] = g.blk[b] & 0xFF; }
+        resp_[12] = g.err;
+        if (a[1] & 0x01) { fifoHead_ = (fifoHead_ + 1) % SIM_FIFO_LEN; fifoLen_--; }   // INTACK
+      }
+      if (a[1] & 0x02) fifoLen_ = 0;                // MTFIFO
+      respLen_ = 13;
+      break;
+    }
+    case CMD_GET_INT_STATUS:
+    default:
+      break;
+  }
+  resp_[0] = status();
+  return true;
+}
+
+size_t SimSi4735::i2cRead(uint8_t *d, size_t len) {
+  for (size_t i = 0; i < len; i++) d[i] = (i < sizeof(resp_)) ? resp_[i] : 0;
+  // Erneutes Lesen liefert den aktuellen Status (CTS-/STC-Abfrage)
+  resp_[0] = status();
+  return len;
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include "Arduino.h"
+#include "Wire.h"
+
+// ===== SI4735-Simulator =====
+// Bildet den Empfänger auf Ebene der I2C-Kommandos nach, so dass Code, der den
+// Chip direkt über Wire anspricht (RDS-Abfrage, Tune-/Seek-Status), auf dem
+// Host unverändert läuft. Modelliert werden:
+//  - Abstimmen mit Tune-Zeit (STC erst nach FM 50 ms bzw. AM 60 ms, mit
+//    automatischer Antennenkapazität +20 ms) und die gewählte Kapazität
+//  - Seek mit Zeit je Kanal, Schwellen, Bandgrenzen und Wrap
+//  - RSSI/SNR je Frequenz aus einer Senderliste mit Abfall neben dem Sender,
+//    Rauschboden und Einbruch bei falscher Antennenkapazität
+//  - einen RDS-Strom (0A/2A/4A mit 11,4 Gruppen/s) in einer FIFO mit 25
+//    Plätzen, Blockfehler abhängig vom SNR
+// Frequenzen wie im Sketch: kHz bzw. 10-kHz-Einheiten bei FM.
+
+#define SIM_SI4735_ADDR       0x11
+#define SIM_FIFO_LEN          25
+#define SIM_GROUP_US          87719      // 11,4 Gruppen/s
+#define SIM_TUNE_FM_US        50000
+#define SIM_TUNE_AM_US        60000
+#define SIM_ANTCAP_SEARCH_US  20000
+
+typedef struct {
+  uint16_t freq;
+  bool     fm;
+  uint8_t  rssi, snr;   // dBµV / dB auf der Senderfrequenz
+  uint16_t pi;          // 0 = kein RDS
+  uint8_t  pty;
+  const char *ps;       // bis 8 Zeichen
+  const char *rt;       // bis 64 Zeichen
+} SimStation;
+
+typedef struct {
+  uint32_t commands;
+  uint32_t tunes, seeks, seekChannels;
+  uint32_t rdsGroups, rdsOverflows;
+} SimSi4735Stats;
+
+class SimSi4735 : public HostI2cDevice {
+public:
+  void setStations(const SimStation *s, uint8_t n) { stations_ = s; count_ = n; }
+
+  bool i2cWrite(const uint8_t *d, size_t len) override;
+  size_t i2cRead(uint8_t *d, size_t len) override;
+
+  // Zustand für Tests und Benchmarks
+  uint16_t frequency();
+  bool     isFM() const      { return fm_; }
+  bool     stcPending();
+  uint16_t antcap() const    { return antcap_; }
+  uint8_t  rssiAt(uint16_t f) const;
+  uint8_t  snrAt(uint16_t f) const;
+  // Kapazität, die die automatische Abstimmung auf f wählt
+  uint16_t autoAntcap(uint16_t f) const;
+  const SimStation *tunedStation() const;
+  uint8_t  rdsFifoUsed() const { return fifoLen_; }
+
+  SimSi4735Stats stats = {};
+
+private:
+  typedef struct { uint16_t blk[4]; uint8_t err; } Group;
+
+  const SimStation *stations_ = nullptr;
+  uint8_t  count_ = 0;
+
+  bool     powered_ = false, fm_ = true;
+  uint16_t freq_ = 8750;
+  uint16_t antcap_ = 0, antcapSet_ = 0;
+  uint16_t fmBottom_ = 8750, fmTop_ = 10790, amBottom_ = 520, amTop_ = 1710;
+  uint8_t  fmSpacing_ = 10, amSpacing_ = 10;
+  uint8_t  fmSeekRssi_ = 20, amSeekRssi_ = 25, fmSeekSnr_ = 3, amSeekSnr_ = 5;
+
+  // Abstimmen / Seek
+  bool     stc_ = false;          // STCINT gesetzt
+  bool     pending_ = false;
+  uint64_t stcAtUs_ = 0;
+  bool     seeking_ = false, seekUp_ = true, seekWrap_ = true, bandLimit_ = false;
+  uint16_t seekFrom_ = 0, seekDest_ = 0, seekChannels_ = 0;
+  uint32_t perChannelUs_ = 0;
+
+  // RDS
+  Group    fifo_[SIM_FIFO_LEN];
+  uint8_t  fifoHead_ = 0, fifoLen_ = 0;
+  uint64_t nextGroupUs_ = 0;
+  uint32_t groupSeq_ = 0;
+  uint32_t rng_ = 0x12345678;
+
+  uint8_t  resp_[16];
+  uint8_t  respLen_ = 0;
+
+  uint16_t bottom() const  { return fm_ ? fmBottom_ : amBottom_; }
+  uint16_t top() const     { return fm_ ? fmTop_ : amTop_; }
+  uint8_t  spacing() const { return fm_ ? fmSpacing_ : amSpacing_; }
+  uint32_t rand16();
+  uint8_t  status();
+  void     update();
+  void     tune(uint16_t f, uint16_t cap);
+  void     seekStart(bool up, bool wrap);
+  uint16_t seekStep(uint16_t f, bool &limit) const;
+  bool     seekHit(uint16_t f) const;
+  void     setProperty(uint16_t prop, uint16_t value);
+  void     pumpRds();
+  void     makeGroup(const SimStation &s, Group &g);
+};
@@ -0,0 +1,67 @@
+#include "Wire.h"
+
+TwoWire Wire;
+
+bool TwoWire::begin(int, int, uint32_t frequency) {
+  if (frequency) clock_ = frequency;
+  return true;
+}
+
+bool TwoWire::setClock(uint32_t hz) {
+  if (hz) clock_ = hz;
+  return true;
+}
+
+void TwoWire::attach(uint8_t address, HostI2cDevice *dev) {
+  if (address < 128) devs_[address] = dev;
+}
+
+// Adressbyte plus Daten, je 9 Takte (8 Bit + ACK)
+void TwoWire::busTime(size_t bytes) {
+  const uint64_t us = ((uint64_t)(bytes + 1) * 9 * 1000000 + clock_ - 1) / clock_;
+  stats.busUs += us;
+  hostAdvanceUs(us);
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+  txAddr_ = address;
+  txLen_ = 0;
+}
+
+size_t TwoWire::write(uint8_t b) {
+  if (txLen_ >= sizeof(tx_)) return 0;
+  tx_[txLen_++] = b;
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t len) {
+  size_t n = 0;
+  while (n < len && write(data[n])) n++;
+  return n;
+}
+
+// 0 = OK, 2 = NACK auf die Adresse (wie im ESP32-Kern)
+uint8_t TwoWire::endTransmission(bool) {
+  busTime(txLen_);
+  HostI2cDevice *d = (txAddr_ < 128) ? devs_[txAddr_] : nullptr;
+  if (!d || !d->i2cWrite(tx_, txLen_)) { stats.nacks++; return 2; }
+  stats.writes++;
+  stats.bytes += txLen_;
+  return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity) {
+  rxLen_ = rxPos_ = 0;
+  if (quantity > sizeof(rx_)) quantity = sizeof(rx_);
+  HostI2cDevice *d = (address < 128) ? devs_[address] : nullptr;
+  if (!d) { busTime(0); stats.nacks++; return 0; }
+  rxLen_ = d->i2cRead(rx_, quantity);
+  busTime(rxLen_);
+  stats.reads++;
+  stats.bytes += rxLen_;
+  return (uint8_t) rxLen_;
+}
+
+int TwoWire::available() { return (int)(rxLen_ - rxPos_); }
+
+int TwoWire::read() { return (rxPos_ < rxLen_) ? rx_[rxPos_++] : -1; }
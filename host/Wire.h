@@ -0,0 +1,57 @@
+#pragma once
+#include "Arduino.h"
+
+// ===== Host-HAL: I2C =====
+// TwoWire mit der Schnittstelle des ESP32-Kerns. Übertragungen gehen an das
+// unter der Adresse angemeldete simulierte Gerät; ohne Gerät gibt es ein NACK.
+// Die virtuelle Zeit läuft um die Busdauer beim eingestellten Takt weiter.
+
+#define HOST_I2C_BUFFER 128
+
+class HostI2cDevice {
+public:
+  virtual ~HostI2cDevice() {}
+  // Schreibtransaktion (ohne Adressbyte); false = NACK
+  virtual bool i2cWrite(const uint8_t *data, size_t len) = 0;
+  // Lesetransaktion; liefert die Anzahl gelieferter Bytes
+  virtual size_t i2cRead(uint8_t *data, size_t len) = 0;
+};
+
+typedef struct {
+  uint32_t writes, reads, nacks;
+  uint32_t bytes;        // Daten ohne Adressbytes
+  uint64_t busUs;        // Summe der Busdauer
+} HostI2cStats;
+
+class TwoWire {
+public:
+  bool    begin(int sda = -1, int scl = -1, uint32_t frequency = 0);
+  bool    setClock(uint32_t hz);
+  uint32_t getClock() const { return clock_; }
+
+  void    beginTransmission(uint8_t address);
+  size_t  write(uint8_t b);
+  size_t  write(const uint8_t *data, size_t len);
+  uint8_t endTransmission(bool sendStop = true);
+
+  uint8_t requestFrom(uint8_t address, uint8_t quantity);
+  int     available();
+  int     read();
+
+  // Nur Host
+  void    attach(uint8_t address, HostI2cDevice *dev);
+  HostI2cStats stats;
+
+private:
+  void    busTime(size_t bytes);
+
+  HostI2cDevice *devs_[128] = {};
+  uint32_t clock_ = 100000;
+  uint8_t  txAddr_ = 0;
+  uint8_t  tx_[HOST_I2C_BUFFER];
+  size_t   txLen_ = 0;
+  uint8_t  rx_[HOST_I2C_BUFFER];
+  size_t   rxLen_ = 0, rxPos_ = 0;
+};
+
+extern TwoWire Wire;
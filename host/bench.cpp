@@ -0,0 +1,279 @@
+// ===== Host-Benchmarks =====
+// Misst die heißen Pfade, die ohne Hardware laufen: Frequenzanzeige, Raster,
+// SSB-Feinabstimmung, Encoder-Beschleunigung, Bandsuche, Status-/Band-JSON,
+// die RDS-Abfrage gegen den SI4735-Simulator, das Einstellungs-Log und den
+// OLED-Flush. Zeiten sind Wanduhr-ns je Aufruf (bester von BENCH_REPS
+// Durchläufen); unter "sim" stehen deterministische Zeiten der virtuellen Uhr.
+//
+//   bench [--quick] [-o datei.json]
+//
+// Ergebnis als JSON (ohne -o auf stdout); host/bench_baseline.json ist die
+// eingecheckte Referenz (cmake --build <dir> --target bench_baseline).
+
+#include <chrono>
+#include "Arduino.h"
+#include "Wire.h"
+#include "esp_partition.h"
+#include "Adafruit_SSD1306.h"
+#include "SimSi4735.h"
+#include "RadioLogic.h"
+#include "Bands.h"
+#include "ApiJson.h"
+#include "JsonWriter.h"
+#include "Rds.h"
+#include "SettingsLog.h"
+#include "OledFlush.h"
+
+#define BENCH_REPS     5
+#define BENCH_MAX      32
+#define BENCH_OUT_SIZE 8192
+
+typedef struct {
+  const char *name;
+  uint32_t    iters;
+  double      nsPerOp;
+} BenchResult;
+
+static BenchResult results[BENCH_MAX];
+static uint8_t     resultCount = 0;
+static uint32_t    iterDiv = 1;
+static volatile uint32_t sink;
+
+template <typename F>
+static void bench(const char *name, uint32_t iters, F fn) {
+  iters /= iterDiv;
+  if (iters == 0) iters = 1;
+  double best = 1e30;
+  for (uint8_t r = 0; r < BENCH_REPS; r++) {
+    const auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iters; i++) fn(i);
+    const auto t1 = std::chrono::steady_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / iters;
+    if (ns < best) best = ns;
+  }
+  if (resultCount < BENCH_MAX) results[resultCount++] = { name, iters, best };
+  fprintf(stderr, "%-24s %10u iters %10.1f ns/op\n", name, (unsigned) iters, best);
+}
+
+// ===== Simulierter Empfänger =====
+static const SimStation stations[] = {
+  //  freq   fm     rssi snr  pi      pty ps          rt
+  {  8850, true,   45,  28, 0xD312, 10, "NDR 2",    "Musik fuer den Norden" },
+  {  9410, true,   60,  35, 0xD3A1,  3, "SIM FM1",  "Simulierter Sender mit RadioText ueber mehrere Segmente" },
+  { 10130, true,   22,  12, 0xD444,  1, "WEAK",     "Schwacher Sender" },
+  {   531, false,  50,  30, 0,       0, nullptr,    nullptr },
+  {   999, false,  42,  24, 0,       0, nullptr,    nullptr },
+  {  1440, false,  38,  20, 0,       0, nullptr,    nullptr },
+  {  6000, false,  35,  18, 0,       0, nullptr,    nullptr },
+  {  7300, false,  30,  15, 0,       0, nullptr,    nullptr },
+};
+
+static SimSi4735  sim;
+static SimSsd1306 simOled;
+
+static void siWrite(const uint8_t *d, size_t n) {
+  Wire.beginTransmission(SIM_SI4735_ADDR);
+  Wire.write(d, n);
+  Wire.endTransmission();
+}
+
+static uint8_t siStatus() {
+  Wire.requestFrom((uint8_t) SIM_SI4735_ADDR, (uint8_t) 1);
+  return (uint8_t) Wire.read();
+}
+
+// Wartet wie die Library in 1-ms-Schritten auf STC und quittiert
+static void siWaitStc(bool fm) {
+  while (!(siStatus() & 0x01)) delay(1);
+  const uint8_t ack[] = { (uint8_t)(fm ? 0x22 : 0x42), 0x01 };
+  siWrite(ack, sizeof(ack));
+}
+
+static void siPowerUp(bool fm) {
+  const uint8_t up[] = { 0x01, (uint8_t)(fm ? 0x10 : 0x11), 0x05 };
+  siWrite(up, sizeof(up));
+}
+
+static void siSetProperty(uint16_t prop, uint16_t value) {
+  const uint8_t p[] = { 0x12, 0, (uint8_t)(prop >> 8), (uint8_t) prop, (uint8_t)(value >> 8), (uint8_t) value };
+  siWrite(p, sizeof(p));
+}
+
+// Liefert die virtuelle Dauer bis STC in µs
+static uint32_t siTune(bool fm, uint16_t f, uint16_t cap) {
+  const uint64_t t0 = hostNowUs();
+  if (fm) {
+    const uint8_t c[] = { 0x20, 0, (uint8_t)(f >> 8), (uint8_t) f, (uint8_t) cap };
+    siWrite(c, sizeof(c));
+  } else {
+    const uint8_t c[] = { 0x40, 0, (uint8_t)(f >> 8), (uint8_t) f, (uint8_t)(cap >> 8), (uint8_t) cap };
+    siWrite(c, sizeof(c));
+  }
+  siWaitStc(fm);
+  return (uint32_t)(hostNowUs() - t0);
+}
+
+static uint32_t siSeek(bool fm, bool up) {
+  const uint64_t t0 = hostNowUs();
+  const uint8_t c[] = { (uint8_t)(fm ? 0x21 : 0x41), (uint8_t)((up ? 0x08 : 0) | 0x04) };
+  siWrite(c, sizeof(c));
+  siWaitStc(fm);
+  return (uint32_t)(hostNowUs() - t0);
+}
+
+// ===== Benchmarks =====
+static void benchLogic() {
+  char buf[24];
+  bench("format_freq_fm", 2000000, [&](uint32_t i) { sink += formatFreq(buf, sizeof(buf), 8750 + i % 2050, true); });
+  bench("format_freq_am", 2000000, [&](uint32_t i) { sink += formatFreq(buf, sizeof(buf), 150 + i % 29850, false); });
+  bench("format_freq_hz", 2000000, [&](uint32_t i) { sink += formatFreqHz(buf, sizeof(buf), 7000000 + i * 10); });
+  bench("align_mw_region", 5000000, [](uint32_t i) {
+    sink += alignMwToRegion(520 + i % 1190, 520, 1710, (i & 1) ? REGION_10KHZ : REGION_9KHZ);
+  });
+  bench("fine_tune_split", 5000000, [](uint32_t i) {
+    static uint16_t cur = 7000;
+    uint16_t k; int16_t bfo;
+    if (fineTuneSplit(7000000 + (i % 30000) * 10, cur, SSB_FINE_WINDOW_HZ, 7000, 7300, k, bfo)) cur = k;
+    sink += bfo;
+  });
+  bench("enc_accel_update", 5000000, [](uint32_t i) {
+    static EncAccel st = { 0, 0 };
+    sink += encAccelUpdate(st, i * 7, (i & 3) + 1);
+  });
+  bench("band_find", 5000000, [](uint32_t i) {
+    const bool fm = i & 1;
+    const uint16_t f = fm ? 8750 + (i * 37) % 2050 : 150 + (i * 7919) % 29850;
+    sink += bandFind(fm, f);
+  });
+}
+
+static void benchJson() {
+  static char out[4096];
+  RadioSnapshot st;
+  memset(&st, 0, sizeof(st));
+  st.freq = 9410; st.freqHz = 94100000; st.mode = BAND_MODE_FM; st.bandIdx = 0; st.isFM = true;
+  st.rssi = 60; st.snr = 35; st.stepKHz = 100; st.memSlot = -1;
+  strcpy(st.ps, "SIM FM1");
+  bench("status_json_full", 1000000, [&](uint32_t i) {
+    st.rssi = 40 + (i & 15);
+    sink += apiStatusJson(out, sizeof(out), st, NULL, "STA", "192.168.178.42");
+  });
+  RadioSnapshot prev = st;
+  bench("status_json_delta", 1000000, [&](uint32_t i) {
+    st.rssi = 40 + (i & 15);
+    st.snr = 20 + (i & 7);
+    sink += apiStatusJson(out, sizeof(out), st, &prev, NULL, NULL);
+  });
+  bench("bands_json", 100000, [&](uint32_t) { sink += apiBandsJson(out, sizeof(out)); });
+}
+
+// RDS-Abfrage wie im Radio-Task: rdsService() im Takt des eigenen Intervalls
+static uint32_t benchRds(char *ps, size_t pssz) {
+  siPowerUp(true);
+  siTune(true, 9410, 0);
+  const uint64_t t0 = hostNowUs();
+  rdsBegin(SIM_SI4735_ADDR);
+  uint32_t psMs = 0;
+  while (hostNowUs() - t0 < 5000000ULL) {
+    hostAdvanceUs((uint64_t) rdsLocal().pollMs * 1000);
+    rdsService();
+    if (!psMs && strcmp(rdsLocal().ps, "SIM FM1 ") == 0) psMs = (uint32_t)((hostNowUs() - t0) / 1000);
+  }
+  snprintf(ps, pssz, "%s", rdsLocal().ps);
+  bench("rds_poll", 200000, [](uint32_t) {
+    hostAdvanceUs((uint64_t) rdsLocal().pollMs * 1000);
+    sink += rdsService();
+  });
+  return psMs;
+}
+
+static void benchSettings() {
+  settingsBegin(1);
+  bench("settings_put", 200000, [](uint32_t i) { sink += settingsPut(SK_VOLUME, 0, i & 63); });
+}
+
+static bool benchOled() {
+  static Adafruit_SSD1306 oled(128, 32, &Wire, -1);
+  oled.begin(SSD1306_SWITCHCAPVCC, 0x3C);
+  oledFlushBegin(&oled, 0x3C);
+  oledFlush(true);
+  // Typischer Frame: S-Meter-Balken in der unteren Zeile ändert sich
+  bench("oled_flush_meter", 200000, [](uint32_t i) {
+    oled.fillRect(0, 26, 128, 6, SSD1306_BLACK);
+    oled.fillRect(0, 26, 8 + (i % 100), 6, SSD1306_WHITE);
+    oledRequestFlush();
+    oledFlush(true);
+  });
+  return memcmp(simOled.gddram, oled.getBuffer(), 128 * 32 / 8) == 0;
+}
+
+// ===== Ausgabe =====
+static void fmtDouble(char *out, size_t outsz, double v) { snprintf(out, outsz, "%.1f", v); }
+
+int main(int argc, char **argv) {
+  const char *outPath = nullptr;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--quick")) iterDiv = 100;
+    else if (!strcmp(argv[i], "-o") && i + 1 < argc) outPath = argv[++i];
+    else { fprintf(stderr, "usage: %s [--quick] [-o out.json]\n", argv[0]); return 2; }
+  }
+
+  bandsBegin();
+  Wire.attach(SIM_SI4735_ADDR, &sim);
+  Wire.attach(0x3C, &simOled);
+  sim.setStations(stations, sizeof(stations) / sizeof(stations[0]));
+  hostPartitionCreate(SETTINGS_PARTITION, 0x4000);
+
+  benchLogic();
+  benchJson();
+  char ps[9];
+  const uint32_t rdsPsMs = benchRds(ps, sizeof(ps));
+  benchSettings();
+  const bool oledOk = benchOled();
+
+  // Deterministische Zeiten im Simulator (virtuelle Uhr)
+  siPowerUp(true);
+  siSetProperty(0x1402, 10);
+  siTune(true, 8750, 0);
+  const uint32_t seekFmUs = siSeek(true, true);          // 87,5 -> 88,5 MHz
+  const uint16_t seekFmTo = sim.frequency();
+  siPowerUp(false);
+  siSetProperty(0x3400, 520); siSetProperty(0x3401, 1710); siSetProperty(0x3402, 9);
+  const uint32_t tuneAmAutoUs = siTune(false, 999, 0);
+  const uint16_t cap = sim.antcap();
+  const uint32_t tuneAmPresetUs = siTune(false, 999, cap);
+  siTune(false, 531, 0);
+  const uint32_t seekAmUs = siSeek(false, true);         // 531 -> 999 kHz im 9-kHz-Raster
+  const uint16_t seekAmTo = sim.frequency();
+
+  static char out[BENCH_OUT_SIZE];
+  char num[24];
+  JsonWriter w(out, sizeof(out));
+  w.beginObject().kv("schema", 1).kv("quick", iterDiv > 1).beginArray("results");
+  for (uint8_t i = 0; i < resultCount; i++) {
+    fmtDouble(num, sizeof(num), results[i].nsPerOp);
+    w.beginObject().kv("name", results[i].name).kv("iters", (unsigned long) results[i].iters).kvRaw("ns_per_op", num).endObject();
+  }
+  w.endArray().beginObject("sim")
+   .kv("tune_am_auto_us", (unsigned long) tuneAmAutoUs)
+   .kv("tune_am_preset_us", (unsigned long) tuneAmPresetUs)
+   .kv("seek_fm_us", (unsigned long) seekFmUs).kv("seek_fm_to", (unsigned) seekFmTo)
+   .kv("seek_am_us", (unsigned long) seekAmUs).kv("seek_am_to", (unsigned) seekAmTo)
+   .kv("rds_ps_ms", (unsigned long) rdsPsMs).kv("rds_ps", ps)
+   .kv("rds_groups", (unsigned long) sim.stats.rdsGroups)
+   .kv("oled_bytes_per_frame", (unsigned long) oledStats.bytesLastFrame)
+   .kv("settings_compactions", (unsigned long) settingsStats.compactions)
+   .endObject().endObject();
+
+  // Plausibilität: RDS dekodiert, OLED-Abbild stimmt, Seeks treffen die Sender
+  const bool ok = !w.overflow() && rdsPsMs > 0 && oledOk && seekFmTo == 8850 && seekAmTo == 999
+               && tuneAmPresetUs < tuneAmAutoUs;
+  if (!ok) fprintf(stderr, "bench: self-check failed (ps=\"%s\" oled=%d seek=%u/%u)\n", ps, oledOk, seekFmTo, seekAmTo);
+
+  FILE *f = outPath ? fopen(outPath, "w") : stdout;
+  if (!f) { perror(outPath); return 1; }
+  fputs(out, f);
+  fputc('\n', f);
+  if (outPath) fclose(f);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "Arduino.h"
+
+// ===== Host-HAL: Flash-Partition =====
+// Partitionen im RAM mit NOR-Flash-Verhalten: Schreiben kann Bits nur löschen
+// (1 -> 0), Löschen setzt ganze 4-KB-Sektoren auf 0xFF.
+
+typedef int esp_err_t;
+#define ESP_OK               0
+#define ESP_FAIL             -1
+#define ESP_ERR_INVALID_ARG  0x102
+#define ESP_ERR_INVALID_SIZE 0x104
+
+typedef enum { ESP_PARTITION_TYPE_APP = 0x00, ESP_PARTITION_TYPE_DATA = 0x01 } esp_partition_type_t;
+typedef enum { ESP_PARTITION_SUBTYPE_ANY = 0xff } esp_partition_subtype_t;
+
+#define HOST_FLASH_SECTOR 4096
+
+typedef struct {
+  esp_partition_type_t type;
+  uint8_t  subtype;
+  uint32_t address;
+  uint32_t size;
+  char     label[17];
+  uint8_t *data;         // nur Host
+} esp_partition_t;
+
+typedef struct {
+  uint32_t reads, writes, erases;
+  uint32_t bytesWritten;
+} HostFlashStats;
+
+extern HostFlashStats hostFlashStats;
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char *label);
+esp_err_t esp_partition_read(const esp_partition_t *p, size_t offset, void *dst, size_t size);
+esp_err_t esp_partition_write(const esp_partition_t *p, size_t offset, const void *src, size_t size);
+esp_err_t esp_partition_erase_range(const esp_partition_t *p, size_t offset, size_t size);
+
+// Nur Host: Datenpartition anlegen (gelöscht); size in ganzen Sektoren
+const esp_partition_t *hostPartitionCreate(const char *label, uint32_t size);
@@ -0,0 +1,136 @@
+// ===== Encoder-Test =====
+// Spielt aufgezeichnete Pegelfolgen der Kontakte A/B durch Rotary::process()
+// wie die ISR der .ino (ein Aufruf je Flanke, Summe in einem atomaren Zähler)
+// und prüft die aufaddierten Rastungen sowie die Beschleunigung.
+
+#include <atomic>
+#include "Arduino.h"
+#include "Rotary.h"
+#include "RadioLogic.h"
+
+#define ENCODER_PIN_A 13
+#define ENCODER_PIN_B 14
+
+static Rotary encoder(ENCODER_PIN_A, ENCODER_PIN_B);
+static std::atomic<int32_t> encoderAccum{0};
+static int failures = 0;
+
+#define CHECK(cond, ...) do { if (!(cond)) { failures++; fprintf(stderr, "FAIL %s:%d: ", __FILE__, __LINE__); \
+                                 fprintf(stderr, __VA_ARGS__); fputc('\n', stderr); } } while (0)
+
+// Wie rotaryEncoder() in der .ino
+static void isr() {
+  const uint8_t s = encoder.process();
+  if (s) encoderAccum.fetch_add((s == DIR_CW) ? 1 : -1, std::memory_order_relaxed);
+}
+
+static int32_t drain() { return encoderAccum.exchange(0, std::memory_order_relaxed); }
+
+// Pegel als "BA" (Bit 1 = B, Bit 0 = A), Ruhelage 11 mit Pull-ups
+static void level(uint8_t ba) {
+  hostSetPin(ENCODER_PIN_A, ba & 1);
+  hostSetPin(ENCODER_PIN_B, (ba >> 1) & 1);
+  isr();
+}
+
+static void play(const uint8_t *seq, size_t n) { for (size_t i = 0; i < n; i++) level(seq[i]); }
+
+static const uint8_t CW[]  = { 0b01, 0b00, 0b10, 0b11 };
+static const uint8_t CCW[] = { 0b10, 0b00, 0b01, 0b11 };
+
+static void detents(const uint8_t *dir, int n) { for (int i = 0; i < n; i++) play(dir, 4); }
+
+static void reset() {
+  level(0b11);
+  drain();
+}
+
+// ===== Fälle =====
+static void testDirections() {
+  reset();
+  detents(CW, 10);
+  CHECK(drain() == 10, "10 CW detents");
+  detents(CCW, 7);
+  CHECK(drain() == -7, "7 CCW detents");
+  detents(CW, 3);
+  detents(CCW, 5);
+  CHECK(drain() == -2, "3 CW then 5 CCW without drain");
+}
+
+// Prellen an jeder Flanke: der Zustandsautomat pendelt, zählt aber einmal
+static void testBounce() {
+  reset();
+  static const uint8_t cwBounce[] = {
+    0b01, 0b11, 0b01, 0b11, 0b01,     // A prellt beim Einrasten
+    0b00, 0b01, 0b00,                 // B prellt
+    0b10, 0b00, 0b10,                 // A prellt
+    0b11, 0b10, 0b11,                 // B prellt in der Ruhelage
+  };
+  for (int i = 0; i < 5; i++) play(cwBounce, sizeof(cwBounce));
+  CHECK(drain() == 5, "5 bouncy CW detents");
+
+  static const uint8_t ccwBounce[] = { 0b10, 0b11, 0b10, 0b00, 0b10, 0b00, 0b01, 0b00, 0b01, 0b11, 0b01, 0b11 };
+  for (int i = 0; i < 4; i++) play(ccwBounce, sizeof(ccwBounce));
+  CHECK(drain() == -4, "4 bouncy CCW detents");
+
+  // Doppelte ISR-Aufrufe mit demselben Pegel (beide Pins lösen aus)
+  for (int i = 0; i < 6; i++) for (uint8_t k = 0; k < 4; k++) { level(CW[k]); level(CW[k]); }
+  CHECK(drain() == 6, "duplicate samples");
+}
+
+// Halbe Rastung und zurück, ungültige Sprünge: keine Zählung
+static void testNoSpurious() {
+  reset();
+  static const uint8_t halfBack[] = { 0b01, 0b00, 0b01, 0b11 };
+  for (int i = 0; i < 8; i++) play(halfBack, sizeof(halfBack));
+  CHECK(drain() == 0, "half detent and back");
+
+  static const uint8_t jump[] = { 0b01, 0b10, 0b11, 0b10, 0b01, 0b11 };   // Störung: 01 -> 10
+  for (int i = 0; i < 8; i++) play(jump, sizeof(jump));
+  CHECK(drain() == 0, "invalid transitions");
+
+  detents(CW, 2);
+  CHECK(drain() == 2, "counts again after disturbance");
+}
+
+// Schnelles Drehen: der Verbraucher holt nur selten ab, es geht nichts verloren,
+// und die Beschleunigung greift
+static void testFastSpin() {
+  reset();
+  EncAccel acc = { 0, 0 };
+  uint32_t now = 0;
+  int32_t total = 0;
+  uint8_t mult = 1;
+  for (int d = 0; d < 300; d++) {
+    for (uint8_t k = 0; k < 4; k++) { level(CW[k]); hostAdvanceUs(1000); }   // 4 ms je Rastung
+    now += 4;
+    if (d % 25 == 24) {                  // Radio-Task alle 100 ms beschäftigt
+      const int32_t n = drain();
+      total += n;
+      mult = encAccelUpdate(acc, now, n);
+    }
+  }
+  total += drain();
+  CHECK(total == 300, "fast spin lost detents: %d", (int) total);
+  CHECK(mult >= 10, "fast spin multiplier %u", mult);
+
+  // Langsam: eine Rastung je 300 ms bleibt bei Faktor 1
+  for (int d = 0; d < 5; d++) {
+    detents(CCW, 1);
+    now += 300;
+    mult = encAccelUpdate(acc, now, drain());
+  }
+  CHECK(mult == 1, "slow turn multiplier %u", mult);
+}
+
+int main() {
+  pinMode(ENCODER_PIN_A, INPUT_PULLUP);
+  pinMode(ENCODER_PIN_B, INPUT_PULLUP);
+  testDirections();
+  testBounce();
+  testNoSpurious();
+  testFastSpin();
+  if (failures) { fprintf(stderr, "%d failure(s)\n", failures); return 1; }
+  printf("rotary: all cases passed\n");
+  return 0;
+}
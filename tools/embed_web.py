@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+"""Komprimiert die Web-Seiten aus web/ und erzeugt WebAssets.h.
+
+Jede Seite wird gzip-komprimiert (deterministisch, mtime=0) als PROGMEM-Array
+abgelegt, zusammen mit einem starken ETag aus dem SHA-256 des Inhalts.
+
+Aufruf aus dem Sketch-Verzeichnis nach jeder Änderung an web/*.html:
+    python3 tools/embed_web.py
+"""
+import gzip
+import hashlib
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+ASSETS = [
+    ("INDEX_HTML", "web/index.html"),
+    ("WIFI_HTML", "web/wifi.html"),
+]
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + ",".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    out = [
+        "// Automatisch erzeugt von tools/embed_web.py - nicht von Hand bearbeiten.",
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+    ]
+    for name, path in ASSETS:
+        with open(os.path.join(ROOT, path), "rb") as f:
+            raw = f.read()
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha256(raw).hexdigest()[:16]
+        out.append("// %s: %d Bytes, gzip %d Bytes" % (path, len(raw), len(gz)))
+        out.append("static const uint8_t %s_GZ[] PROGMEM = {" % name)
+        out.append(c_array(gz))
+        out.append("};")
+        out.append("static const size_t %s_GZ_LEN = %d;" % (name, len(gz)))
+        out.append("static const char %s_ETAG[] = \"\\\"%s\\\"\";" % (name, etag))
+        out.append("")
+
+    with open(os.path.join(ROOT, "WebAssets.h"), "w", newline="\r\n") as f:
+        f.write("\n".join(out))
+    print("WebAssets.h geschrieben")
+
+
+if __name__ == "__main__":
+    main()